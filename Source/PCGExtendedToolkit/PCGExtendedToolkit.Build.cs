@@ -1,4 +1,4 @@
-// Copyright 2025 Timothé Lapetite and contributors
+﻿// Copyright 2025 Timothé Lapetite and contributors
 // Released under the MIT license https://opensource.org/license/MIT/
 
 using UnrealBuildTool;
@@ -52,7 +52,8 @@ public class PCGExtendedToolkit : ModuleRules
 				"SlateCore",
 				"GameplayTags",
 				"PropertyPath",
-				"DeveloperSettings"
+				"DeveloperSettings",
+				"Json"
 			}
 		);
 
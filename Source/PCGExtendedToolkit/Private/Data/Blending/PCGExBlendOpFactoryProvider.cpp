@@ -184,6 +184,17 @@ void FPCGExBlendOperation::BlendAutoWeight(const int32 SourceIndex, const int32
 	Blender->Blend(SourceIndex, TargetIndex, Config.Weighting.ScoreCurveObj->Eval(Weight->Read(SourceIndex)));
 }
 
+void FPCGExBlendOperation::BlendAutoWeightRange(const PCGExMT::FScope& Scope, const TConstArrayView<int8> Mask)
+{
+	TArray<double, TInlineAllocator<PCGExData::ProxyRangeChunkSize>> Weights;
+	Weights.SetNumUninitialized(Scope.Count);
+
+	Weight->ReadRange(Scope.Start, Weights);
+	for (double& W : Weights) { W = Config.Weighting.ScoreCurveObj->Eval(W); }
+
+	Blender->BlendRange(Scope, Weights, Mask);
+}
+
 void FPCGExBlendOperation::Blend(const int32 SourceIndex, const int32 TargetIndex, const double InWeight)
 {
 	Blender->Blend(SourceIndex, TargetIndex, Config.Weighting.ScoreCurveObj->Eval(InWeight));
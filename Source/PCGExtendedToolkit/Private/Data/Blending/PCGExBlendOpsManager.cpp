@@ -138,6 +138,11 @@ namespace PCGExDataBlending
 		for (int i = 0; i < Operations->Num(); i++) { (*(Operations->GetData() + i))->BlendAutoWeight(SourceIndex, TargetIndex); }
 	}
 
+	void FBlendOpsManager::BlendAutoWeightRange(const PCGExMT::FScope& Scope, const TConstArrayView<int8> Mask) const
+	{
+		for (int i = 0; i < Operations->Num(); i++) { (*(Operations->GetData() + i))->BlendAutoWeightRange(Scope, Mask); }
+	}
+
 	void FBlendOpsManager::Blend(const int32 SourceIndex, const int32 TargetIndex, const double InWeight) const
 	{
 		for (int i = 0; i < Operations->Num(); i++) { (*(Operations->GetData() + i))->Blend(SourceIndex, TargetIndex, InWeight); }
@@ -29,6 +29,12 @@ namespace PCGExDataBlending
 		return InUnionData->ComputeWeights(SourcesData, IOLookup, Target, Distances, OutWeightedPoints);
 	}
 
+	int32 FDummyUnionBlender::ComputeWeights(const int32 WriteIndex, const TConstArrayView<PCGExData::FElement> InElements, TArray<PCGExData::FWeightedPoint>& OutWeightedPoints) const
+	{
+		const PCGExData::FConstPoint Target = CurrentTargetData->Source->GetOutPoint(WriteIndex);
+		return PCGExData::ComputeUnionWeights(InElements, SourcesData, IOLookup, Target, Distances, OutWeightedPoints);
+	}
+
 	template <typename T>
 	void FProxyDataBlender::Set(const int32 TargetIndex, const T Value) const
 	{
@@ -112,44 +118,92 @@ template PCGEXTENDEDTOOLKIT_API void FProxyDataBlender::Set<_TYPE>(const int32 T
 #undef PCGEX_DECL_BLEND_BIT
 
 	template <typename T_WORKING, EPCGExABBlendingType BLEND_MODE, bool bResetValueForMultiBlend>
-	void TProxyDataBlender<T_WORKING, BLEND_MODE, bResetValueForMultiBlend>::Blend(const int32 SourceIndexA, const int32 SourceIndexB, const int32 TargetIndex, const double Weight)
+	T_WORKING TProxyDataBlender<T_WORKING, BLEND_MODE, bResetValueForMultiBlend>::BlendValues(const T_WORKING& InA, const T_WORKING& InB, const double Weight)
 	{
 		BOOKMARK_BLENDMODE
 
+		if constexpr (BLEND_MODE == EPCGExABBlendingType::Average) { return PCGExBlend::Div(PCGExBlend::Add(InA, InB), 2); }
+		else if constexpr (BLEND_MODE == EPCGExABBlendingType::Weight) { return PCGExBlend::WeightedAdd(InA, InB, Weight); }
+		else if constexpr (BLEND_MODE == EPCGExABBlendingType::Min) { return PCGExBlend::Min(InA, InB); }
+		else if constexpr (BLEND_MODE == EPCGExABBlendingType::Max) { return PCGExBlend::Max(InA, InB); }
+		else if constexpr (BLEND_MODE == EPCGExABBlendingType::Add) { return PCGExBlend::Add(InA, InB); }
+		else if constexpr (BLEND_MODE == EPCGExABBlendingType::Subtract) { return PCGExBlend::Sub(InA, InB); }
+		else if constexpr (BLEND_MODE == EPCGExABBlendingType::Multiply) { return PCGExBlend::Mult(InA, InB); }
+		else if constexpr (BLEND_MODE == EPCGExABBlendingType::Divide) { return PCGExBlend::Div(InA, PCGEx::Convert<T_WORKING, double>(InB)); }
+		else if constexpr (BLEND_MODE == EPCGExABBlendingType::WeightedAdd) { return PCGExBlend::WeightedAdd(InA, InB, Weight); }
+		else if constexpr (BLEND_MODE == EPCGExABBlendingType::WeightedSubtract) { return PCGExBlend::WeightedSub(InA, InB, Weight); }
+		else if constexpr (BLEND_MODE == EPCGExABBlendingType::Lerp) { return PCGExBlend::Lerp(InA, InB, Weight); }
+		else if constexpr (BLEND_MODE == EPCGExABBlendingType::UnsignedMin) { return PCGExBlend::UnsignedMin(InA, InB); }
+		else if constexpr (BLEND_MODE == EPCGExABBlendingType::UnsignedMax) { return PCGExBlend::UnsignedMax(InA, InB); }
+		else if constexpr (BLEND_MODE == EPCGExABBlendingType::AbsoluteMin) { return PCGExBlend::AbsoluteMin(InA, InB); }
+		else if constexpr (BLEND_MODE == EPCGExABBlendingType::AbsoluteMax) { return PCGExBlend::AbsoluteMax(InA, InB); }
+		else if constexpr (BLEND_MODE == EPCGExABBlendingType::CopyTarget) { return InB; }
+		else if constexpr (BLEND_MODE == EPCGExABBlendingType::CopySource) { return InA; }
+		else if constexpr (BLEND_MODE == EPCGExABBlendingType::Hash) { return PCGExBlend::NaiveHash(InA, InB); }
+		else if constexpr (BLEND_MODE == EPCGExABBlendingType::UnsignedHash) { return PCGExBlend::NaiveUnsignedHash(InA, InB); }
+		else if constexpr (BLEND_MODE == EPCGExABBlendingType::Mod) { return PCGExBlend::ModSimple(InA, PCGEx::Convert<T_WORKING, double>(InB)); }
+		else if constexpr (BLEND_MODE == EPCGExABBlendingType::ModCW) { return PCGExBlend::ModComplex(InA, InB); }
+		else { return InA; }
+	}
+
+	template <typename T_WORKING, EPCGExABBlendingType BLEND_MODE, bool bResetValueForMultiBlend>
+	void TProxyDataBlender<T_WORKING, BLEND_MODE, bResetValueForMultiBlend>::Blend(const int32 SourceIndexA, const int32 SourceIndexB, const int32 TargetIndex, const double Weight)
+	{
 		check(A)
 		if constexpr (BLEND_MODE != EPCGExABBlendingType::CopySource) { check(B) }
 		check(C)
 
-#define PCGEX_A A->Get(SourceIndexA)
-#define PCGEX_B B->Get(SourceIndexB)
-
 		if constexpr (BLEND_MODE == EPCGExABBlendingType::None)
 		{
 		}
-		else if constexpr (BLEND_MODE == EPCGExABBlendingType::Average) { C->Set(TargetIndex, PCGExBlend::Div(PCGExBlend::Add(PCGEX_A,PCGEX_B), 2)); }
-		else if constexpr (BLEND_MODE == EPCGExABBlendingType::Weight) { C->Set(TargetIndex, PCGExBlend::WeightedAdd(PCGEX_A, PCGEX_B, Weight)); }
-		else if constexpr (BLEND_MODE == EPCGExABBlendingType::Min) { C->Set(TargetIndex, PCGExBlend::Min(PCGEX_A,PCGEX_B)); }
-		else if constexpr (BLEND_MODE == EPCGExABBlendingType::Max) { C->Set(TargetIndex, PCGExBlend::Max(PCGEX_A,PCGEX_B)); }
-		else if constexpr (BLEND_MODE == EPCGExABBlendingType::Add) { C->Set(TargetIndex, PCGExBlend::Add(PCGEX_A,PCGEX_B)); }
-		else if constexpr (BLEND_MODE == EPCGExABBlendingType::Subtract) { C->Set(TargetIndex, PCGExBlend::Sub(PCGEX_A,PCGEX_B)); }
-		else if constexpr (BLEND_MODE == EPCGExABBlendingType::Multiply) { C->Set(TargetIndex, PCGExBlend::Mult(PCGEX_A,PCGEX_B)); }
-		else if constexpr (BLEND_MODE == EPCGExABBlendingType::Divide) { C->Set(TargetIndex, PCGExBlend::Div(PCGEX_A, PCGEx::Convert<T_WORKING, double>(PCGEX_B))); }
-		else if constexpr (BLEND_MODE == EPCGExABBlendingType::WeightedAdd) { C->Set(TargetIndex, PCGExBlend::WeightedAdd(PCGEX_A,PCGEX_B, Weight)); }
-		else if constexpr (BLEND_MODE == EPCGExABBlendingType::WeightedSubtract) { C->Set(TargetIndex, PCGExBlend::WeightedSub(PCGEX_A, PCGEX_B, Weight)); }
-		else if constexpr (BLEND_MODE == EPCGExABBlendingType::Lerp) { C->Set(TargetIndex, PCGExBlend::Lerp(PCGEX_A,PCGEX_B, Weight)); }
-		else if constexpr (BLEND_MODE == EPCGExABBlendingType::UnsignedMin) { C->Set(TargetIndex, PCGExBlend::UnsignedMin(PCGEX_A,PCGEX_B)); }
-		else if constexpr (BLEND_MODE == EPCGExABBlendingType::UnsignedMax) { C->Set(TargetIndex, PCGExBlend::UnsignedMax(PCGEX_A,PCGEX_B)); }
-		else if constexpr (BLEND_MODE == EPCGExABBlendingType::AbsoluteMin) { C->Set(TargetIndex, PCGExBlend::AbsoluteMin(PCGEX_A,PCGEX_B)); }
-		else if constexpr (BLEND_MODE == EPCGExABBlendingType::AbsoluteMax) { C->Set(TargetIndex, PCGExBlend::AbsoluteMax(PCGEX_A,PCGEX_B)); }
-		else if constexpr (BLEND_MODE == EPCGExABBlendingType::CopyTarget) { C->Set(TargetIndex, PCGEX_B); }
-		else if constexpr (BLEND_MODE == EPCGExABBlendingType::CopySource) { C->Set(TargetIndex, PCGEX_A); }
-		else if constexpr (BLEND_MODE == EPCGExABBlendingType::Hash) { C->Set(TargetIndex, PCGExBlend::NaiveHash(PCGEX_A,PCGEX_B)); }
-		else if constexpr (BLEND_MODE == EPCGExABBlendingType::UnsignedHash) { C->Set(TargetIndex, PCGExBlend::NaiveUnsignedHash(PCGEX_A,PCGEX_B)); }
-		else if constexpr (BLEND_MODE == EPCGExABBlendingType::Mod) { C->Set(TargetIndex, PCGExBlend::ModSimple(PCGEX_A, PCGEx::Convert<T_WORKING, double>(PCGEX_B))); }
-		else if constexpr (BLEND_MODE == EPCGExABBlendingType::ModCW) { C->Set(TargetIndex, PCGExBlend::ModComplex(PCGEX_A,PCGEX_B)); }
-
-#undef PCGEX_A
-#undef PCGEX_B
+		else if constexpr (BLEND_MODE == EPCGExABBlendingType::CopyTarget) { C->Set(TargetIndex, B->Get(SourceIndexB)); }
+		else if constexpr (BLEND_MODE == EPCGExABBlendingType::CopySource) { C->Set(TargetIndex, A->Get(SourceIndexA)); }
+		else { C->Set(TargetIndex, BlendValues(A->Get(SourceIndexA), B->Get(SourceIndexB), Weight)); }
+	}
+
+	template <typename T_WORKING, EPCGExABBlendingType BLEND_MODE, bool bResetValueForMultiBlend>
+	void TProxyDataBlender<T_WORKING, BLEND_MODE, bResetValueForMultiBlend>::BlendRange(const PCGExMT::FScope& Scope, const TConstArrayView<double> Weights, const TConstArrayView<int8> Mask)
+	{
+		check(A)
+		if constexpr (BLEND_MODE != EPCGExABBlendingType::CopySource) { check(B) }
+		check(C)
+
+		if constexpr (BLEND_MODE != EPCGExABBlendingType::None)
+		{
+			constexpr int32 ChunkSize = PCGExData::ProxyRangeChunkSize;
+
+			T_WORKING ValuesA[ChunkSize];
+			T_WORKING ValuesB[ChunkSize];
+
+			for (int32 Offset = 0; Offset < Scope.Count; Offset += ChunkSize)
+			{
+				const int32 Num = FMath::Min(ChunkSize, Scope.Count - Offset);
+				const PCGExMT::FScope Chunk(Scope.Start + Offset, Num);
+
+				// Results are written in ValuesA
+				if constexpr (BLEND_MODE == EPCGExABBlendingType::CopyTarget) { B->GetRange(Chunk, MakeArrayView(ValuesA, Num)); }
+				else if constexpr (BLEND_MODE == EPCGExABBlendingType::CopySource) { A->GetRange(Chunk, MakeArrayView(ValuesA, Num)); }
+				else
+				{
+					A->GetRange(Chunk, MakeArrayView(ValuesA, Num));
+					B->GetRange(Chunk, MakeArrayView(ValuesB, Num));
+					for (int i = 0; i < Num; i++) { ValuesA[i] = BlendValues(ValuesA[i], ValuesB[i], Weights[Offset + i]); }
+				}
+
+				// Write back contiguous runs of unmasked values
+				int32 RunStart = 0;
+				while (RunStart < Num)
+				{
+					while (RunStart < Num && !Mask[Offset + RunStart]) { RunStart++; }
+
+					int32 RunEnd = RunStart;
+					while (RunEnd < Num && Mask[Offset + RunEnd]) { RunEnd++; }
+
+					if (RunEnd > RunStart) { C->SetRange(PCGExMT::FScope(Chunk.Start + RunStart, RunEnd - RunStart), MakeArrayView(ValuesA + RunStart, RunEnd - RunStart)); }
+					RunStart = RunEnd;
+				}
+			}
+		}
 	}
 
 	template <typename T_WORKING, EPCGExABBlendingType BLEND_MODE, bool bResetValueForMultiBlend>
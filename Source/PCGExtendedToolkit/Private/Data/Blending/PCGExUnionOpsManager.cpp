@@ -69,6 +69,12 @@ namespace PCGExDataBlending
 		return InUnionData->ComputeWeights(SourcesData, IOLookup, Target, DistanceDetails, OutWeightedPoints);
 	}
 
+	int32 FUnionOpsManager::ComputeWeights(const int32 WriteIndex, const TConstArrayView<PCGExData::FElement> InElements, TArray<PCGExData::FWeightedPoint>& OutWeightedPoints) const
+	{
+		const PCGExData::FConstPoint Target = CurrentTargetData->Source->GetOutPoint(WriteIndex);
+		return PCGExData::ComputeUnionWeights(InElements, SourcesData, IOLookup, Target, DistanceDetails, OutWeightedPoints);
+	}
+
 	void FUnionOpsManager::Blend(const int32 WriteIndex, const TArray<PCGExData::FWeightedPoint>& InWeightedPoints, TArray<PCGEx::FOpStats>& Trackers) const
 	{
 		check(!Blenders.IsEmpty())
@@ -89,10 +95,15 @@ namespace PCGExDataBlending
 		Blend(WriteIndex, OutWeightedPoints, Trackers);
 	}
 
+	void FUnionOpsManager::MergeSingle(const int32 WriteIndex, const TConstArrayView<PCGExData::FElement> InElements, TArray<PCGExData::FWeightedPoint>& OutWeightedPoints, TArray<PCGEx::FOpStats>& Trackers) const
+	{
+		if (!ComputeWeights(WriteIndex, InElements, OutWeightedPoints)) { return; }
+		Blend(WriteIndex, OutWeightedPoints, Trackers);
+	}
+
 	void FUnionOpsManager::MergeSingle(const int32 UnionIndex, TArray<PCGExData::FWeightedPoint>& OutWeightedPoints, TArray<PCGEx::FOpStats>& Trackers) const
 	{
-		if (!ComputeWeights(UnionIndex, CurrentUnionMetadata->Get(UnionIndex), OutWeightedPoints)) { return; }
-		Blend(UnionIndex, OutWeightedPoints, Trackers);
+		MergeSingle(UnionIndex, CurrentUnionMetadata->GetElements(UnionIndex), OutWeightedPoints, Trackers);
 	}
 
 	void FUnionOpsManager::Cleanup(FPCGExContext* InContext)
@@ -7,6 +7,7 @@
 #include "PCGExGlobalSettings.h"
 #include "PCGExH.h"
 #include "PCGExHelpers.h"
+#include "PCGExTelemetry.h"
 #include "Data/PCGExAttributeHelpers.h"
 #include "Data/PCGExDataHelpers.h"
 #include "Data/PCGExDataTag.h"
@@ -46,6 +47,53 @@ namespace PCGExData
 		return Identifier;
 	}
 
+	namespace SharedReadables
+	{
+		struct FEntry
+		{
+			TWeakObjectPtr<const UPCGBasePointData> Data;
+			TWeakPtr<void> Values;
+		};
+
+		FRWLock EntriesLock;
+		TMap<TTuple<const UPCGBasePointData*, uint64>, FEntry> Entries;
+		int32 AddsSinceSweep = 0;
+
+		bool IsEnabled() { return GetDefault<UPCGExGlobalSettings>()->bShareReadableBuffers; }
+
+		TSharedPtr<void> Find(const UPCGBasePointData* InData, const uint64 InBufferUID)
+		{
+			FReadScopeLock ReadScopeLock(EntriesLock);
+			const FEntry* Entry = Entries.Find(MakeTuple(InData, InBufferUID));
+			return Entry && Entry->Data.Get() == InData ? Entry->Values.Pin() : nullptr;
+		}
+
+		TSharedPtr<void> FindOrAdd(const UPCGBasePointData* InData, const uint64 InBufferUID, const TSharedPtr<void>& InValues)
+		{
+			FWriteScopeLock WriteScopeLock(EntriesLock);
+
+			FEntry& Entry = Entries.FindOrAdd(MakeTuple(InData, InBufferUID));
+			if (Entry.Data.Get() == InData)
+			{
+				if (TSharedPtr<void> Existing = Entry.Values.Pin()) { return Existing; }
+			}
+
+			Entry.Data = InData;
+			Entry.Values = InValues;
+
+			if (++AddsSinceSweep >= 256)
+			{
+				AddsSinceSweep = 0;
+				for (auto It = Entries.CreateIterator(); It; ++It)
+				{
+					if (!It->Value.Data.IsValid() || !It->Value.Values.IsValid()) { It.RemoveCurrent(); }
+				}
+			}
+
+			return InValues;
+		}
+	}
+
 	IBuffer::IBuffer(const TSharedRef<FPointIO>& InSource, const FPCGAttributeIdentifier& InIdentifier)
 		: Identifier(InIdentifier), Source(InSource)
 	{
@@ -70,6 +118,12 @@ template PCGEXTENDEDTOOLKIT_API bool IBuffer::IsA<_TYPE>() const;
 		UID = BufferUID(Identifier, InType);
 	}
 
+	void IBuffer::TrackAllocation(const SIZE_T InBytes) const
+	{
+		if (!PCGExTelemetry::IsEnabled()) { return; }
+		if (const FPCGExContext* Context = Source->GetContext(); Context && Context->Telemetry) { Context->Telemetry->AddBuffer(InBytes); }
+	}
+
 	template <typename T>
 	TBuffer<T>::TBuffer(const TSharedRef<FPointIO>& InSource, const FPCGAttributeIdentifier& InIdentifier)
 		: IBuffer(InSource, InIdentifier)
@@ -89,6 +143,12 @@ template PCGEXTENDEDTOOLKIT_API bool IBuffer::IsA<_TYPE>() const;
 	template <typename T>
 	uint32 TBuffer<T>::GetValueHash(const int32 Index) { return PCGExBlend::ValueHash(GetValue(Index)); }
 
+	template <typename T>
+	void TBuffer<T>::ReadRange(const int32 Start, TArrayView<T> OutValues) const { for (int i = 0; i < OutValues.Num(); i++) { OutValues[i] = Read(Start + i); } }
+
+	template <typename T>
+	void TBuffer<T>::SetRange(const int32 Start, TConstArrayView<T> InValues) { for (int i = 0; i < InValues.Num(); i++) { SetValue(Start + i, InValues[i]); } }
+
 	template <typename T>
 	void TBuffer<T>::DumpValues(TArray<T>& OutValues) const { for (int i = 0; i < OutValues.Num(); i++) { OutValues[i] = Read(i); } }
 
@@ -131,12 +191,26 @@ template PCGEXTENDEDTOOLKIT_API bool IBuffer::IsA<_TYPE>() const;
 	template <typename T>
 	const T& TArrayBuffer<T>::Read(const int32 Index) const { return *(InValues->GetData() + Index); }
 
+	template <typename T>
+	void TArrayBuffer<T>::ReadRange(const int32 Start, TArrayView<T> OutValues) const
+	{
+		const T* RESTRICT Values = InValues->GetData() + Start;
+		for (int i = 0; i < OutValues.Num(); i++) { OutValues[i] = Values[i]; }
+	}
+
 	template <typename T>
 	const T& TArrayBuffer<T>::GetValue(const int32 Index) { return *(OutValues->GetData() + Index); }
 
 	template <typename T>
 	void TArrayBuffer<T>::SetValue(const int32 Index, const T& Value) { *(OutValues->GetData() + Index) = Value; }
 
+	template <typename T>
+	void TArrayBuffer<T>::SetRange(const int32 Start, TConstArrayView<T> InValues)
+	{
+		T* RESTRICT Values = OutValues->GetData() + Start;
+		for (int i = 0; i < InValues.Num(); i++) { Values[i] = InValues[i]; }
+	}
+
 	template <typename T>
 	void TArrayBuffer<T>::InitForReadInternal(const bool bScoped, const FPCGMetadataAttributeBase* Attribute)
 	{
@@ -144,6 +218,7 @@ template PCGEXTENDEDTOOLKIT_API bool IBuffer::IsA<_TYPE>() const;
 
 		InValues = MakeShared<TArray<T>>();
 		PCGEx::InitArray(InValues, Source->GetIn()->GetNumPoints());
+		this->TrackAllocation(InValues->GetAllocatedSize());
 
 		InAttribute = Attribute;
 		TypedInAttribute = Attribute ? static_cast<const FPCGMetadataAttribute<T>*>(Attribute) : nullptr;
@@ -151,6 +226,31 @@ template PCGEXTENDEDTOOLKIT_API bool IBuffer::IsA<_TYPE>() const;
 		bSparseBuffer = bScoped;
 	}
 
+	template <typename T>
+	bool TArrayBuffer<T>::TryShareReadValues(const bool bRegister)
+	{
+		if (!SharedReadables::IsEnabled()) { return false; }
+
+		const UPCGBasePointData* InData = Source->GetIn();
+
+		if (bRegister)
+		{
+			// Swap our values for the ones already shared, if any, so only one copy remains
+			if (InValues && !OutValues) { InValues = StaticCastSharedPtr<TArray<T>>(SharedReadables::FindOrAdd(InData, this->UID, InValues)); }
+			return true;
+		}
+
+		const TSharedPtr<TArray<T>> SharedValues = StaticCastSharedPtr<TArray<T>>(SharedReadables::Find(InData, this->UID));
+		if (!SharedValues || SharedValues->Num() != InData->GetNumPoints()) { return false; }
+
+		InValues = SharedValues;
+		InAttribute = TypedInAttribute;
+		bSparseBuffer = false;
+		bReadComplete = true;
+
+		return true;
+	}
+
 	template <typename T>
 	void TArrayBuffer<T>::InitForWriteInternal(FPCGMetadataAttributeBase* Attribute, const T& InDefaultValue, const EBufferInit Init)
 	{
@@ -158,6 +258,7 @@ template PCGEXTENDEDTOOLKIT_API bool IBuffer::IsA<_TYPE>() const;
 
 		OutValues = MakeShared<TArray<T>>();
 		OutValues->Init(InDefaultValue, Source->GetOut()->GetNumPoints());
+		this->TrackAllocation(OutValues->GetAllocatedSize());
 
 		OutAttribute = Attribute;
 		TypedOutAttribute = Attribute ? static_cast<FPCGMetadataAttribute<T>*>(Attribute) : nullptr;
@@ -184,6 +285,7 @@ template PCGEXTENDEDTOOLKIT_API bool IBuffer::IsA<_TYPE>() const;
 				Fetch(PCGExMT::FScope(0, InValues->Num()));
 				bReadComplete = true;
 				bSparseBuffer = false;
+				if (!InternalBroadcaster) { TryShareReadValues(true); }
 			}
 
 			if (InSide == EIOSide::In && OutValues && InValues == OutValues)
@@ -225,6 +327,9 @@ template PCGEXTENDEDTOOLKIT_API bool IBuffer::IsA<_TYPE>() const;
 			return false;
 		}
 
+		// Alias values another buffer already read from that same data
+		if (!OutValues && TryShareReadValues(false)) { return true; }
+
 		InitForReadInternal(bScoped, TypedInAttribute);
 
 		if (!bSparseBuffer && !bReadComplete)
@@ -232,6 +337,7 @@ template PCGEXTENDEDTOOLKIT_API bool IBuffer::IsA<_TYPE>() const;
 			TArrayView<T> InRange = MakeArrayView(InValues->GetData(), InValues->Num());
 			InAccessor->GetRange<T>(InRange, 0, *Source->GetInKeys());
 			bReadComplete = true;
+			TryShareReadValues(true);
 		}
 
 		return true;
@@ -64,6 +64,11 @@ namespace PCGExPointFilter
 
 	bool IFilter::Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const { return bCollectionTestResult; }
 
+	void IFilter::TestScope(const PCGExMT::FScope& Scope, TArrayView<int8> OutResults) const
+	{
+		for (int i = 0; i < Scope.Count; i++) { if (OutResults[i]) { OutResults[i] = Test(Scope.Start + i); } }
+	}
+
 	bool ISimpleFilter::Test(const int32 Index) const
 	PCGEX_NOT_IMPLEMENTED_RET(FSimpleFilter::Test(const PCGExCluster::FNode& Node), false)
 
@@ -161,22 +166,14 @@ namespace PCGExPointFilter
 
 	int32 FManager::Test(const PCGExMT::FScope Scope, TArray<int8>& OutResults)
 	{
-		bool bResult = true;
+		// Filters run one after the other over the whole scope, each one only clearing the entries it fails (masked AND)
+		const TArrayView<int8> ScopeResults = Scope.GetView(OutResults);
+		FMemory::Memset(ScopeResults.GetData(), 1, Scope.Count);
+
+		for (const TSharedPtr<IFilter>& Handler : ManagedFilters) { Handler->TestScope(Scope, ScopeResults); }
+
 		int32 NumPass = 0;
-		PCGEX_SCOPE_LOOP(Index)
-		{
-			bResult = true;
-			for (const TSharedPtr<IFilter>& Handler : ManagedFilters)
-			{
-				if (!Handler->Test(Index))
-				{
-					bResult = false;
-					break;
-				}
-			}
-			OutResults[Index] = bResult;
-			NumPass += bResult;
-		}
+		for (const int8 Result : ScopeResults) { NumPass += Result; }
 
 		return NumPass;
 	}
@@ -129,6 +129,18 @@ namespace PCGExData
 	template <typename T_WORKING>
 	TBufferProxy<T_WORKING>::TBufferProxy() : IBufferProxy() { WorkingType = PCGEx::GetMetadataType<T_WORKING>(); }
 
+	template <typename T_WORKING>
+	void TBufferProxy<T_WORKING>::GetRange(const PCGExMT::FScope& Scope, TArrayView<T_WORKING> OutValues) const
+	{
+		for (int i = 0; i < Scope.Count; i++) { OutValues[i] = Get(Scope.Start + i); }
+	}
+
+	template <typename T_WORKING>
+	void TBufferProxy<T_WORKING>::SetRange(const PCGExMT::FScope& Scope, TConstArrayView<T_WORKING> InValues) const
+	{
+		for (int i = 0; i < Scope.Count; i++) { Set(Scope.Start + i, InValues[i]); }
+	}
+
 	template <typename T_REAL, typename T_WORKING, bool bSubSelection>
 	TAttributeBufferProxy<T_REAL, T_WORKING, bSubSelection>::TAttributeBufferProxy()
 		: TBufferProxy<T_WORKING>()
@@ -180,6 +192,59 @@ namespace PCGExData
 		else { return SubSelection.template Get<T_REAL, T_WORKING>(Buffer->GetValue(Index)); }
 	}
 
+	template <typename T_REAL, typename T_WORKING, bool bSubSelection>
+	void TAttributeBufferProxy<T_REAL, T_WORKING, bSubSelection>::GetRange(const PCGExMT::FScope& Scope, TArrayView<T_WORKING> OutValues) const
+	{
+		if constexpr (!bSubSelection && std::is_same_v<T_REAL, T_WORKING>)
+		{
+			Buffer->ReadRange(Scope.Start, OutValues.Slice(0, Scope.Count));
+		}
+		else
+		{
+			T_REAL Chunk[ProxyRangeChunkSize];
+			for (int32 Offset = 0; Offset < Scope.Count; Offset += ProxyRangeChunkSize)
+			{
+				const int32 Num = FMath::Min(ProxyRangeChunkSize, Scope.Count - Offset);
+				Buffer->ReadRange(Scope.Start + Offset, MakeArrayView(Chunk, Num));
+
+				if constexpr (!bSubSelection) { for (int i = 0; i < Num; i++) { OutValues[Offset + i] = PCGEx::Convert<T_REAL, T_WORKING>(Chunk[i]); } }
+				else { for (int i = 0; i < Num; i++) { OutValues[Offset + i] = SubSelection.template Get<T_REAL, T_WORKING>(Chunk[i]); } }
+			}
+		}
+	}
+
+	template <typename T_REAL, typename T_WORKING, bool bSubSelection>
+	void TAttributeBufferProxy<T_REAL, T_WORKING, bSubSelection>::SetRange(const PCGExMT::FScope& Scope, TConstArrayView<T_WORKING> InValues) const
+	{
+		if constexpr (!bSubSelection)
+		{
+			if constexpr (std::is_same_v<T_REAL, T_WORKING>)
+			{
+				Buffer->SetRange(Scope.Start, InValues.Slice(0, Scope.Count));
+			}
+			else
+			{
+				T_REAL Chunk[ProxyRangeChunkSize];
+				for (int32 Offset = 0; Offset < Scope.Count; Offset += ProxyRangeChunkSize)
+				{
+					const int32 Num = FMath::Min(ProxyRangeChunkSize, Scope.Count - Offset);
+					for (int i = 0; i < Num; i++) { Chunk[i] = PCGEx::Convert<T_WORKING, T_REAL>(InValues[Offset + i]); }
+					Buffer->SetRange(Scope.Start + Offset, MakeArrayView(Chunk, Num));
+				}
+			}
+		}
+		else
+		{
+			for (int i = 0; i < Scope.Count; i++)
+			{
+				const int32 Index = Scope.Start + i;
+				T_REAL V = Buffer->GetValue(Index);
+				SubSelection.template Set<T_REAL, T_WORKING>(V, InValues[i]);
+				Buffer->SetValue(Index, V);
+			}
+		}
+	}
+
 	template <typename T_REAL, typename T_WORKING, bool bSubSelection>
 	TSharedPtr<IBuffer> TAttributeBufferProxy<T_REAL, T_WORKING, bSubSelection>::GetBuffer() const { return Buffer; }
 
@@ -240,6 +305,62 @@ else{ return PCGEx::Convert<T_REAL, T_WORKING>(Data->_ACCESSOR); }\
 		}
 	}
 
+	template <typename T_REAL, typename T_WORKING, bool bSubSelection, EPCGPointProperties PROPERTY>
+	void TPointPropertyProxy<T_REAL, T_WORKING, bSubSelection, PROPERTY>::GetRange(const PCGExMT::FScope& Scope, TArrayView<T_WORKING> OutValues) const
+	{
+#define PCGEX_GET_RANGE(_RANGE, _ACCESSOR) \
+const auto Range = Data->_RANGE(); \
+for (int i = 0; i < Scope.Count; i++) { \
+if constexpr (!bSubSelection){ \
+if constexpr (std::is_same_v<T_REAL, T_WORKING>) { OutValues[i] = Range[Scope.Start + i]_ACCESSOR; }\
+else{ OutValues[i] = PCGEx::Convert<T_REAL, T_WORKING>(Range[Scope.Start + i]_ACCESSOR); }\
+}else{ OutValues[i] = SubSelection.template Get<T_REAL, T_WORKING>(Range[Scope.Start + i]_ACCESSOR); } }
+
+		if constexpr (PROPERTY == EPCGPointProperties::Density) { PCGEX_GET_RANGE(GetConstDensityValueRange,) }
+		else if constexpr (PROPERTY == EPCGPointProperties::BoundsMin) { PCGEX_GET_RANGE(GetConstBoundsMinValueRange,) }
+		else if constexpr (PROPERTY == EPCGPointProperties::BoundsMax) { PCGEX_GET_RANGE(GetConstBoundsMaxValueRange,) }
+		else if constexpr (PROPERTY == EPCGPointProperties::Color) { PCGEX_GET_RANGE(GetConstColorValueRange,) }
+		else if constexpr (PROPERTY == EPCGPointProperties::Position) { PCGEX_GET_RANGE(GetConstTransformValueRange, .GetLocation()) }
+		else if constexpr (PROPERTY == EPCGPointProperties::Rotation) { PCGEX_GET_RANGE(GetConstTransformValueRange, .GetRotation()) }
+		else if constexpr (PROPERTY == EPCGPointProperties::Scale) { PCGEX_GET_RANGE(GetConstTransformValueRange, .GetScale3D()) }
+		else if constexpr (PROPERTY == EPCGPointProperties::Transform) { PCGEX_GET_RANGE(GetConstTransformValueRange,) }
+		else if constexpr (PROPERTY == EPCGPointProperties::Steepness) { PCGEX_GET_RANGE(GetConstSteepnessValueRange,) }
+		else if constexpr (PROPERTY == EPCGPointProperties::Seed) { PCGEX_GET_RANGE(GetConstSeedValueRange,) }
+		else
+		{
+			// Computed properties (extents, local center & sizes) have no backing range
+			TBufferProxy<T_WORKING>::GetRange(Scope, OutValues);
+		}
+
+#undef PCGEX_GET_RANGE
+	}
+
+	template <typename T_REAL, typename T_WORKING, bool bSubSelection, EPCGPointProperties PROPERTY>
+	void TPointPropertyProxy<T_REAL, T_WORKING, bSubSelection, PROPERTY>::SetRange(const PCGExMT::FScope& Scope, TConstArrayView<T_WORKING> InValues) const
+	{
+#define PCGEX_SET_RANGE(_RANGE, _GET, _SET) \
+auto Range = Data->_RANGE(); \
+for (int i = 0; i < Scope.Count; i++) { \
+const int32 Index = Scope.Start + i; \
+if constexpr (!bSubSelection){ \
+if constexpr (std::is_same_v<T_REAL, T_WORKING>) { Range[Index]_SET(InValues[i]); }\
+else{ Range[Index]_SET(PCGEx::Convert<T_WORKING, T_REAL>(InValues[i])); }\
+}else{ T_REAL V = Range[Index]_GET; SubSelection.template Set<T_REAL, T_WORKING>(V, InValues[i]); Range[Index]_SET(V); } }
+
+		if constexpr (PROPERTY == EPCGPointProperties::Density) { PCGEX_SET_RANGE(GetDensityValueRange, , =) }
+		else if constexpr (PROPERTY == EPCGPointProperties::BoundsMin) { PCGEX_SET_RANGE(GetBoundsMinValueRange, , =) }
+		else if constexpr (PROPERTY == EPCGPointProperties::BoundsMax) { PCGEX_SET_RANGE(GetBoundsMaxValueRange, , =) }
+		else if constexpr (PROPERTY == EPCGPointProperties::Color) { PCGEX_SET_RANGE(GetColorValueRange, , =) }
+		else if constexpr (PROPERTY == EPCGPointProperties::Position) { PCGEX_SET_RANGE(GetTransformValueRange, .GetLocation(), .SetLocation) }
+		else if constexpr (PROPERTY == EPCGPointProperties::Rotation) { PCGEX_SET_RANGE(GetTransformValueRange, .GetRotation(), .SetRotation) }
+		else if constexpr (PROPERTY == EPCGPointProperties::Scale) { PCGEX_SET_RANGE(GetTransformValueRange, .GetScale3D(), .SetScale3D) }
+		else if constexpr (PROPERTY == EPCGPointProperties::Transform) { PCGEX_SET_RANGE(GetTransformValueRange, , =) }
+		else if constexpr (PROPERTY == EPCGPointProperties::Steepness) { PCGEX_SET_RANGE(GetSteepnessValueRange, , =) }
+		else if constexpr (PROPERTY == EPCGPointProperties::Seed) { PCGEX_SET_RANGE(GetSeedValueRange, , =) }
+
+#undef PCGEX_SET_RANGE
+	}
+
 	template <typename T_REAL, typename T_WORKING, bool bSubSelection, EPCGExtraProperties PROPERTY>
 	TPointExtraPropertyProxy<T_REAL, T_WORKING, bSubSelection, PROPERTY>::TPointExtraPropertyProxy()
 		: TBufferProxy<T_WORKING>()
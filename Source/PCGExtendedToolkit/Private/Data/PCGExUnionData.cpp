@@ -3,6 +3,7 @@
 
 #include "Data/PCGExUnionData.h"
 
+#include "Async/ParallelFor.h"
 #include "PCGExPointsMT.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExPointIO.h"
@@ -12,46 +13,22 @@ namespace PCGExData
 {
 #pragma region Union Data
 
-	void IUnionData::Add(const FElement& Point)
-	{
-		FWriteScopeLock WriteScopeLock(UnionLock);
-		Add_Unsafe(Point.Index, Point.IO);
-	}
-
-	void IUnionData::Add(const int32 Index, const int32 IO)
-	{
-		FWriteScopeLock WriteScopeLock(UnionLock);
-		Add_Unsafe(Index, IO);
-	}
-
-	void IUnionData::Add_Unsafe(const int32 IOIndex, const TArray<int32>& PointIndices)
-	{
-		IOSet.Add(IOIndex);
-		Elements.Reserve(Elements.Num() + PointIndices.Num());
-		for (const int32 A : PointIndices) { Elements.Add(FElement(A, IOIndex)); }
-	}
-
-	void IUnionData::Add(const int32 IOIndex, const TArray<int32>& PointIndices)
-	{
-		FWriteScopeLock WriteScopeLock(UnionLock);
-		Add_Unsafe(IOIndex, PointIndices);
-	}
-
-	int32 IUnionData::ComputeWeights(
+	int32 ComputeUnionWeights(
+		const TConstArrayView<FElement> InElements,
 		const TArray<const UPCGBasePointData*>& Sources,
 		const TSharedPtr<PCGEx::FIndexLookup>& IdxLookup,
 		const FPoint& Target,
 		const TSharedPtr<PCGExDetails::FDistances>& InDistanceDetails,
-		TArray<FWeightedPoint>& OutWeightedPoints) const
+		TArray<FWeightedPoint>& OutWeightedPoints)
 	{
-		const int32 NumElements = Elements.Num();
+		const int32 NumElements = InElements.Num();
 		OutWeightedPoints.Reset(NumElements);
 
 		double MaxWeight = 0;
 		double TotalWeight = 0;
 		int32 Index = 0;
 
-		for (const FElement& Element : Elements)
+		for (const FElement& Element : InElements)
 		{
 			const int32 IOIdx = IdxLookup->Get(Element.IO);
 			if (IOIdx == -1) { continue; }
@@ -87,9 +64,46 @@ namespace PCGExData
 		return Index;
 	}
 
+	void IUnionData::Add(const FElement& Point)
+	{
+		FWriteScopeLock WriteScopeLock(UnionLock);
+		Add_Unsafe(Point.Index, Point.IO);
+	}
+
+	void IUnionData::Add(const int32 Index, const int32 IO)
+	{
+		FWriteScopeLock WriteScopeLock(UnionLock);
+		Add_Unsafe(Index, IO);
+	}
+
+	void IUnionData::Add_Unsafe(const int32 IOIndex, const TArray<int32>& PointIndices)
+	{
+		IOSet.Add(IOIndex);
+		Elements.Reserve(Elements.Num() + PointIndices.Num());
+		for (const int32 A : PointIndices) { Elements.Add(FElement(A, IOIndex)); }
+	}
+
+	void IUnionData::Add(const int32 IOIndex, const TArray<int32>& PointIndices)
+	{
+		FWriteScopeLock WriteScopeLock(UnionLock);
+		Add_Unsafe(IOIndex, PointIndices);
+	}
+
+	int32 IUnionData::ComputeWeights(
+		const TArray<const UPCGBasePointData*>& Sources,
+		const TSharedPtr<PCGEx::FIndexLookup>& IdxLookup,
+		const FPoint& Target,
+		const TSharedPtr<PCGExDetails::FDistances>& InDistanceDetails,
+		TArray<FWeightedPoint>& OutWeightedPoints) const
+	{
+		return ComputeUnionWeights(Elements, Sources, IdxLookup, Target, InDistanceDetails, OutWeightedPoints);
+	}
+
 	void FUnionMetadata::SetNum(const int32 InNum)
 	{
 		// To be used only with NewEntryAt / NewEntryAt_Unsafe
+		Offsets.Empty();
+		FlatElements.Empty();
 		Entries.Init(nullptr, InNum);
 	}
 
@@ -106,10 +120,46 @@ namespace PCGExData
 		return Entries[ItemIndex];
 	}
 
-	bool FUnionMetadata::IOIndexOverlap(const int32 InIdx, const TSet<int32>& InIndices)
+	void FUnionMetadata::BuildFlat(const int32 InNumEntries, const TArray<TConstArrayView<FUnionElement>>& InChunks)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FUnionMetadata::BuildFlat);
+
+		Entries.Empty();
+
+		// Entries don't span chunks, so each chunk only ever touches its own counters & cursors
+		Offsets.Reset(InNumEntries + 1);
+		Offsets.SetNumZeroed(InNumEntries + 1);
+
+		ParallelFor(
+			InChunks.Num(), [&](const int32 ChunkIndex)
+			{
+				for (const FUnionElement& E : InChunks[ChunkIndex]) { Offsets[E.Entry + 1]++; }
+			});
+
+		for (int i = 0; i < InNumEntries; i++) { Offsets[i + 1] += Offsets[i]; }
+
+		FlatElements.Reset(Offsets.Last());
+		FlatElements.SetNumUninitialized(Offsets.Last());
+
+		TArray<int32> Cursors(Offsets.GetData(), InNumEntries);
+
+		ParallelFor(
+			InChunks.Num(), [&](const int32 ChunkIndex)
+			{
+				for (const FUnionElement& E : InChunks[ChunkIndex]) { FlatElements[Cursors[E.Entry]++] = E.Element; }
+			});
+	}
+
+	void FUnionMetadata::GetIOSet(const int32 Index, TSet<int32>& OutIOSet) const
+	{
+		OutIOSet.Reset();
+		for (const FElement& E : GetElements(Index)) { OutIOSet.Add(E.IO); }
+	}
+
+	bool FUnionMetadata::IOIndexOverlap(const int32 InIdx, const TSet<int32>& InIndices) const
 	{
-		const TSet<int32> Overlap = Entries[InIdx]->IOSet.Intersect(InIndices);
-		return Overlap.Num() > 0;
+		for (const FElement& E : GetElements(InIdx)) { if (InIndices.Contains(E.IO)) { return true; } }
+		return false;
 	}
 
 	TSharedPtr<FFacade> TryGetSingleFacade(FPCGExContext* InContext, const FName InputPinLabel, const bool bTransactional, const bool bRequired)
@@ -36,6 +36,9 @@ namespace PCGExDetails
 	template <typename T>
 	T TSettingValueBuffer<T>::Read(const int32 Index) { return Buffer->Read(Index); }
 
+	template <typename T>
+	void TSettingValueBuffer<T>::ReadRange(const int32 Start, TArrayView<T> OutValues) { Buffer->ReadRange(Start, OutValues); }
+
 	template <typename T>
 	T TSettingValueBuffer<T>::Min() { return Buffer->Min; }
 
@@ -66,6 +69,9 @@ namespace PCGExDetails
 	template <typename T>
 	T TSettingValueSelector<T>::Read(const int32 Index) { return Buffer->Read(Index); }
 
+	template <typename T>
+	void TSettingValueSelector<T>::ReadRange(const int32 Start, TArrayView<T> OutValues) { Buffer->ReadRange(Start, OutValues); }
+
 	template <typename T>
 	T TSettingValueSelector<T>::Min() { return Buffer->Min; }
 
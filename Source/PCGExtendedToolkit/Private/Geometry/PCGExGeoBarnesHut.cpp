@@ -0,0 +1,100 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Geometry/PCGExGeoBarnesHut.h"
+
+namespace PCGExGeo
+{
+	void FBarnesHutTree::Build(const TArray<FVector>& InPositions)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FBarnesHutTree::Build);
+
+		const int32 NumItems = InPositions.Num();
+
+		Nodes.Reset();
+		Positions.Reset();
+		Items.Reset();
+
+		if (!NumItems) { return; }
+
+		Items.SetNumUninitialized(NumItems);
+		Scratch.SetNumUninitialized(NumItems);
+		for (int i = 0; i < NumItems; i++) { Items[i] = i; }
+
+		FBox Bounds = FBox(ForceInit);
+		for (const FVector& P : InPositions) { Bounds += P; }
+
+		// Cubic cells keep the opening criterion isotropic
+		const FVector Center = Bounds.GetCenter();
+		const double Extent = FMath::Max(Bounds.GetExtent().GetMax(), UE_KINDA_SMALL_NUMBER) * (1 + UE_KINDA_SMALL_NUMBER);
+
+		Nodes.Reserve(2 * FMath::DivideAndRoundUp(NumItems, LeafSize));
+		Nodes.Emplace();
+		BuildNode(InPositions, 0, Center, Extent, 0, NumItems, 0);
+
+		// Store positions leaf-contiguous for cache-friendly leaf scans
+		Positions.SetNumUninitialized(NumItems);
+		for (int i = 0; i < NumItems; i++) { Positions[i] = InPositions[Items[i]]; }
+	}
+
+	void FBarnesHutTree::BuildNode(const TArray<FVector>& InPositions, const int32 NodeIndex, const FVector& Center, const double Extent, const int32 Start, const int32 Count, const int32 Depth)
+	{
+		FVector CenterOfMass = FVector::ZeroVector;
+		for (int i = Start; i < Start + Count; i++) { CenterOfMass += InPositions[Items[i]]; }
+
+		{
+			FNode& Node = Nodes[NodeIndex];
+			Node.CenterOfMass = CenterOfMass / Count;
+			Node.Center = Center;
+			Node.Extent = Extent;
+			Node.Start = Start;
+			Node.Count = Count;
+		}
+
+		if (Count <= LeafSize || Depth >= MaxDepth) { return; }
+
+		// Counting sort of items into octants
+
+		auto GetOctant = [&](const FVector& P)
+		{
+			return (P.X >= Center.X ? 1 : 0) | (P.Y >= Center.Y ? 2 : 0) | (P.Z >= Center.Z ? 4 : 0);
+		};
+
+		int32 OctantStarts[9] = {0};
+		for (int i = Start; i < Start + Count; i++) { OctantStarts[GetOctant(InPositions[Items[i]]) + 1]++; }
+		for (int o = 0; o < 8; o++) { OctantStarts[o + 1] += OctantStarts[o]; }
+
+		int32 Cursors[8];
+		for (int o = 0; o < 8; o++) { Cursors[o] = Start + OctantStarts[o]; }
+		for (int i = Start; i < Start + Count; i++) { Scratch[Cursors[GetOctant(InPositions[Items[i]])]++] = Items[i]; }
+		FMemory::Memcpy(Items.GetData() + Start, Scratch.GetData() + Start, Count * sizeof(int32));
+
+		// Children of a node are stored contiguously, empty octants are skipped
+
+		int32 NumChildren = 0;
+		for (int o = 0; o < 8; o++) { if (OctantStarts[o + 1] > OctantStarts[o]) { NumChildren++; } }
+
+		const int32 FirstChild = Nodes.Num();
+		Nodes.AddDefaulted(NumChildren);
+
+		// Nodes may have been reallocated
+		Nodes[NodeIndex].FirstChild = FirstChild;
+		Nodes[NodeIndex].NumChildren = NumChildren;
+
+		const double ChildExtent = Extent * 0.5;
+		int32 ChildIndex = FirstChild;
+
+		for (int o = 0; o < 8; o++)
+		{
+			const int32 ChildCount = OctantStarts[o + 1] - OctantStarts[o];
+			if (!ChildCount) { continue; }
+
+			const FVector ChildCenter = Center + FVector(
+				o & 1 ? ChildExtent : -ChildExtent,
+				o & 2 ? ChildExtent : -ChildExtent,
+				o & 4 ? ChildExtent : -ChildExtent);
+
+			BuildNode(InPositions, ChildIndex++, ChildCenter, ChildExtent, Start + OctantStarts[o], ChildCount, Depth + 1);
+		}
+	}
+}
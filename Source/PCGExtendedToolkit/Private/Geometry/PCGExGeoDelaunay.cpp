@@ -225,6 +225,537 @@ namespace PCGExGeo
 		VisitedSites[SiteIndex] = true;
 	}
 
+	namespace WarmDelaunay
+	{
+		FORCEINLINE static int32 NextEdge(const int32 Edge) { return Edge % 3 == 2 ? Edge - 2 : Edge + 1; }
+		FORCEINLINE static int32 PrevEdge(const int32 Edge) { return Edge % 3 == 0 ? Edge + 2 : Edge - 1; }
+
+		// Positive for triangles wound the way delaunator outputs them
+		FORCEINLINE static double Orient(const std::vector<double>& Coords, const int32 A, const int32 B, const int32 C)
+		{
+			return (Coords[2 * B + 1] - Coords[2 * A + 1]) * (Coords[2 * C] - Coords[2 * B]) -
+				(Coords[2 * B] - Coords[2 * A]) * (Coords[2 * C + 1] - Coords[2 * B + 1]);
+		}
+	}
+
+	void FWarmDelaunay2::Reset()
+	{
+		Triangles.Reset();
+
+		Mesh.Reset();
+		HalfEdges.Reset();
+		VtxEdge.Reset();
+		FreeSlots.Reset();
+		NewSlots.Reset();
+		PendingEdges.Reset();
+		RemovalHints.Reset();
+
+		NumPoints = 0;
+		Ghost = -1;
+	}
+
+	bool FWarmDelaunay2::Update(const TArrayView<FVector>& Positions, const FPCGExGeo2DProjectionDetails& ProjectionDetails)
+	{
+		const int32 NumPositions = Positions.Num();
+
+		if (NumPositions <= 2)
+		{
+			Reset();
+			return false;
+		}
+
+		Coords.swap(PrevCoords);
+		Coords.resize(NumPositions * 2);
+		ProjectionDetails.Project(Positions, Coords);
+
+		bool bRepaired = false;
+		if (NumPositions == NumPoints && !Mesh.IsEmpty())
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(FWarmDelaunay2::Repair);
+			bRepaired = Repair();
+		}
+
+		if (!bRepaired)
+		{
+			NumPoints = NumPositions;
+			if (!Triangulate())
+			{
+				Reset();
+				return false;
+			}
+		}
+
+		Triangles.Reset(Mesh.Num());
+		for (int t = 0; t < Mesh.Num(); t += 3)
+		{
+			if (Mesh[t] == -1 || IsGhost(t)) { continue; }
+			Triangles.Append(&Mesh[t], 3);
+		}
+
+		return true;
+	}
+
+	bool FWarmDelaunay2::Triangulate()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FWarmDelaunay2::Triangulate);
+
+		Mesh.Reset();
+		HalfEdges.Reset();
+		FreeSlots.Reset();
+
+		delaunator::Delaunator d(Coords);
+
+		if (d.runtime_error || d.triangles.empty()) { return false; }
+
+		const int32 NumHalfEdges = d.triangles.size();
+
+		Ghost = NumPoints;
+		VtxEdge.Init(-1, NumPoints + 1);
+
+		Mesh.SetNumUninitialized(NumHalfEdges);
+		HalfEdges.SetNumUninitialized(NumHalfEdges);
+
+		for (int e = 0; e < NumHalfEdges; e++)
+		{
+			Mesh[e] = d.triangles[e];
+			HalfEdges[e] = d.halfedges[e] == delaunator::INVALID_INDEX ? -1 : static_cast<int32>(d.halfedges[e]);
+			VtxEdge[Mesh[e]] = e;
+		}
+
+		// Close the mesh with a ghost triangle on every hull edge
+		TArray<int32> HullGhosts;
+		HullGhosts.Init(-1, NumPoints);
+
+		for (int e = 0; e < NumHalfEdges; e++)
+		{
+			if (HalfEdges[e] != -1) { continue; }
+
+			const int32 A = Mesh[WarmDelaunay::NextEdge(e)];
+			const int32 Tri = AllocTriangle();
+			SetTriangle(Tri, A, Mesh[e], Ghost);
+			Link(Tri, e);
+			HullGhosts[A] = Tri;
+		}
+
+		for (int t = NumHalfEdges; t < Mesh.Num(); t += 3)
+		{
+			const int32 NextGhost = HullGhosts[Mesh[t + 1]];
+			if (NextGhost == -1) { return false; }
+			Link(t + 1, NextGhost + 2);
+		}
+
+		NewSlots.Reset();
+		return true;
+	}
+
+	bool FWarmDelaunay2::Repair()
+	{
+		FlipBudget = Mesh.Num() * 4 + 1024;
+		RemovalHints.SetNumUninitialized(NumPoints);
+
+		// Vertices of folded triangles are taken out using their previous positions, for which the mesh is still valid;
+		// this may fold some of the triangles filling the holes they leave, whose vertices go next
+		const int32 MaxRemoved = NumPoints / 8 + 8;
+
+		TBitArray<> Removed(false, NumPoints);
+		TArray<int32> RemovalOrder;
+		TArray<int32> Folded;
+
+		auto CollectFolded = [&](const int32 Tri)
+		{
+			if (Mesh[Tri] == -1 || IsGhost(Tri) || WarmDelaunay::Orient(Coords, Mesh[Tri], Mesh[Tri + 1], Mesh[Tri + 2]) > 0) { return; }
+
+			for (int i = 0; i < 3; i++)
+			{
+				const int32 Vtx = Mesh[Tri + i];
+				if (Removed[Vtx]) { continue; }
+
+				Removed[Vtx] = true;
+				Folded.Add(Vtx);
+			}
+		};
+
+		NewSlots.Reset();
+		for (int t = 0; t < Mesh.Num(); t += 3) { CollectFolded(t); }
+
+		while (!Folded.IsEmpty())
+		{
+			if (RemovalOrder.Num() + Folded.Num() > MaxRemoved) { return false; }
+
+			NewSlots.Reset();
+			for (const int32 Vtx : Folded)
+			{
+				if (!RemoveVertex(Vtx)) { return false; }
+				RemovalOrder.Add(Vtx);
+			}
+
+			Folded.Reset();
+			for (const int32 Tri : NewSlots) { CollectFolded(Tri); }
+		}
+
+		PendingEdges.Reset();
+		for (int e = 0; e < Mesh.Num(); e++) { if (Mesh[e] != -1 && HalfEdges[e] > e) { PendingEdges.Add(e); } }
+
+		if (!Legalize()) { return false; }
+
+		// Reverse order, so the neighbor used as a hint is already back in the mesh
+		for (int i = RemovalOrder.Num() - 1; i >= 0; i--)
+		{
+			const int32 Vtx = RemovalOrder[i];
+			if (!InsertVertex(Vtx, VtxEdge[RemovalHints[Vtx]])) { return false; }
+		}
+
+		return IsValidTriangulation();
+	}
+
+	bool FWarmDelaunay2::RemoveVertex(const int32 Vtx)
+	{
+		const int32 Start = VtxEdge[Vtx];
+		if (Start == -1 || Mesh[Start] != Vtx) { return false; }
+
+		// Star of the vertex; Outer[i] is the half-edge facing Ring[i] -> Ring[i + 1] from outside the star
+		TArray<int32, TInlineAllocator<16>> Star;
+		TArray<int32, TInlineAllocator<16>> Ring;
+		TArray<int32, TInlineAllocator<16>> Outer;
+
+		int32 Edge = Start;
+		do
+		{
+			Star.Add(Edge - Edge % 3);
+			Ring.Add(Mesh[WarmDelaunay::NextEdge(Edge)]);
+			Outer.Add(HalfEdges[WarmDelaunay::NextEdge(Edge)]);
+
+			Edge = HalfEdges[WarmDelaunay::PrevEdge(Edge)];
+			if (Edge == -1 || Star.Num() > NumPoints) { return false; }
+		}
+		while (Edge != Start);
+
+		for (const int32 Tri : Star) { FreeTriangle(Tri); }
+
+		VtxEdge[Vtx] = -1;
+		RemovalHints[Vtx] = Ring[0] == Ghost ? Ring[1] : Ring[0];
+
+		// On the hull, the ring is an open chain closed by the ghost; put the ghost last
+		const int32 GhostIndex = Ring.Find(Ghost);
+		if (GhostIndex != INDEX_NONE)
+		{
+			const int32 Num = Ring.Num();
+			TArray<int32, TInlineAllocator<16>> Rotated;
+			TArray<int32, TInlineAllocator<16>> RotatedOuter;
+			for (int i = 1; i <= Num; i++)
+			{
+				Rotated.Add(Ring[(GhostIndex + i) % Num]);
+				RotatedOuter.Add(Outer[(GhostIndex + i) % Num]);
+			}
+			Ring = MoveTemp(Rotated);
+			Outer = MoveTemp(RotatedOuter);
+		}
+
+		// Clip ears off the hole; on the hull, clipping stops once the chain is convex
+		while (Ring.Num() > 3)
+		{
+			const int32 Num = Ring.Num();
+			int32 Ear = -1;
+
+			for (int i = 0; i < Num && Ear == -1; i++)
+			{
+				const int32 A = Ring[(i + Num - 1) % Num];
+				const int32 B = Ring[i];
+				const int32 C = Ring[(i + 1) % Num];
+
+				if (A == Ghost || B == Ghost || C == Ghost) { continue; }
+				if (WarmDelaunay::Orient(PrevCoords, A, B, C) <= 0) { continue; }
+
+				bool bEmpty = true;
+				for (int j = 0; j < Num && bEmpty; j++)
+				{
+					const int32 P = Ring[j];
+					if (P == A || P == B || P == C || P == Ghost) { continue; }
+
+					bEmpty =
+						WarmDelaunay::Orient(PrevCoords, A, B, P) < 0 ||
+						WarmDelaunay::Orient(PrevCoords, B, C, P) < 0 ||
+						WarmDelaunay::Orient(PrevCoords, C, A, P) < 0;
+				}
+
+				if (bEmpty) { Ear = i; }
+			}
+
+			if (Ear == -1)
+			{
+				// A hole always has an ear
+				if (GhostIndex == INDEX_NONE) { return false; }
+				break;
+			}
+
+			const int32 Prev = (Ear + Num - 1) % Num;
+
+			const int32 Tri = AllocTriangle();
+			SetTriangle(Tri, Ring[Prev], Ring[Ear], Ring[(Ear + 1) % Num]);
+			Link(Tri, Outer[Prev]);
+			Link(Tri + 1, Outer[Ear]);
+			HalfEdges[Tri + 2] = -1;
+
+			Outer[Prev] = Tri + 2;
+			Ring.RemoveAt(Ear);
+			Outer.RemoveAt(Ear);
+		}
+
+		const int32 Num = Ring.Num();
+
+		if (GhostIndex == INDEX_NONE)
+		{
+			const int32 Tri = AllocTriangle();
+			SetTriangle(Tri, Ring[0], Ring[1], Ring[2]);
+			Link(Tri, Outer[0]);
+			Link(Tri + 1, Outer[1]);
+			Link(Tri + 2, Outer[2]);
+			return true;
+		}
+
+		// Fan the ghost over what's left of the chain, which is now part of the hull
+		int32 PrevTri = -1;
+		for (int i = 0; i < Num - 2; i++)
+		{
+			const int32 Tri = AllocTriangle();
+			SetTriangle(Tri, Ring[i], Ring[i + 1], Ghost);
+			Link(Tri, Outer[i]);
+			Link(Tri + 2, PrevTri == -1 ? Outer[Num - 1] : PrevTri + 1);
+			HalfEdges[Tri + 1] = -1;
+			PrevTri = Tri;
+		}
+
+		Link(PrevTri + 1, Outer[Num - 2]);
+		return true;
+	}
+
+	bool FWarmDelaunay2::InsertVertex(const int32 Vtx, const int32 Hint)
+	{
+		if (Hint == -1 || Mesh[Hint] == -1) { return false; }
+
+		int32 Tri = Hint - Hint % 3;
+
+		// Walk from a finite triangle toward the vertex; stepping onto a ghost means it lies beyond that hull edge
+		if (IsGhost(Tri))
+		{
+			const int32 Inner = HalfEdges[GetHullEdge(Tri)];
+			Tri = Inner - Inner % 3;
+		}
+
+		for (int Step = 0; !IsGhost(Tri); Step++)
+		{
+			if (Step > Mesh.Num()) { return false; }
+
+			int32 Exit = -1;
+			for (int i = 0; i < 3 && Exit == -1; i++)
+			{
+				// Rotate the first edge tested, so the walk cannot get stuck on degenerate configurations
+				const int32 Edge = Tri + (i + Step) % 3;
+				if (WarmDelaunay::Orient(Coords, Mesh[Edge], Mesh[WarmDelaunay::NextEdge(Edge)], Vtx) < 0) { Exit = HalfEdges[Edge]; }
+			}
+
+			if (Exit == -1) { break; }
+			Tri = Exit - Exit % 3;
+		}
+
+		// Vertices landing exactly on an edge or on the hull line are left to a full triangulation
+		if (IsGhost(Tri))
+		{
+			const int32 Edge = GetHullEdge(Tri);
+			if (WarmDelaunay::Orient(Coords, Mesh[Edge], Mesh[WarmDelaunay::NextEdge(Edge)], Vtx) <= 0) { return false; }
+		}
+		else
+		{
+			for (int i = 0; i < 3; i++)
+			{
+				if (WarmDelaunay::Orient(Coords, Mesh[Tri + i], Mesh[WarmDelaunay::NextEdge(Tri + i)], Vtx) <= 0) { return false; }
+			}
+		}
+
+		const int32 A = Mesh[Tri];
+		const int32 B = Mesh[Tri + 1];
+		const int32 C = Mesh[Tri + 2];
+		const int32 OuterBC = HalfEdges[Tri + 1];
+		const int32 OuterCA = HalfEdges[Tri + 2];
+
+		const int32 TriBC = AllocTriangle();
+		const int32 TriCA = AllocTriangle();
+
+		SetTriangle(Tri, A, B, Vtx);
+		SetTriangle(TriBC, B, C, Vtx);
+		SetTriangle(TriCA, C, A, Vtx);
+
+		Link(TriBC, OuterBC);
+		Link(TriCA, OuterCA);
+		Link(Tri + 1, TriBC + 2);
+		Link(TriBC + 1, TriCA + 2);
+		Link(TriCA + 1, Tri + 2);
+
+		PendingEdges.Reset();
+		PendingEdges.Add(Tri);
+		PendingEdges.Add(TriBC);
+		PendingEdges.Add(TriCA);
+
+		return Legalize();
+	}
+
+	bool FWarmDelaunay2::ShouldFlip(const int32 Edge) const
+	{
+		// Edge goes PR -> PL, P0 is opposite to it and P1 lies across it
+		const int32 Twin = HalfEdges[Edge];
+		const int32 P0 = Mesh[WarmDelaunay::PrevEdge(Edge)];
+		const int32 PR = Mesh[Edge];
+		const int32 PL = Mesh[WarmDelaunay::NextEdge(Edge)];
+		const int32 P1 = Mesh[WarmDelaunay::PrevEdge(Twin)];
+
+		// Hull edges only go away when a triangle folds over the hull, which has been dealt with already
+		if (P0 == Ghost || P1 == Ghost) { return false; }
+
+		// Flipping an edge to the ghost turns a reflex hull vertex into an interior one
+		if (PR == Ghost) { return WarmDelaunay::Orient(Coords, P1, PL, P0) > 0; }
+		if (PL == Ghost) { return WarmDelaunay::Orient(Coords, P0, PR, P1) > 0; }
+
+		if (!delaunator::in_circle(
+			Coords[2 * P0], Coords[2 * P0 + 1],
+			Coords[2 * PR], Coords[2 * PR + 1],
+			Coords[2 * PL], Coords[2 * PL + 1],
+			Coords[2 * P1], Coords[2 * P1 + 1]))
+		{
+			return false;
+		}
+
+		return WarmDelaunay::Orient(Coords, P1, PL, P0) > 0 && WarmDelaunay::Orient(Coords, P0, PR, P1) > 0;
+	}
+
+	void FWarmDelaunay2::Flip(const int32 Edge)
+	{
+		const int32 Twin = HalfEdges[Edge];
+
+		const int32 EdgeL = WarmDelaunay::NextEdge(Edge);
+		const int32 EdgeR = WarmDelaunay::PrevEdge(Edge);
+		const int32 TwinR = WarmDelaunay::NextEdge(Twin);
+		const int32 TwinL = WarmDelaunay::PrevEdge(Twin);
+
+		const int32 P0 = Mesh[EdgeR];
+		const int32 P1 = Mesh[TwinL];
+
+		const int32 OuterTwinL = HalfEdges[TwinL];
+		const int32 OuterEdgeR = HalfEdges[EdgeR];
+
+		Mesh[Edge] = P1;
+		Mesh[Twin] = P0;
+
+		Link(Edge, OuterTwinL);
+		Link(Twin, OuterEdgeR);
+		Link(EdgeR, TwinL);
+
+		for (const int32 E : {Edge, EdgeL, EdgeR, Twin, TwinR, TwinL}) { VtxEdge[Mesh[E]] = E; }
+	}
+
+	bool FWarmDelaunay2::Legalize()
+	{
+		while (!PendingEdges.IsEmpty())
+		{
+			const int32 Edge = PendingEdges.Pop(EAllowShrinking::No);
+			if (!ShouldFlip(Edge)) { continue; }
+
+			if (--FlipBudget < 0) { return false; }
+
+			const int32 Twin = HalfEdges[Edge];
+			Flip(Edge);
+
+			PendingEdges.Add(Edge);
+			PendingEdges.Add(WarmDelaunay::NextEdge(Edge));
+			PendingEdges.Add(Twin);
+			PendingEdges.Add(WarmDelaunay::NextEdge(Twin));
+		}
+
+		return true;
+	}
+
+	bool FWarmDelaunay2::IsValidTriangulation() const
+	{
+		// Every triangle keeps its winding, and the hull is a single convex loop enclosing exactly their area
+		double Area = 0;
+		int32 NumGhosts = 0;
+		int32 FirstGhost = -1;
+
+		for (int t = 0; t < Mesh.Num(); t += 3)
+		{
+			if (Mesh[t] == -1) { continue; }
+
+			if (IsGhost(t))
+			{
+				NumGhosts++;
+				if (FirstGhost == -1) { FirstGhost = t; }
+				continue;
+			}
+
+			const double Orientation = WarmDelaunay::Orient(Coords, Mesh[t], Mesh[t + 1], Mesh[t + 2]);
+			if (Orientation <= 0) { return false; }
+			Area += Orientation;
+		}
+
+		if (FirstGhost == -1) { return false; }
+
+		const int32 Pivot = Mesh[GetHullEdge(FirstGhost)];
+
+		double HullArea = 0;
+		int32 NumHullEdges = 0;
+		int32 Tri = FirstGhost;
+
+		do
+		{
+			const int32 Edge = GetHullEdge(Tri);
+			const int32 A = Mesh[Edge];
+			const int32 B = Mesh[WarmDelaunay::NextEdge(Edge)];
+
+			const int32 Twin = HalfEdges[WarmDelaunay::NextEdge(Edge)];
+			Tri = Twin - Twin % 3;
+
+			const int32 NextHullEdge = GetHullEdge(Tri);
+			if (Mesh[NextHullEdge] != B || WarmDelaunay::Orient(Coords, A, B, Mesh[WarmDelaunay::NextEdge(NextHullEdge)]) > 0) { return false; }
+
+			HullArea += WarmDelaunay::Orient(Coords, Pivot, B, A);
+			if (++NumHullEdges > NumGhosts) { return false; }
+		}
+		while (Tri != FirstGhost);
+
+		return NumHullEdges == NumGhosts && FMath::Abs(Area - HullArea) <= HullArea * 1E-6;
+	}
+
+	void FWarmDelaunay2::SetTriangle(const int32 Tri, const int32 A, const int32 B, const int32 C)
+	{
+		Mesh[Tri] = A;
+		Mesh[Tri + 1] = B;
+		Mesh[Tri + 2] = C;
+
+		VtxEdge[A] = Tri;
+		VtxEdge[B] = Tri + 1;
+		VtxEdge[C] = Tri + 2;
+	}
+
+	int32 FWarmDelaunay2::AllocTriangle()
+	{
+		int32 Tri = -1;
+		if (!FreeSlots.IsEmpty()) { Tri = FreeSlots.Pop(EAllowShrinking::No); }
+		else
+		{
+			Tri = Mesh.Num();
+			Mesh.AddUninitialized(3);
+			HalfEdges.AddUninitialized(3);
+		}
+
+		NewSlots.Add(Tri);
+		return Tri;
+	}
+
+	void FWarmDelaunay2::FreeTriangle(const int32 Tri)
+	{
+		Mesh[Tri] = Mesh[Tri + 1] = Mesh[Tri + 2] = -1;
+		FreeSlots.Add(Tri);
+	}
+
 	FDelaunaySite3::FDelaunaySite3(const FIntVector4& InVtx, const int32 InId)
 		: Id(InId)
 	{
@@ -276,4 +807,48 @@ namespace PCGExGeo
 			LongestEdges.Add(Edge);
 		}
 	}
+
+	void GetAverageSiteCentroids(const TArrayView<FVector>& Positions, const TConstArrayView<int32> Simplices, const int32 Stride, TArray<FVector>& OutAverages)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExGeo::GetAverageSiteCentroids);
+
+		const int32 NumPoints = Positions.Num();
+		const int32 NumSites = Simplices.Num() / Stride;
+
+		TArray<FVector> Centroids;
+		Centroids.SetNumUninitialized(NumSites);
+
+		ParallelFor(
+			NumSites, [&](const int32 i)
+			{
+				FVector Sum = FVector::ZeroVector;
+				for (int j = 0; j < Stride; j++) { Sum += Positions[Simplices[i * Stride + j]]; }
+				Centroids[i] = Sum / Stride;
+			});
+
+		// Sites per point, so each point gathers its own sum and the result does not depend on scheduling
+		TArray<int32> Offsets;
+		Offsets.Init(0, NumPoints + 1);
+		for (const int32 Vtx : Simplices) { Offsets[Vtx + 1]++; }
+		for (int i = 0; i < NumPoints; i++) { Offsets[i + 1] += Offsets[i]; }
+
+		TArray<int32> PointSites;
+		PointSites.SetNumUninitialized(Simplices.Num());
+
+		{
+			TArray<int32> Cursors(Offsets.GetData(), NumPoints);
+			for (int i = 0; i < Simplices.Num(); i++) { PointSites[Cursors[Simplices[i]]++] = i / Stride; }
+		}
+
+		OutAverages.SetNumUninitialized(NumPoints);
+
+		ParallelFor(
+			NumPoints, [&](const int32 i)
+			{
+				// The point itself counts as one sample
+				FVector Sum = Positions[i];
+				for (int j = Offsets[i]; j < Offsets[i + 1]; j++) { Sum += Centroids[PointSites[j]]; }
+				OutAverages[i] = Sum / (1 + Offsets[i + 1] - Offsets[i]);
+			});
+	}
 }
@@ -0,0 +1,66 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Geometry/PCGExGeoKDTree.h"
+
+#include <algorithm>
+
+namespace PCGExGeo
+{
+	void FKDTree::Build(const TArray<FVector>& InPositions)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FKDTree::Build);
+
+		const int32 NumItems = InPositions.Num();
+
+		Nodes.Reset();
+		Positions.Reset();
+		Items.Reset();
+
+		if (!NumItems) { return; }
+
+		Items.SetNumUninitialized(NumItems);
+		for (int i = 0; i < NumItems; i++) { Items[i] = i; }
+
+		// Leaves hold at least LeafSize / 2 items, so this is an upper bound
+		Nodes.Reserve(2 * FMath::DivideAndRoundUp(NumItems, LeafSize / 2));
+		BuildNode(InPositions, 0, NumItems);
+
+		// Store positions leaf-contiguous for cache-friendly leaf scans
+		Positions.SetNumUninitialized(NumItems);
+		for (int i = 0; i < NumItems; i++) { Positions[i] = InPositions[Items[i]]; }
+	}
+
+	int32 FKDTree::BuildNode(const TArray<FVector>& InPositions, const int32 Start, const int32 Count)
+	{
+		const int32 NodeIndex = Nodes.Emplace();
+
+		FBox Bounds = FBox(ForceInit);
+		for (int i = Start; i < Start + Count; i++) { Bounds += InPositions[Items[i]]; }
+
+		Nodes[NodeIndex].Bounds = Bounds;
+		Nodes[NodeIndex].Start = Start;
+		Nodes[NodeIndex].Count = Count;
+
+		if (Count <= LeafSize) { return NodeIndex; }
+
+		// Median split along the longest axis
+		const FVector Size = Bounds.GetSize();
+		const int32 Axis = Size.X >= Size.Y ? (Size.X >= Size.Z ? 0 : 2) : (Size.Y >= Size.Z ? 1 : 2);
+		const int32 Half = Count / 2;
+
+		int32* First = Items.GetData() + Start;
+		std::nth_element(
+			First, First + Half, First + Count,
+			[&](const int32 A, const int32 B) { return InPositions[A][Axis] < InPositions[B][Axis]; });
+
+		const int32 Left = BuildNode(InPositions, Start, Half);
+		const int32 Right = BuildNode(InPositions, Start + Half, Count - Half);
+
+		// Nodes may have been reallocated
+		Nodes[NodeIndex].Left = Left;
+		Nodes[NodeIndex].Right = Right;
+
+		return NodeIndex;
+	}
+}
@@ -7,6 +7,7 @@
 #include "Data/PCGExPointIO.h"
 #include "PCGExGlobalSettings.h"
 #include "Graph/PCGExCluster.h"
+#include "Graph/Pathfinding/Heuristics/PCGExHeuristicLandmarks.h"
 
 PCG_DEFINE_TYPE_INFO(FPCGExDataTypeInfoClusterPart, UPCGExClusterData)
 PCG_DEFINE_TYPE_INFO(FPCGExDataTypeInfoVtx, UPCGExClusterNodesData)
@@ -32,6 +33,7 @@ void UPCGExClusterEdgesData::InitializeSpatialDataInternal(const FPCGInitializeF
 		InEdgeData && GetDefault<UPCGExGlobalSettings>()->bCacheClusters)
 	{
 		SetBoundCluster(InEdgeData->Cluster);
+		SetBoundLandmarks(InEdgeData->GetBoundLandmarks());
 	}
 }
 
@@ -51,10 +53,23 @@ const TSharedPtr<PCGExCluster::FCluster>& UPCGExClusterEdgesData::GetBoundCluste
 	return Cluster;
 }
 
+void UPCGExClusterEdgesData::SetBoundLandmarks(const TSharedPtr<PCGExHeuristics::FLandmarks>& InLandmarks) const
+{
+	FWriteScopeLock WriteScopeLock(LandmarksLock);
+	Landmarks = InLandmarks;
+}
+
+TSharedPtr<PCGExHeuristics::FLandmarks> UPCGExClusterEdgesData::GetBoundLandmarks() const
+{
+	FReadScopeLock ReadScopeLock(LandmarksLock);
+	return Landmarks;
+}
+
 void UPCGExClusterEdgesData::BeginDestroy()
 {
 	Super::BeginDestroy();
 	Cluster.Reset();
+	Landmarks.Reset();
 }
 
 TSharedPtr<PCGExCluster::FCluster> PCGExClusterData::TryGetCachedCluster(const TSharedRef<PCGExData::FPointIO>& VtxIO, const TSharedRef<PCGExData::FPointIO>& EdgeIO)
@@ -59,6 +59,7 @@ bool FPCGExRelaxClustersElement::ExecuteInternal(FPCGContext* InContext) const
 				NewBatch->bRequiresWriteStep = true;
 				NewBatch->AllocateVtxProperties = EPCGPointNativeProperties::Transform;
 				NewBatch->VtxFilterFactories = &Context->VtxFilterFactories;
+				NewBatch->bWantsPackedAdjacency = true;
 			}))
 		{
 			return Context->CancelExecution(TEXT("Could not build any clusters."));
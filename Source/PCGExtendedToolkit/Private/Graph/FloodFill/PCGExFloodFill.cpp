@@ -56,7 +56,7 @@ namespace PCGExFloodFill
 
 		FVector FromPosition = Cluster->GetPos(FromNode);
 
-		for (const PCGExGraph::FLink& Lk : FromNode.Links)
+		for (const PCGExGraph::FLink& Lk : Cluster->GetLinks(FromNode.Index))
 		{
 			PCGExCluster::FNode* OtherNode = Cluster->GetNode(Lk);
 			Visited.Add(OtherNode->Index, &bIsAlreadyInSet);
@@ -97,6 +97,7 @@ bool FPCGExClusterDiffusionElement::ExecuteInternal(FPCGContext* InContext) cons
 			[&](const TSharedPtr<PCGExClusterMT::IBatch>& NewBatch)
 			{
 				NewBatch->bRequiresWriteStep = true;
+				NewBatch->bWantsPackedAdjacency = true;
 			}))
 		{
 			return Context->CancelExecution(TEXT("Could not build any clusters."));
@@ -4,6 +4,7 @@
 #include "Graph/PCGExCluster.h"
 
 #include "PCGExMath.h"
+#include "PCGExTelemetry.h"
 #include "Data/PCGExAttributeHelpers.h"
 #include "Data/PCGExPointIO.h"
 #include "Data/PCGExData.h"
@@ -106,6 +107,9 @@ namespace PCGExCluster
 
 		BoundedEdges = OriginalCluster->BoundedEdges;
 
+		// Links are never modified after the cluster is built, so the packed adjacency can be shared even if nodes are copied
+		PackedAdjacency = OriginalCluster->PackedAdjacency;
+
 		if (bCopyNodes)
 		{
 			const int32 NumNewNodes = OriginalCluster->Nodes->Num();
@@ -161,6 +165,8 @@ namespace PCGExCluster
 			Edges = OriginalCluster->Edges;
 			EdgesDataPtr = OriginalCluster->EdgesDataPtr;
 		}
+
+		TrackMemory(bCopyNodes, bCopyEdges);
 	}
 
 	void FCluster::TConstVtxLookup::Dump(TArray<int32>& OutIndices) const
@@ -196,6 +202,33 @@ namespace PCGExCluster
 
 	FCluster::~FCluster()
 	{
+		if (Telemetry) { Telemetry->AddClusterBytes(-TrackedBytes); }
+	}
+
+	void FCluster::TrackMemory(const bool bNodes, const bool bEdges)
+	{
+		if ((!bNodes && !bEdges) || !PCGExTelemetry::IsEnabled()) { return; }
+
+		const TSharedPtr<PCGExData::FPointIO> PinnedVtxIO = VtxIO.Pin();
+		const FPCGExContext* Context = PinnedVtxIO ? PinnedVtxIO->GetContext() : nullptr;
+		if (!Context || !Context->Telemetry) { return; }
+
+		int64 Bytes = 0;
+
+		if (bNodes)
+		{
+			Bytes += Nodes->GetAllocatedSize();
+			for (const FNode& Node : *Nodes) { Bytes += Node.Links.GetAllocatedSize(); }
+			if (PackedAdjacency && !bIsMirror) { Bytes += PackedAdjacency->GetAllocatedSize(); }
+		}
+
+		if (bEdges) { Bytes += Edges->GetAllocatedSize(); }
+
+		if (Telemetry) { Telemetry->AddClusterBytes(-TrackedBytes); }
+
+		Telemetry = Context->Telemetry;
+		TrackedBytes = Bytes;
+		Telemetry->AddClusterBytes(TrackedBytes);
 	}
 
 	bool FCluster::BuildFrom(
@@ -271,6 +304,14 @@ namespace PCGExCluster
 		NodesDataPtr = Nodes->GetData();
 		EdgesDataPtr = Edges->GetData();
 
+		if (bWantsPackedAdjacency)
+		{
+			PackedAdjacency = MakeShared<FPackedAdjacency>();
+			PackedAdjacency->Build(*Nodes);
+		}
+
+		TrackMemory(true, true);
+
 		return true;
 	}
 
@@ -312,6 +353,14 @@ namespace PCGExCluster
 
 		NodesDataPtr = Nodes->GetData();
 		EdgesDataPtr = Edges->GetData();
+
+		if (bWantsPackedAdjacency)
+		{
+			PackedAdjacency = MakeShared<FPackedAdjacency>();
+			PackedAdjacency->Build(*Nodes);
+		}
+
+		TrackMemory(true, true);
 	}
 
 	bool FCluster::IsValidWith(const TSharedRef<PCGExData::FPointIO>& InVtxIO, const TSharedRef<PCGExData::FPointIO>& InEdgesIO) const
@@ -935,6 +984,24 @@ namespace PCGExCluster
 		return BoundedEdges;
 	}
 
+	TSharedPtr<FPackedAdjacency> FCluster::GetPackedAdjacency()
+	{
+		{
+			FReadScopeLock ReadScopeLock(ClusterLock);
+			if (PackedAdjacency) { return PackedAdjacency; }
+		}
+		{
+			FWriteScopeLock WriteScopeLock(ClusterLock);
+			if (PackedAdjacency) { return PackedAdjacency; }
+
+			TSharedPtr<FPackedAdjacency> NewAdjacency = MakeShared<FPackedAdjacency>();
+			NewAdjacency->Build(*Nodes);
+			PackedAdjacency = NewAdjacency;
+		}
+
+		return PackedAdjacency;
+	}
+
 	void FCluster::ExpandEdges(PCGExMT::FTaskManager* AsyncManager)
 	{
 		if (BoundedEdges) { return; }
@@ -1021,5 +1088,36 @@ namespace PCGExCluster
 	{
 	}
 
+	void FPackedAdjacency::Build(const TArray<FNode>& InNodes)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FPackedAdjacency::Build);
+
+		const int32 NumNodes = InNodes.Num();
+		const FNode* NodesPtr = InNodes.GetData();
+
+		// Count
+		Offsets.SetNumUninitialized(NumNodes + 1);
+		int32* OffsetsPtr = Offsets.GetData();
+
+		int32 NumLinks = 0;
+		for (int i = 0; i < NumNodes; i++)
+		{
+			OffsetsPtr[i] = NumLinks;
+			NumLinks += (NodesPtr + i)->Links.Num();
+		}
+		OffsetsPtr[NumNodes] = NumLinks;
+
+		// Scatter
+		Links.SetNumUninitialized(NumLinks);
+		FLink* LinksPtr = Links.GetData();
+
+		for (int i = 0; i < NumNodes; i++)
+		{
+			const PCGExGraph::NodeLinks& NodeLinks = (NodesPtr + i)->Links;
+			if (NodeLinks.IsEmpty()) { continue; }
+			FMemory::Memcpy(LinksPtr + OffsetsPtr[i], NodeLinks.GetData(), NodeLinks.Num() * sizeof(FLink));
+		}
+	}
+
 #pragma endregion
 }
@@ -0,0 +1,474 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Graph/PCGExClusterCache.h"
+
+#include "PCGExGlobalSettings.h"
+#include "Async/MappedFileHandle.h"
+#include "Data/PCGExData.h"
+#include "Data/PCGExPointIO.h"
+#include "Graph/PCGExCluster.h"
+#include "Graph/PCGExEdge.h"
+#include "Hash/xxhash.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Tasks/Task.h"
+
+namespace PCGExClusterCache
+{
+	namespace
+	{
+		enum EFlags : uint32
+		{
+			Flag_None         = 0,
+			Flag_BoundedEdges = 1 << 0,
+		};
+
+		struct FHeader
+		{
+			uint32 Magic = 0;
+			uint32 Version = 0;
+			uint64 Key = 0;
+			int32 NumRawVtx = 0;
+			int32 NumRawEdges = 0;
+			int32 NumNodes = 0;
+			int32 NumLinks = 0;
+			int32 NumEdges = 0;
+			uint32 Flags = Flag_None;
+			FVector BoundsMin = FVector::ZeroVector;
+			FVector BoundsMax = FVector::ZeroVector;
+		};
+
+		// Bounded edges are stored field by field, FBoundedEdge layout isn't ours to rely on
+		constexpr int64 BoundedEdgeSize = sizeof(int32) + sizeof(FVector) * 2 + sizeof(double);
+
+		constexpr const TCHAR* Extension = TEXT(".pcgexcluster");
+
+		FCriticalSection SavedKeysLock;
+		TSet<uint64> SavedKeys;
+
+		FCriticalSection TrimLock;
+
+		class FWriter
+		{
+		public:
+			TArray<uint8> Bytes;
+
+			void Write(const void* InData, const int64 InSize) { Bytes.Append(static_cast<const uint8*>(InData), InSize); }
+
+			template <typename T>
+			void Write(const T& InValue) { Write(&InValue, sizeof(T)); }
+		};
+
+		class FReader
+		{
+		public:
+			FReader(const uint8* InData, const int64 InSize)
+				: Data(InData), Remaining(InSize)
+			{
+			}
+
+			bool Read(void* OutData, const int64 InSize)
+			{
+				if (InSize < 0 || InSize > Remaining) { return false; }
+				FMemory::Memcpy(OutData, Data, InSize);
+				Data += InSize;
+				Remaining -= InSize;
+				return true;
+			}
+
+			template <typename T>
+			bool Read(T& OutValue) { return Read(&OutValue, sizeof(T)); }
+
+			int64 GetRemaining() const { return Remaining; }
+
+			// Returns a pointer to the next InSize bytes and skips them, without copying
+			const uint8* Skip(const int64 InSize)
+			{
+				if (InSize < 0 || InSize > Remaining) { return nullptr; }
+				const uint8* Start = Data;
+				Data += InSize;
+				Remaining -= InSize;
+				return Start;
+			}
+
+		private:
+			const uint8* Data = nullptr;
+			int64 Remaining = 0;
+		};
+
+		bool ReadEndpoints(const TSharedRef<PCGExData::FPointIO>& InIO, const FName InAttributeName, TUniquePtr<PCGExData::TArrayBuffer<int64>>& OutBuffer)
+		{
+			OutBuffer = MakeUnique<PCGExData::TArrayBuffer<int64>>(InIO, InAttributeName);
+			return OutBuffer->InitForRead();
+		}
+
+		TSharedPtr<PCGExCluster::FCluster> Deserialize(
+			FReader& Reader, const uint64 InKey,
+			const TSharedRef<PCGExData::FPointIO>& InVtxIO, const TSharedRef<PCGExData::FPointIO>& InEdgesIO,
+			const bool bWantsPackedAdjacency)
+		{
+			FHeader Header;
+			if (!Reader.Read(Header)) { return nullptr; }
+
+			if (Header.Magic != Magic || Header.Version != Version || Header.Key != InKey) { return nullptr; }
+			if (Header.NumRawVtx != InVtxIO->GetNum() || Header.NumRawEdges != InEdgesIO->GetNum()) { return nullptr; }
+			if (Header.NumNodes < 0 || Header.NumNodes > Header.NumRawVtx || Header.NumEdges != Header.NumRawEdges || Header.NumLinks < 0) { return nullptr; }
+
+			const int32 NumNodes = Header.NumNodes;
+			const int32 NumEdges = Header.NumEdges;
+
+			// Make sure the file holds everything the header claims before allocating anything from its counts
+			const int64 RequiredBytes =
+				static_cast<int64>(NumNodes) * sizeof(int32) +
+				(static_cast<int64>(NumNodes) + 1) * sizeof(int32) +
+				static_cast<int64>(Header.NumLinks) * sizeof(PCGExGraph::FLink) +
+				static_cast<int64>(NumEdges) * sizeof(uint32) * 2 +
+				(Header.Flags & Flag_BoundedEdges ? static_cast<int64>(NumEdges) * BoundedEdgeSize : 0);
+
+			if (RequiredBytes > Reader.GetRemaining()) { return nullptr; }
+
+			const uint8* PointIndicesPtr = Reader.Skip(static_cast<int64>(NumNodes) * sizeof(int32));
+			TSharedPtr<PCGExCluster::FPackedAdjacency> Adjacency = MakeShared<PCGExCluster::FPackedAdjacency>();
+			Adjacency->Offsets.SetNumUninitialized(NumNodes + 1);
+			Adjacency->Links.SetNumUninitialized(Header.NumLinks);
+
+			if (!PointIndicesPtr
+				|| !Reader.Read(Adjacency->Offsets.GetData(), static_cast<int64>(Adjacency->Offsets.Num()) * sizeof(int32))
+				|| !Reader.Read(Adjacency->Links.GetData(), static_cast<int64>(Adjacency->Links.Num()) * sizeof(PCGExGraph::FLink)))
+			{
+				return nullptr;
+			}
+
+			const uint8* EdgesPtr = Reader.Skip(static_cast<int64>(NumEdges) * sizeof(uint32) * 2);
+			if (!EdgesPtr) { return nullptr; }
+
+			const TSharedPtr<PCGEx::FIndexLookup> NodeIndexLookup = MakeShared<PCGEx::FIndexLookup>(Header.NumRawVtx);
+			PCGEX_MAKE_SHARED(Cluster, PCGExCluster::FCluster, InVtxIO, InEdgesIO, NodeIndexLookup)
+
+			Cluster->NumRawVtx = Header.NumRawVtx;
+			Cluster->NumRawEdges = Header.NumRawEdges;
+			Cluster->VtxTransforms = InVtxIO->GetIn()->GetConstTransformValueRange();
+			Cluster->Bounds = FBox(Header.BoundsMin, Header.BoundsMax);
+
+			// Nodes
+			TArray<PCGExCluster::FNode>& Nodes = *Cluster->Nodes;
+			Nodes.SetNum(NumNodes);
+
+			const int32* Offsets = Adjacency->Offsets.GetData();
+			if (Offsets[0] != 0 || Offsets[NumNodes] != Header.NumLinks) { return nullptr; }
+
+			for (int i = 0; i < NumNodes; i++)
+			{
+				int32 PointIndex = -1;
+				FMemory::Memcpy(&PointIndex, PointIndicesPtr + i * sizeof(int32), sizeof(int32));
+
+				const int32 NumLinks = Offsets[i + 1] - Offsets[i];
+				if (PointIndex < 0 || PointIndex >= Header.NumRawVtx || NumLinks < 0) { return nullptr; }
+
+				PCGExCluster::FNode& Node = Nodes[i];
+				Node.Index = i;
+				Node.PointIndex = PointIndex;
+				Node.Links.Append(Adjacency->Links.GetData() + Offsets[i], NumLinks);
+
+				NodeIndexLookup->GetMutable(PointIndex) = i;
+			}
+
+			for (const PCGExGraph::FLink& Lk : Adjacency->Links)
+			{
+				if (Lk.Node < 0 || Lk.Node >= NumNodes || Lk.Edge < 0 || Lk.Edge >= NumEdges) { return nullptr; }
+			}
+
+			// Edges
+			TArray<PCGExGraph::FEdge>& Edges = *Cluster->Edges;
+			PCGEx::InitArray(Edges, NumEdges);
+
+			const int32 EdgeIOIndex = InEdgesIO->IOIndex;
+			for (int i = 0; i < NumEdges; i++)
+			{
+				uint32 Endpoints[2];
+				FMemory::Memcpy(Endpoints, EdgesPtr + i * sizeof(Endpoints), sizeof(Endpoints));
+				if (Endpoints[0] >= static_cast<uint32>(Header.NumRawVtx) || Endpoints[1] >= static_cast<uint32>(Header.NumRawVtx)) { return nullptr; }
+				if (NodeIndexLookup->Get(Endpoints[0]) == -1 || NodeIndexLookup->Get(Endpoints[1]) == -1) { return nullptr; }
+				Edges[i] = PCGExGraph::FEdge(i, Endpoints[0], Endpoints[1], i, EdgeIOIndex);
+			}
+
+			// Optional sections
+			if (Header.Flags & Flag_BoundedEdges)
+			{
+				const uint8* BoundedEdgesPtr = Reader.Skip(static_cast<int64>(NumEdges) * BoundedEdgeSize);
+				if (!BoundedEdgesPtr) { return nullptr; }
+
+				Cluster->BoundedEdges = MakeShared<TArray<PCGExCluster::FBoundedEdge>>();
+				TArray<PCGExCluster::FBoundedEdge>& BoundedEdges = *Cluster->BoundedEdges;
+				PCGEx::InitArray(BoundedEdges, NumEdges);
+
+				for (int i = 0; i < NumEdges; i++)
+				{
+					FReader EdgeReader(BoundedEdgesPtr + i * BoundedEdgeSize, BoundedEdgeSize);
+					PCGExCluster::FBoundedEdge& BoundedEdge = BoundedEdges[i];
+					EdgeReader.Read(BoundedEdge.Index);
+					EdgeReader.Read(BoundedEdge.Bounds.Origin);
+					EdgeReader.Read(BoundedEdge.Bounds.BoxExtent);
+					EdgeReader.Read(BoundedEdge.Bounds.SphereRadius);
+				}
+			}
+
+			Cluster->NodesDataPtr = Nodes.GetData();
+			Cluster->EdgesDataPtr = Edges.GetData();
+
+			if (bWantsPackedAdjacency) { Cluster->PackedAdjacency = Adjacency; }
+
+			Cluster->TrackMemory(true, true);
+
+			return Cluster;
+		}
+	}
+
+	bool IsEnabled()
+	{
+		const UPCGExGlobalSettings* Settings = GetDefault<UPCGExGlobalSettings>();
+		return Settings->bCacheClusters && Settings->bCacheClustersOnDisk;
+	}
+
+	uint64 ComputeKey(const TSharedRef<PCGExData::FPointIO>& InVtxIO, const TSharedRef<PCGExData::FPointIO>& InEdgesIO)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusterCache::ComputeKey);
+
+		TUniquePtr<PCGExData::TArrayBuffer<int64>> VtxEndpoints;
+		TUniquePtr<PCGExData::TArrayBuffer<int64>> EdgeEndpoints;
+
+		if (!ReadEndpoints(InVtxIO, PCGExGraph::Attr_PCGExVtxIdx, VtxEndpoints) ||
+			!ReadEndpoints(InEdgesIO, PCGExGraph::Attr_PCGExEdgeIdx, EdgeEndpoints))
+		{
+			return 0;
+		}
+
+		const TArray<int64>& VtxValues = *VtxEndpoints->GetInValues();
+		const TArray<int64>& EdgeValues = *EdgeEndpoints->GetInValues();
+
+		FXxHash64Builder Builder;
+
+		const int32 Counts[2] = {VtxValues.Num(), EdgeValues.Num()};
+		Builder.Update(&Version, sizeof(Version));
+		Builder.Update(Counts, sizeof(Counts));
+		Builder.Update(VtxValues.GetData(), VtxValues.Num() * sizeof(int64));
+		Builder.Update(EdgeValues.GetData(), EdgeValues.Num() * sizeof(int64));
+
+		// Positions drive cluster & edge bounds
+		const TConstPCGValueRange<FTransform> Transforms = InVtxIO->GetIn()->GetConstTransformValueRange();
+		for (const FTransform& Transform : Transforms)
+		{
+			const FVector Location = Transform.GetLocation();
+			Builder.Update(&Location, sizeof(FVector));
+		}
+
+		const uint64 Key = Builder.Finalize().Hash;
+		return Key ? Key : 1;
+	}
+
+	FString GetCacheDirectory()
+	{
+		const FString& Directory = GetDefault<UPCGExGlobalSettings>()->ClusterDiskCacheDirectory;
+		return Directory.IsEmpty() ? FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("PCGEx"), TEXT("ClusterCache")) : Directory;
+	}
+
+	FString GetCachePath(const uint64 InKey)
+	{
+		return FPaths::Combine(GetCacheDirectory(), FString::Printf(TEXT("%016llx%s"), InKey, Extension));
+	}
+
+	TSharedPtr<PCGExCluster::FCluster> TryLoad(
+		const uint64 InKey,
+		const TSharedRef<PCGExData::FPointIO>& InVtxIO, const TSharedRef<PCGExData::FPointIO>& InEdgesIO,
+		const bool bWantsPackedAdjacency)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusterCache::TryLoad);
+
+		if (!InKey) { return nullptr; }
+
+		const FString Path = GetCachePath(InKey);
+
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		if (!PlatformFile.FileExists(*Path)) { return nullptr; }
+
+		TSharedPtr<PCGExCluster::FCluster> Cluster;
+
+		FOpenMappedResult MappedResult = PlatformFile.OpenMappedEx(*Path);
+		if (MappedResult.HasValue())
+		{
+			const TUniquePtr<IMappedFileHandle> MappedFile = MappedResult.StealValue();
+			const TUniquePtr<IMappedFileRegion> Region(MappedFile->MapRegion(0, MappedFile->GetFileSize()));
+			if (Region)
+			{
+				FReader Reader(Region->GetMappedPtr(), Region->GetMappedSize());
+				Cluster = Deserialize(Reader, InKey, InVtxIO, InEdgesIO, bWantsPackedAdjacency);
+			}
+		}
+		else
+		{
+			// Platform doesn't support mapping that file, read it whole instead
+			TArray64<uint8> Bytes;
+			if (FFileHelper::LoadFileToArray(Bytes, *Path, FILEREAD_Silent))
+			{
+				FReader Reader(Bytes.GetData(), Bytes.Num());
+				Cluster = Deserialize(Reader, InKey, InVtxIO, InEdgesIO, bWantsPackedAdjacency);
+			}
+		}
+
+		if (!Cluster) { UE_LOG(LogPCGEx, Verbose, TEXT("Ignoring stale or invalid cluster cache file %s"), *Path); }
+		else { PlatformFile.SetTimeStamp(*Path, FDateTime::UtcNow()); } // Keeps eviction least-recently-used rather than oldest-written
+
+		return Cluster;
+	}
+
+	void Save(const uint64 InKey, const TSharedRef<PCGExCluster::FCluster>& InCluster)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusterCache::Save);
+
+		if (!InKey) { return; }
+
+		{
+			FScopeLock Lock(&SavedKeysLock);
+			bool bAlreadySaved = false;
+			SavedKeys.Add(InKey, &bAlreadySaved);
+			if (bAlreadySaved) { return; }
+		}
+
+		const TArray<PCGExCluster::FNode>& Nodes = *InCluster->Nodes;
+		const TArray<PCGExGraph::FEdge>& Edges = *InCluster->Edges;
+
+		const bool bWithBounds = GetDefault<UPCGExGlobalSettings>()->bCacheClusterEdgeBounds;
+		const TSharedPtr<TArray<PCGExCluster::FBoundedEdge>> BoundedEdges = bWithBounds ? InCluster->GetBoundedEdges(true) : nullptr;
+
+		FHeader Header;
+		Header.Magic = Magic;
+		Header.Version = Version;
+		Header.Key = InKey;
+		Header.NumRawVtx = InCluster->NumRawVtx;
+		Header.NumRawEdges = InCluster->NumRawEdges;
+		Header.NumNodes = Nodes.Num();
+		Header.NumEdges = Edges.Num();
+		Header.Flags = BoundedEdges ? Flag_BoundedEdges : Flag_None;
+		Header.BoundsMin = InCluster->Bounds.Min;
+		Header.BoundsMax = InCluster->Bounds.Max;
+
+		// Packed adjacency has the exact layout we're after; build a transient one if the cluster doesn't carry it
+		TSharedPtr<PCGExCluster::FPackedAdjacency> Adjacency = InCluster->PackedAdjacency;
+		if (!Adjacency)
+		{
+			Adjacency = MakeShared<PCGExCluster::FPackedAdjacency>();
+			Adjacency->Build(Nodes);
+		}
+
+		Header.NumLinks = Adjacency->Links.Num();
+
+		FWriter Writer;
+		Writer.Bytes.Reserve(
+			sizeof(FHeader) + Nodes.Num() * sizeof(int32) + Adjacency->Offsets.Num() * sizeof(int32) + Adjacency->Links.Num() * sizeof(PCGExGraph::FLink) +
+			Edges.Num() * sizeof(uint32) * 2 + (BoundedEdges ? Edges.Num() * BoundedEdgeSize : 0));
+
+		Writer.Write(Header);
+		for (const PCGExCluster::FNode& Node : Nodes) { Writer.Write(Node.PointIndex); }
+		Writer.Write(Adjacency->Offsets.GetData(), Adjacency->Offsets.Num() * sizeof(int32));
+		Writer.Write(Adjacency->Links.GetData(), Adjacency->Links.Num() * sizeof(PCGExGraph::FLink));
+
+		for (const PCGExGraph::FEdge& Edge : Edges)
+		{
+			Writer.Write(Edge.Start);
+			Writer.Write(Edge.End);
+		}
+
+		if (BoundedEdges)
+		{
+			for (const PCGExCluster::FBoundedEdge& BoundedEdge : *BoundedEdges)
+			{
+				Writer.Write(BoundedEdge.Index);
+				Writer.Write(BoundedEdge.Bounds.Origin);
+				Writer.Write(BoundedEdge.Bounds.BoxExtent);
+				Writer.Write(BoundedEdge.Bounds.SphereRadius);
+			}
+		}
+
+		const int64 MaxBytes = static_cast<int64>(GetDefault<UPCGExGlobalSettings>()->ClusterDiskCacheMaxSizeMB) * 1024 * 1024;
+
+		UE::Tasks::Launch(
+			UE_SOURCE_LOCATION,
+			[Path = GetCachePath(InKey), Bytes = MoveTemp(Writer.Bytes), MaxBytes]()
+			{
+				// Write next to the destination then move, so readers never see a partial file
+				const FString TempPath = Path + TEXT(".") + FGuid::NewGuid().ToString() + TEXT(".tmp");
+				if (!FFileHelper::SaveArrayToFile(Bytes, *TempPath))
+				{
+					UE_LOG(LogPCGEx, Warning, TEXT("Could not write cluster cache file %s"), *TempPath);
+					return;
+				}
+
+				if (!IFileManager::Get().Move(*Path, *TempPath, true, true))
+				{
+					IFileManager::Get().Delete(*TempPath, false, true, true);
+					return;
+				}
+
+				Trim(MaxBytes);
+			},
+			UE::Tasks::ETaskPriority::BackgroundLow);
+	}
+
+	void Trim(const int64 MaxBytes)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusterCache::Trim);
+
+		FScopeLock Lock(&TrimLock);
+
+		struct FEntry
+		{
+			FString Path;
+			int64 Size = 0;
+			FDateTime LastUsed;
+		};
+
+		TArray<FEntry> Entries;
+		int64 TotalBytes = 0;
+
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		PlatformFile.IterateDirectoryStat(
+			*GetCacheDirectory(), [&](const TCHAR* InPath, const FFileStatData& InStat)
+			{
+				if (!InStat.bIsDirectory && FStringView(InPath).EndsWith(Extension))
+				{
+					Entries.Add({InPath, InStat.FileSize, InStat.ModificationTime});
+					TotalBytes += InStat.FileSize;
+				}
+				return true;
+			});
+
+		if (TotalBytes <= MaxBytes) { return; }
+
+		Entries.Sort([](const FEntry& A, const FEntry& B) { return A.LastUsed < B.LastUsed; });
+
+		for (const FEntry& Entry : Entries)
+		{
+			if (TotalBytes <= MaxBytes) { break; }
+			if (PlatformFile.DeleteFile(*Entry.Path)) { TotalBytes -= Entry.Size; }
+		}
+	}
+
+	void Clear()
+	{
+		{
+			FScopeLock Lock(&SavedKeysLock);
+			SavedKeys.Empty();
+		}
+
+		Trim(0);
+	}
+
+	static FAutoConsoleCommand CmdClear(
+		TEXT("pcgex.ClusterCache.Clear"),
+		TEXT("Deletes every PCGEx cluster cache file from disk."),
+		FConsoleCommandDelegate::CreateLambda([]() { Clear(); }));
+}
@@ -11,6 +11,8 @@
 #include "Graph/Pathfinding/Heuristics/PCGExHeuristics.h"
 #include "Graph/Pathfinding/Search/PCGExScoredQueue.h"
 #include "Paths/PCGExShiftPath.h"
+#include "Helpers/PCGHelpers.h"
+#include "Algo/BinarySearch.h"
 
 #define LOCTEXT_NAMESPACE "PCGExClusterCentralityElement"
 #define PCGEX_NAMESPACE ClusterCentrality
@@ -96,6 +98,16 @@ bool FPCGExClusterCentralityElement::ExecuteInternal(FPCGContext* InContext) con
 
 namespace PCGExClusterCentrality
 {
+	FBrandesScratch::FBrandesScratch(const int32 NumNodes)
+	{
+		Score.Init(DBL_MAX, NumNodes);
+		Sigma.Init(0.0, NumNodes);
+		Delta.Init(0.0, NumNodes);
+		Pred.SetNum(NumNodes);
+		Stack.Reserve(NumNodes);
+		Queue = MakeShared<PCGExSearch::FScoredQueue>(NumNodes);
+	}
+
 	FProcessor::~FProcessor()
 	{
 	}
@@ -115,6 +127,10 @@ namespace PCGExClusterCentrality
 			{
 				Settings->RandomDownsampling.GetPicks(Context, VtxDataFacade->GetIn(), NumNodes, RandomSamples);
 			}
+			else if (Settings->DownsamplingMode == EPCGExCentralityDownsampling::Pivots)
+			{
+				PickPivots();
+			}
 			else
 			{
 				PCGEx::ArrayOfIndices(RandomSamples, NumNodes);
@@ -173,6 +189,60 @@ namespace PCGExClusterCentrality
 		TryStartCompute();
 	}
 
+	void FProcessor::PickPivots()
+	{
+		const int32 NumPivots = FMath::Clamp(
+			Settings->PivotCount == EPCGExCentralityPivotCount::Fixed ?
+				Settings->NumPivots :
+				// Hoeffding bound on each node, union bound over all of them
+				FMath::CeilToInt(FMath::Loge(2.0 * NumNodes / (1 - Settings->Confidence)) / (2 * FMath::Square(Settings->MaxError))),
+			1, NumNodes);
+
+		FRandomStream Random = PCGHelpers::GetRandomStreamFromSeed(
+			PCGHelpers::ComputeSeed(Settings->PivotSeed),
+			Context->GetInputSettings<UPCGSettings>(), Context->ExecutionSource.Get());
+
+		if (Settings->PivotPicking == EPCGExCentralityPivotPicking::Uniform)
+		{
+			PCGEx::ArrayOfIndices(RandomSamples, NumNodes);
+			for (int32 i = 0; i < NumPivots; i++) { RandomSamples.Swap(i, Random.RandRange(i, NumNodes - 1)); }
+			RandomSamples.SetNum(NumPivots);
+			return;
+		}
+
+		// Degree-weighted draws with replacement; each unique source is weighted by the inverse of its pick probability
+		const TArray<PCGExCluster::FNode>& Nodes = *Cluster->Nodes.Get();
+
+		TArray<double> Cumulative;
+		Cumulative.SetNumUninitialized(NumNodes);
+
+		double Total = 0;
+		for (int i = 0; i < NumNodes; i++)
+		{
+			Total += FMath::Max(1, Nodes[i].Num());
+			Cumulative[i] = Total;
+		}
+
+		TArray<int32> Counts;
+		Counts.Init(0, NumNodes);
+
+		for (int i = 0; i < NumPivots; i++)
+		{
+			const int32 Pick = Algo::UpperBound(Cumulative, Random.FRand() * Total);
+			Counts[FMath::Min(Pick, NumNodes - 1)]++;
+		}
+
+		RandomSamples.Reset();
+		SampleWeights.Reset();
+
+		for (int i = 0; i < NumNodes; i++)
+		{
+			if (!Counts[i]) { continue; }
+			RandomSamples.Add(i);
+			SampleWeights.Add(Counts[i] * Total / (NumPivots * static_cast<double>(FMath::Max(1, Nodes[i].Num()))));
+		}
+	}
+
 	void FProcessor::TryStartCompute()
 	{
 		{
@@ -196,9 +266,39 @@ namespace PCGExClusterCentrality
 
 		if (bDownsample && RandomSamples.IsEmpty()) { RandomSamples.Add(0); }
 
+		if (bDownsample && SampleWeights.IsEmpty())
+		{
+			// Unbiased scaling of a uniform subset
+			SampleWeights.Init(static_cast<double>(NumNodes) / static_cast<double>(RandomSamples.Num()), RandomSamples.Num());
+		}
+
+		// Fixed range size so scopes, and thus the reduction order, are the same from one run to the next
 		StartParallelLoopForRange(bDownsample ? RandomSamples.Num() : NumNodes, 128);
 	}
 
+	TSharedPtr<FBrandesScratch> FProcessor::AcquireScratch()
+	{
+		{
+			FWriteScopeLock WriteScopeLock(ScratchLock);
+			if (!AvailableScratches.IsEmpty()) { return AvailableScratches.Pop(EAllowShrinking::No); }
+		}
+
+		TSharedPtr<FBrandesScratch> NewScratch = MakeShared<FBrandesScratch>(NumNodes);
+
+		{
+			FWriteScopeLock WriteScopeLock(ScratchLock);
+			Scratches.Add(NewScratch);
+		}
+
+		return NewScratch;
+	}
+
+	void FProcessor::ReleaseScratch(const TSharedPtr<FBrandesScratch>& InScratch)
+	{
+		FWriteScopeLock WriteScopeLock(ScratchLock);
+		AvailableScratches.Add(InScratch);
+	}
+
 	void FProcessor::PrepareLoopScopesForRanges(const TArray<PCGExMT::FScope>& Loops)
 	{
 		ScopedBetweenness = MakeShared<PCGExMT::TScopedArray<double>>(Loops);
@@ -206,59 +306,33 @@ namespace PCGExClusterCentrality
 
 	void FProcessor::ProcessRange(const PCGExMT::FScope& Scope)
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusterCentrality::ProcessNodes);
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusterCentrality::ProcessRange);
 
 		TArray<double>& LocalBetweenness = ScopedBetweenness->Get_Ref(Scope);
 		LocalBetweenness.Init(0.0, NumNodes);
 
-		TArray<double> Score;
-		Score.Init(DBL_MAX, NumNodes);
-
-		TArray<double> Sigma;
-		Sigma.Init(0.0, NumNodes);
-
-		TArray<double> Delta;
-		Delta.Init(0.0, NumNodes);
-
-		TArray<NodePred> Pred;
-		Pred.SetNum(NumNodes);
-
-		TArray<int32> Stack;
-		Stack.Reserve(NumNodes);
-
-		TSharedPtr<PCGExSearch::FScoredQueue> Queue = MakeShared<PCGExSearch::FScoredQueue>(NumNodes);
+		const TSharedPtr<FBrandesScratch> Scratch = AcquireScratch();
 
 		if (bDownsample)
 		{
-			const double Ratio = static_cast<double>(NumNodes) / static_cast<double>(RandomSamples.Num());
-
-			PCGEX_SCOPE_LOOP(Index)
-			{
-				ProcessSingleNode(RandomSamples[Index], LocalBetweenness, Score, Sigma, Delta, Pred, Stack, Queue);
-				for (double& B : LocalBetweenness) { B *= Ratio; }
-			}
+			PCGEX_SCOPE_LOOP(Index) { ProcessSingleNode(RandomSamples[Index], SampleWeights[Index], LocalBetweenness, *Scratch); }
 		}
 		else
 		{
-			PCGEX_SCOPE_LOOP(Index)
-			{
-				ProcessSingleNode(Index, LocalBetweenness, Score, Sigma, Delta, Pred, Stack, Queue);
-			}
+			PCGEX_SCOPE_LOOP(Index) { ProcessSingleNode(Index, 1, LocalBetweenness, *Scratch); }
 		}
+
+		ReleaseScratch(Scratch);
 	}
 
-	void FProcessor::ProcessSingleNode(
-		const int32 Index,
-		TArray<double>& LocalBetweenness, TArray<double>& Score,
-		TArray<double>& Sigma, TArray<double>& Delta, TArray<NodePred>& Pred,
-		TArray<int32>& Stack, const TSharedPtr<PCGExSearch::FScoredQueue>& Queue)
+	void FProcessor::ProcessSingleNode(const int32 Index, const double Weight, TArray<double>& LocalBetweenness, FBrandesScratch& Scratch)
 	{
-		for (int i = 0; i < NumNodes; i++)
-		{
-			Score[i] = DBL_MAX;
-			Sigma[i] = 0;
-			Delta[i] = 0;
-		}
+		TArray<double>& Score = Scratch.Score;
+		TArray<double>& Sigma = Scratch.Sigma;
+		TArray<double>& Delta = Scratch.Delta;
+		TArray<NodePred>& Pred = Scratch.Pred;
+		TArray<int32>& Stack = Scratch.Stack;
+		const TSharedPtr<PCGExSearch::FScoredQueue>& Queue = Scratch.Queue;
 
 		Stack.Reset();
 
@@ -306,20 +380,30 @@ namespace PCGExClusterCentrality
 		{
 			const int32 W = Stack[i];
 			for (const int32 V : Pred[W]) { Delta[V] += (Sigma[V] / Sigma[W]) * (1.0 + Delta[W]); }
-			if (W != Index) { LocalBetweenness[W] += Delta[W]; }
+			if (W != Index) { LocalBetweenness[W] += Delta[W] * Weight; }
+		}
+
+		// Every reached node was dequeued exactly once, so the stack is all there is to reset
+		for (const int32 W : Stack)
+		{
+			Score[W] = DBL_MAX;
+			Sigma[W] = 0;
+			Delta[W] = 0;
 		}
 	}
 
 	void FProcessor::OnRangeProcessingComplete()
 	{
 		ScopedBetweenness->ForEach(
-			[&](TArray<double>& ScopedArray)
+			[&](TArray<double>& LocalBetweenness)
 			{
-				for (int i = 0; i < NumNodes; i++) { Betweenness[i] += ScopedArray[i]; }
-				ScopedArray.Empty();
+				for (int i = 0; i < NumNodes; i++) { Betweenness[i] += LocalBetweenness[i]; }
+				LocalBetweenness.Empty();
 			});
 
 		ScopedBetweenness.Reset();
+		Scratches.Empty();
+		AvailableScratches.Empty();
 
 		double Max = 0;
 		for (double& C : Betweenness)
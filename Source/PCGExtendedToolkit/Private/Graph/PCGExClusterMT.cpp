@@ -6,6 +6,7 @@
 #include "Data/PCGExDataPreloader.h"
 #include "Data/PCGExPointIO.h"
 #include "Graph/PCGExCluster.h"
+#include "Graph/PCGExClusterCache.h"
 #include "Graph/Data/PCGExClusterData.h"
 #include "Graph/Filters/PCGExClusterFilter.h"
 #include "Graph/Pathfinding/Heuristics/PCGExHeuristics.h"
@@ -78,10 +79,23 @@ namespace PCGExClusterMT
 			Cluster = HandleCachedCluster(CachedCluster.ToSharedRef());
 		}
 
+		uint64 DiskCacheKey = 0;
+		if (!Cluster && PCGExClusterCache::IsEnabled())
+		{
+			DiskCacheKey = PCGExClusterCache::ComputeKey(VtxDataFacade->Source, EdgeDataFacade->Source);
+			if (const TSharedPtr<PCGExCluster::FCluster> LoadedCluster = PCGExClusterCache::TryLoad(DiskCacheKey, VtxDataFacade->Source, EdgeDataFacade->Source, bWantsPackedAdjacency))
+			{
+				LoadedCluster->bIsOneToOne = bIsOneToOne;
+				Cluster = HandleCachedCluster(LoadedCluster.ToSharedRef());
+				DiskCacheKey = 0;
+			}
+		}
+
 		if (!Cluster)
 		{
 			Cluster = MakeShared<PCGExCluster::FCluster>(VtxDataFacade->Source, EdgeDataFacade->Source, NodeIndexLookup);
 			Cluster->bIsOneToOne = bIsOneToOne;
+			Cluster->bWantsPackedAdjacency = bWantsPackedAdjacency;
 
 			if (!Cluster->BuildFrom(*EndpointsLookup, ExpectedAdjacency))
 			{
@@ -89,8 +103,13 @@ namespace PCGExClusterMT
 				Cluster.Reset();
 				return false;
 			}
+
+			if (DiskCacheKey) { PCGExClusterCache::Save(DiskCacheKey, Cluster.ToSharedRef()); }
 		}
 
+		// Cached clusters may have been built without it
+		if (bWantsPackedAdjacency) { Cluster->GetPackedAdjacency(); }
+
 		if (ProjectedVtxPositions)
 		{
 			TArray<FVector2D>& ProjectedVtx = *ProjectedVtxPositions.Get();
@@ -489,6 +508,7 @@ namespace PCGExClusterMT
 			NewProcessor->EndpointsLookup = &EndpointsLookup;
 			NewProcessor->ExpectedAdjacency = &ExpectedAdjacency;
 			NewProcessor->BatchIndex = Processors.Num();
+			NewProcessor->bWantsPackedAdjacency = bWantsPackedAdjacency;
 
 			if (WantsProjection()) { NewProcessor->SetProjectionDetails(ProjectionDetails, ProjectedVtxPositions, WantsPerClusterProjection()); }
 
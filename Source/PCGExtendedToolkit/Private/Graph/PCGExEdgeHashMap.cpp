@@ -0,0 +1,303 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Graph/PCGExEdgeHashMap.h"
+
+#include "Async/ParallelFor.h"
+
+namespace PCGExGraph
+{
+	namespace EdgeHashMap
+	{
+		constexpr uint8 Empty = 0x80;
+		constexpr uint64 LSBs = 0x0101010101010101ull;
+		constexpr uint64 MSBs = 0x8080808080808080ull;
+
+		constexpr int32 ShardedBits = 6;
+		constexpr int32 ShardedThreshold = 1 << 16;    // Reserve size from which the map is split in shards
+		constexpr int32 ParallelThreshold = 1 << 14; // Batch size from which bulk insertion goes wide
+
+		FORCEINLINE static uint64 LoadGroup(const uint8* InCtrl)
+		{
+			uint64 Word;
+			FMemory::Memcpy(&Word, InCtrl, sizeof(uint64));
+			return Word;
+		}
+
+		// High bit set on bytes equal to the tag; may yield false positives past a true match, keys are compared anyway
+		FORCEINLINE static uint64 MatchTag(const uint64 Group, const uint64 Tags)
+		{
+			const uint64 X = Group ^ Tags;
+			return (X - LSBs) & ~X & MSBs;
+		}
+
+		FORCEINLINE static uint64 MatchEmpty(const uint64 Group) { return Group & MSBs; }
+
+		FORCEINLINE static int32 FirstByte(const uint64 Mask) { return static_cast<int32>(FMath::CountTrailingZeros64(Mask) >> 3); }
+	}
+
+	int32* FEdgeHashMap::FShard::Find(const uint64 Key, const uint64 H)
+	{
+		if (Num == 0) { return nullptr; }
+
+		const uint64 Tags = EdgeHashMap::LSBs * (H & 0x7F);
+		int32 Group = static_cast<int32>(H >> 7) & GroupMask;
+
+		while (true)
+		{
+			const int32 GroupStart = Group * GroupWidth;
+			const uint64 Word = EdgeHashMap::LoadGroup(Ctrl.GetData() + GroupStart);
+
+			for (uint64 Match = EdgeHashMap::MatchTag(Word, Tags); Match; Match &= Match - 1)
+			{
+				const int32 Slot = GroupStart + EdgeHashMap::FirstByte(Match);
+				if (Keys[Slot] == Key) { return &Values[Slot]; }
+			}
+
+			// Insert-only, so an empty slot ends the probe sequence
+			if (EdgeHashMap::MatchEmpty(Word)) { return nullptr; }
+
+			Group = (Group + 1) & GroupMask;
+		}
+	}
+
+	int32 FEdgeHashMap::FShard::FindOrAddSlot(const uint64 Key, const uint64 H, const int32 InValue, bool& bOutIsNew)
+	{
+		const uint8 Tag = static_cast<uint8>(H & 0x7F);
+		const uint64 Tags = EdgeHashMap::LSBs * Tag;
+		int32 Group = static_cast<int32>(H >> 7) & GroupMask;
+
+		while (true)
+		{
+			const int32 GroupStart = Group * GroupWidth;
+			const uint64 Word = EdgeHashMap::LoadGroup(Ctrl.GetData() + GroupStart);
+
+			for (uint64 Match = EdgeHashMap::MatchTag(Word, Tags); Match; Match &= Match - 1)
+			{
+				const int32 Slot = GroupStart + EdgeHashMap::FirstByte(Match);
+				if (Keys[Slot] == Key)
+				{
+					bOutIsNew = false;
+					return Slot;
+				}
+			}
+
+			if (const uint64 EmptyMask = EdgeHashMap::MatchEmpty(Word))
+			{
+				const int32 Slot = GroupStart + EdgeHashMap::FirstByte(EmptyMask);
+				Ctrl[Slot] = Tag;
+				Keys[Slot] = Key;
+				Values[Slot] = InValue;
+				Num++;
+
+				bOutIsNew = true;
+				return Slot;
+			}
+
+			Group = (Group + 1) & GroupMask;
+		}
+	}
+
+	void FEdgeHashMap::FShard::Reserve(const int32 InNum)
+	{
+		if (InNum <= GetGrowthThreshold()) { return; }
+
+		const int32 MinCapacity = static_cast<int32>((static_cast<int64>(InNum) * 8) / 7) + 1;
+		Rehash(FMath::Max(GroupWidth, static_cast<int32>(FMath::RoundUpToPowerOfTwo(MinCapacity))));
+	}
+
+	void FEdgeHashMap::FShard::Rehash(const int32 InCapacity)
+	{
+		TArray<uint8> OldCtrl = MoveTemp(Ctrl);
+		TArray<uint64> OldKeys = MoveTemp(Keys);
+		TArray<int32> OldValues = MoveTemp(Values);
+
+		Ctrl.Init(EdgeHashMap::Empty, InCapacity);
+		Keys.SetNumUninitialized(InCapacity);
+		Values.SetNumUninitialized(InCapacity);
+		GroupMask = InCapacity / GroupWidth - 1;
+
+		for (int i = 0; i < OldCtrl.Num(); i++)
+		{
+			if (OldCtrl[i] & EdgeHashMap::Empty) { continue; }
+
+			// Keys are known to be unique, only look for a free slot
+			const uint64 H = Mix(OldKeys[i]);
+			int32 Group = static_cast<int32>(H >> 7) & GroupMask;
+
+			while (true)
+			{
+				const int32 GroupStart = Group * GroupWidth;
+				if (const uint64 EmptyMask = EdgeHashMap::MatchEmpty(EdgeHashMap::LoadGroup(Ctrl.GetData() + GroupStart)))
+				{
+					const int32 Slot = GroupStart + EdgeHashMap::FirstByte(EmptyMask);
+					Ctrl[Slot] = OldCtrl[i];
+					Keys[Slot] = OldKeys[i];
+					Values[Slot] = OldValues[i];
+					break;
+				}
+
+				Group = (Group + 1) & GroupMask;
+			}
+		}
+	}
+
+	void FEdgeHashMap::Reserve(const int32 InNum)
+	{
+		if (NumItems == 0)
+		{
+			// Shard count can only change while the map is empty
+			const int32 DesiredBits = InNum >= EdgeHashMap::ShardedThreshold ? EdgeHashMap::ShardedBits : 0;
+			if (DesiredBits != ShardBits)
+			{
+				ShardBits = DesiredBits;
+				Shards.Reset();
+				Shards.SetNum(1 << ShardBits);
+			}
+		}
+
+		if (Shards.Num() == 1)
+		{
+			Shards[0].Reserve(InNum);
+			return;
+		}
+
+		// Leave some headroom for uneven distribution
+		const int32 PerShard = InNum / Shards.Num();
+		for (FShard& Shard : Shards) { Shard.Reserve(PerShard + (PerShard >> 3) + GroupWidth); }
+	}
+
+	void FEdgeHashMap::Empty()
+	{
+		Shards.Reset();
+		Shards.SetNum(1);
+		ShardBits = 0;
+		NumItems = 0;
+	}
+
+	int32& FEdgeHashMap::FindOrAdd(const uint64 Key, const int32 InValue, bool& bOutIsNew)
+	{
+		const uint64 H = Mix(Key);
+		FShard& Shard = Shards[GetShardIndex(H)];
+
+		if (Shard.Num >= Shard.GetGrowthThreshold()) { Shard.Reserve(Shard.Num + 1); }
+
+		const int32 Slot = Shard.FindOrAddSlot(Key, H, InValue, bOutIsNew);
+		if (bOutIsNew) { NumItems++; }
+
+		return Shard.Values[Slot];
+	}
+
+	void FEdgeHashMap::Add(const uint64 Key, const int32 InValue)
+	{
+		bool bIsNew = false;
+		FindOrAdd(Key, InValue, bIsNew) = InValue;
+	}
+
+	int32 FEdgeHashMap::InsertUnique(const TArrayView<const uint64> InKeys, const int32 InFirstValue, TArray<int32>& OutNewKeys)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FEdgeHashMap::InsertUnique);
+
+		const int32 NumKeys = InKeys.Num();
+
+		OutNewKeys.Reset(NumKeys);
+		if (!NumKeys) { return 0; }
+
+		Reserve(NumItems + NumKeys);
+
+		const int32 NumShards = Shards.Num();
+
+		if (NumShards == 1 || NumKeys < EdgeHashMap::ParallelThreshold)
+		{
+			int32 NextValue = InFirstValue;
+			for (int i = 0; i < NumKeys; i++)
+			{
+				bool bIsNew = false;
+				FindOrAdd(InKeys[i], NextValue, bIsNew);
+				if (bIsNew)
+				{
+					OutNewKeys.Add(i);
+					NextValue++;
+				}
+			}
+
+			return OutNewKeys.Num();
+		}
+
+		// Stable bucketing of batch indices per shard, so first occurrences win within each shard
+
+		TArray<uint64> Hashes;
+		Hashes.SetNumUninitialized(NumKeys);
+
+		TArray<int32> ShardStarts;
+		ShardStarts.Init(0, NumShards + 1);
+
+		for (int i = 0; i < NumKeys; i++)
+		{
+			const uint64 H = Mix(InKeys[i]);
+			Hashes[i] = H;
+			ShardStarts[GetShardIndex(H) + 1]++;
+		}
+
+		for (int s = 0; s < NumShards; s++) { ShardStarts[s + 1] += ShardStarts[s]; }
+
+		TArray<int32> Order;
+		Order.SetNumUninitialized(NumKeys);
+
+		{
+			TArray<int32> Cursors(ShardStarts.GetData(), NumShards);
+			for (int i = 0; i < NumKeys; i++) { Order[Cursors[GetShardIndex(Hashes[i])]++] = i; }
+		}
+
+		TArray<int8> IsNew;
+		IsNew.SetNumZeroed(NumKeys);
+
+		// Slots inserted during the parallel pass temporarily store the batch index as value
+		TArray<TArray<int32>> NewSlots;
+		NewSlots.SetNum(NumShards);
+
+		ParallelFor(
+			NumShards, [&](const int32 ShardIndex)
+			{
+				const int32 Start = ShardStarts[ShardIndex];
+				const int32 End = ShardStarts[ShardIndex + 1];
+				if (Start == End) { return; }
+
+				FShard& Shard = Shards[ShardIndex];
+				Shard.Reserve(Shard.Num + (End - Start));
+
+				TArray<int32>& Slots = NewSlots[ShardIndex];
+
+				for (int j = Start; j < End; j++)
+				{
+					const int32 i = Order[j];
+					bool bIsNew = false;
+					const int32 Slot = Shard.FindOrAddSlot(InKeys[i], Hashes[i], i, bIsNew);
+					if (bIsNew)
+					{
+						IsNew[i] = 1;
+						Slots.Add(Slot);
+					}
+				}
+			});
+
+		// Assign final values in batch order; Order is recycled as batch index -> value
+		int32 NextValue = InFirstValue;
+		for (int i = 0; i < NumKeys; i++)
+		{
+			if (!IsNew[i]) { continue; }
+			Order[i] = NextValue++;
+			OutNewKeys.Add(i);
+		}
+
+		ParallelFor(
+			NumShards, [&](const int32 ShardIndex)
+			{
+				FShard& Shard = Shards[ShardIndex];
+				for (const int32 Slot : NewSlots[ShardIndex]) { Shard.Values[Slot] = Order[Shard.Values[Slot]]; }
+			});
+
+		NumItems += OutNewKeys.Num();
+		return OutNewKeys.Num();
+	}
+}
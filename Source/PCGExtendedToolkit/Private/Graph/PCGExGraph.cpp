@@ -554,8 +554,11 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 				const FGraphEdgeMetadata* EdgeMeta = ParentGraph->FindEdgeMetadata_Unsafe(E.IOIndex);
 				if (const FGraphEdgeMetadata* RootEdgeMeta = EdgeMeta ? ParentGraph->FindEdgeMetadata_Unsafe(EdgeMeta->RootIndex) : nullptr)
 				{
-					if (TSharedPtr<PCGExData::IUnionData> UnionData = ParentGraph->EdgesUnion->Get(RootEdgeMeta->RootIndex);
-						UnionBlender && UnionData) { UnionBlender->MergeSingle(EdgeIndex, UnionData, WeightedPoints, Trackers); }
+					if (UnionBlender)
+					{
+						if (const TConstArrayView<PCGExData::FElement> UnionElements = ParentGraph->EdgesUnion->GetElements(RootEdgeMeta->RootIndex);
+							!UnionElements.IsEmpty()) { UnionBlender->MergeSingle(EdgeIndex, UnionElements, WeightedPoints, Trackers); }
+					}
 
 					// TODO : Add Sub-edge edge (is the result of a subdivision + merge)
 
@@ -632,15 +635,16 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 	{
 		check(A != B)
 
-		const uint64 Hash = PCGEx::H64U(A, B);
-		if (const int32* EdgeIndex = UniqueEdges.Find(Hash))
+		bool bIsNew = false;
+		const int32 EdgeIndex = UniqueEdges.FindOrAdd(PCGEx::H64U(A, B), Edges.Num(), bIsNew);
+
+		if (!bIsNew)
 		{
-			OutEdge.Index = *EdgeIndex;
+			OutEdge.Index = EdgeIndex;
 			return false;
 		}
 
-		OutEdge = Edges.Emplace_GetRef(Edges.Num(), A, B, -1, IOIndex);
-		UniqueEdges.Add(Hash, (OutEdge.Index = Edges.Num() - 1));
+		OutEdge = Edges.Emplace_GetRef(EdgeIndex, A, B, -1, IOIndex);
 
 		Nodes[A].LinkEdge(OutEdge.Index);
 		Nodes[B].LinkEdge(OutEdge.Index);
@@ -656,11 +660,12 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 
 	bool FGraph::InsertEdge_Unsafe(const FEdge& Edge)
 	{
-		uint64 H = Edge.H64U();
-		if (UniqueEdges.Contains(H)) { return false; }
+		bool bIsNew = false;
+		UniqueEdges.FindOrAdd(Edge.H64U(), Edges.Num(), bIsNew);
+		if (!bIsNew) { return false; }
 
 		FEdge& NewEdge = Edges.Emplace_GetRef(Edge);
-		UniqueEdges.Add(H, (NewEdge.Index = Edges.Num() - 1));
+		NewEdge.Index = Edges.Num() - 1;
 
 		Nodes[Edge.Start].LinkEdge(NewEdge.Index);
 		Nodes[Edge.End].LinkEdge(NewEdge.Index);
@@ -689,28 +694,32 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 		TRACE_CPUPROFILER_EVENT_SCOPE(FGraph::InsertEdges)
 
 		FWriteScopeLock WriteLock(GraphLock);
+		InsertEdgeHashes_Unsafe(InEdges, InIOIndex);
+	}
+
+	void FGraph::InsertEdgeHashes_Unsafe(const TArray<uint64>& InEdges, const int32 InIOIndex)
+	{
+		// Deduplication runs wide over the hash map shards, only node linking remains serial
+		TArray<int32> NewEdges;
+		const int32 StartIndex = Edges.Num();
+		UniqueEdges.InsertUnique(InEdges, StartIndex, NewEdges);
+
+		Edges.Reserve(StartIndex + NewEdges.Num());
+
 		uint32 A;
 		uint32 B;
 
-		UniqueEdges.Reserve(UniqueEdges.Num() + UniqueEdges.Num());
-		Edges.Reserve(Edges.Num() + InEdges.Num());
-
-		for (const uint64 E : InEdges)
+		for (const int32 i : NewEdges)
 		{
-			if (UniqueEdges.Contains(E)) { continue; }
-
-			PCGEx::H64(E, A, B);
+			PCGEx::H64(InEdges[i], A, B);
 
 			check(A != B)
 
 			const int32 EdgeIndex = Edges.Emplace(Edges.Num(), A, B, -1, InIOIndex);
 
-			UniqueEdges.Add(E, EdgeIndex);
 			Nodes[A].LinkEdge(EdgeIndex);
 			Nodes[B].LinkEdge(EdgeIndex);
 		}
-
-		UniqueEdges.Shrink();
 	}
 
 	int32 FGraph::InsertEdges(const TArray<FEdge>& InEdges)
@@ -720,10 +729,25 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 		FWriteScopeLock WriteLock(GraphLock);
 		const int32 StartIndex = Edges.Num();
 
-		UniqueEdges.Reserve(UniqueEdges.Num() + InEdges.Num());
-		Edges.Reserve(Edges.Num() + InEdges.Num());
+		TArray<uint64> Hashes;
+		Hashes.SetNumUninitialized(InEdges.Num());
+		for (int i = 0; i < InEdges.Num(); i++) { Hashes[i] = InEdges[i].H64U(); }
+
+		TArray<int32> NewEdges;
+		UniqueEdges.InsertUnique(Hashes, StartIndex, NewEdges);
+
+		Edges.Reserve(StartIndex + NewEdges.Num());
+
+		for (const int32 i : NewEdges)
+		{
+			const FEdge& E = InEdges[i];
+			FEdge& NewEdge = Edges.Emplace_GetRef(E);
+			NewEdge.Index = Edges.Num() - 1;
+
+			Nodes[E.Start].LinkEdge(NewEdge.Index);
+			Nodes[E.End].LinkEdge(NewEdge.Index);
+		}
 
-		for (const FEdge& E : InEdges) { InsertEdge_Unsafe(E); }
 		return StartIndex;
 	}
 
@@ -766,22 +790,7 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 
 	void FGraph::InsertEdges_Unsafe(const TSet<uint64>& InEdges, const int32 InIOIndex)
 	{
-		uint32 A;
-		uint32 B;
-		for (const uint64& E : InEdges)
-		{
-			if (UniqueEdges.Contains(E)) { continue; }
-
-			PCGEx::H64(E, A, B);
-
-			check(A != B)
-
-			const int32 EdgeIndex = Edges.Emplace(Edges.Num(), A, B);
-			UniqueEdges.Add(E, EdgeIndex);
-			Nodes[A].LinkEdge(EdgeIndex);
-			Nodes[B].LinkEdge(EdgeIndex);
-			Edges[EdgeIndex].IOIndex = InIOIndex;
-		}
+		InsertEdgeHashes_Unsafe(InEdges.Array(), InIOIndex);
 	}
 
 	void FGraph::InsertEdges(const TSet<uint64>& InEdges, const int32 InIOIndex)
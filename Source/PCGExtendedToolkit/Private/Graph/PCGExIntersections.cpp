@@ -20,18 +20,17 @@ namespace PCGExGraph
 	FUnionNode::FUnionNode(const PCGExData::FConstPoint& InPoint, const FVector& InCenter, const int32 InIndex)
 		: Point(InPoint), Center(InCenter), Index(InIndex)
 	{
-		Adjacency.Empty();
 		Bounds = FBoxSphereBounds(InPoint.Data->GetLocalBounds(InPoint.Index).TransformBy(InPoint.Data->GetTransform(InPoint.Index)));
 	}
 
 	FVector FUnionNode::UpdateCenter(const TSharedPtr<PCGExData::FUnionMetadata>& InUnionMetadata, const TSharedPtr<PCGExData::FPointIOCollection>& IOGroup)
 	{
 		Center = FVector::ZeroVector;
-		const TSharedPtr<PCGExData::IUnionData> UnionData = InUnionMetadata->Get(Index);
+		const TConstArrayView<PCGExData::FElement> Elements = InUnionMetadata->GetElements(Index);
 
-		const double Divider = UnionData->Elements.Num();
+		const double Divider = Elements.Num();
 
-		for (const PCGExData::FElement& H : UnionData->Elements)
+		for (const PCGExData::FElement& H : Elements)
 		{
 			Center += IOGroup->Pairs[H.IO]->GetIn()->GetTransform(H.Index).GetLocation();
 		}
@@ -40,10 +39,36 @@ namespace PCGExGraph
 		return Center;
 	}
 
-	void FUnionNode::Add(const int32 InAdjacency)
+	void FUnionNodeShard::Reserve(const int32 InReserve)
 	{
-		FWriteScopeLock WriteScopeLock(AdjacencyLock);
-		Adjacency.Add(InAdjacency);
+		Cells.Reserve(InReserve);
+		Indices.Reserve(InReserve);
+		Points.Reserve(InReserve);
+		Elements.Reserve(InReserve);
+	}
+
+	void FUnionNodeShard::Empty()
+	{
+		Cells.Empty();
+		Indices.Empty();
+		Points.Empty();
+		Elements.Empty();
+	}
+
+	void FUnionEdgeShard::Reserve(const int32 InReserve)
+	{
+		Lookup.Reserve(InReserve);
+		Edges.Reserve(InReserve);
+		UnionSizes.Reserve(InReserve);
+		Elements.Reserve(InReserve);
+	}
+
+	void FUnionEdgeShard::Empty()
+	{
+		Lookup.Empty();
+		Edges.Empty();
+		UnionSizes.Empty();
+		Elements.Empty();
 	}
 
 	FUnionGraph::FUnionGraph(const FPCGExFuseDetails& InFuseDetails, const FBox& InBounds)
@@ -55,9 +80,18 @@ namespace PCGExGraph
 		NodesUnion = MakeShared<PCGExData::FUnionMetadata>();
 		EdgesUnion = MakeShared<PCGExData::FUnionMetadata>();
 
+		EdgeShards.SetNum(NumUnionShards);
+
 		if (InFuseDetails.FuseMethod == EPCGExFuseMethod::Octree)
 		{
-			Octree = MakeUnique<FUnionNodeOctree>(Bounds.GetCenter(), Bounds.GetExtent().Length() + 10);
+			// Octree fusing needs a global view of existing nodes, those are written straight to the flat pool
+			// A single shard is kept to collect union members
+			Octree = MakeUnique<PCGExOctree::FItemOctree>(Bounds.GetCenter(), Bounds.GetExtent().Length() + 10);
+			NodeShards.SetNum(1);
+		}
+		else
+		{
+			NodeShards.SetNum(NumUnionShards);
 		}
 	}
 
@@ -75,165 +109,103 @@ namespace PCGExGraph
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FUnionGraph::Reserve);
 
-		Nodes.Reserve(NodeReserve);
-		NodesUnion->Entries.Reserve(NodeReserve);
-
-		if (EdgeReserve < 0)
+		if (Octree)
 		{
-			Edges.Reserve(NodeReserve);
-			EdgesUnion->Entries.Reserve(NodeReserve);
+			Nodes.Reserve(NodeReserve);
+			NodeShards[0].Elements.Reserve(NodeReserve);
 		}
 		else
 		{
-			Edges.Reserve(EdgeReserve);
-			EdgesUnion->Entries.Reserve(EdgeReserve);
+			const int32 ShardReserve = NodeReserve / NumUnionShards + 1;
+			for (FUnionNodeShard& Shard : NodeShards) { Shard.Reserve(ShardReserve); }
 		}
+
+		const int32 ShardReserve = (EdgeReserve < 0 ? NodeReserve : EdgeReserve) / NumUnionShards + 1;
+		for (FUnionEdgeShard& Shard : EdgeShards) { Shard.Reserve(ShardReserve); }
 	}
 
 	int32 FUnionGraph::NumNodes() const
 	{
-		return NodesUnion->Num();
+		return bShardsMerged ? NodesUnion->Num() : NodeCount;
 	}
 
 	int32 FUnionGraph::NumEdges() const
 	{
-		return EdgesUnion->Num();
+		return bShardsMerged ? EdgesUnion->Num() : EdgeCount;
 	}
 
-	TSharedPtr<FUnionNode> FUnionGraph::InsertPoint(const PCGExData::FConstPoint& Point)
+	int32 FUnionGraph::InsertPoint(const PCGExData::FConstPoint& Point)
 	{
 		const FVector Origin = Point.GetLocation();
 
-		TSharedPtr<FUnionNode> Node;
-
-		if (!Octree)
+		if (Octree)
 		{
-			const uint64 GridKey = FuseDetails.GetGridKey(Origin, Point.Index);
-			TSharedPtr<FUnionNode>* NodePtr;
-
-			{
-				FReadScopeLock ReadScopeLock(UnionLock);
-				NodePtr = GridTree.Find(GridKey);
-
-
-				if (NodePtr)
-				{
-					Node = *NodePtr;
-					NodesUnion->Append(Node->Index, Point);
-					return Node;
-				}
-			}
-
-			{
-				FWriteScopeLock WriteLock(UnionLock);
-				NodePtr = GridTree.Find(GridKey); // Make sure there hasn't been an insert while locking
-
-				if (NodePtr)
-				{
-					Node = *NodePtr;
-					NodesUnion->Append(Node->Index, Point);
-					return Node;
-				}
-
-				Node = MakeShared<FUnionNode>(Point, Origin, Nodes.Num());
-				Nodes.Add(Node);
-				NodesUnion->NewEntry_Unsafe(Point);
-				GridTree.Add(GridKey, Node);
-			}
-
-			return Node;
+			FWriteScopeLock WriteScopeLock(UnionLock);
+			return InsertPointOctree(Point, Origin);
 		}
 
-		{
-			// Write lock starts
-			FWriteScopeLock WriteScopeLock(UnionLock);
+		const uint64 GridKey = FuseDetails.GetGridKey(Origin, Point.Index);
+		FUnionNodeShard& Shard = NodeShards[GetUnionShard(GridKey)];
 
-			PCGExMath::FClosestPosition ClosestNode(Origin);
+		// Every insertion appends a union member, so there is no read-only path
+		FWriteScopeLock WriteLock(Shard.Lock);
 
-			if (FuseDetails.bComponentWiseTolerance)
-			{
-				Octree->FindElementsWithBoundsTest(
-					FuseDetails.GetOctreeBox(Origin, Point.Index), [&](const FUnionNode* ExistingNode)
-					{
-						if (FuseDetails.IsWithinToleranceComponentWise(Point, ExistingNode->Point))
-						{
-							ClosestNode.Update(ExistingNode->Center, ExistingNode->Index);
-							return false;
-						}
-						return true;
-					});
-			}
-			else
-			{
-				Octree->FindElementsWithBoundsTest(
-					FuseDetails.GetOctreeBox(Origin, Point.Index), [&](const FUnionNode* ExistingNode)
-					{
-						if (FuseDetails.IsWithinTolerance(Point, ExistingNode->Point))
-						{
-							ClosestNode.Update(ExistingNode->Center, ExistingNode->Index);
-							return false;
-						}
-						return true;
-					});
-			}
-
-			if (ClosestNode.bValid)
-			{
-				NodesUnion->Append(ClosestNode.Index, Point);
-				return Nodes[ClosestNode.Index];
-			}
-
-			// Write lock ends
+		if (const int32* LocalIndex = Shard.Cells.Find(GridKey))
+		{
+			const int32 NodeIndex = Shard.Indices[*LocalIndex];
+			Shard.Elements.Emplace(NodeIndex, Point.Index, Point.IO);
+			return NodeIndex;
 		}
 
-		{
-			// Write lock start
-			FWriteScopeLock WriteScopeLock(UnionLock);
+		const int32 NodeIndex = FPlatformAtomics::InterlockedAdd(&NodeCount, 1);
 
-			Node = MakeShared<FUnionNode>(Point, Origin, Nodes.Num());
-			Nodes.Add(Node);
-			Octree->AddElement(Node.Get());
-			NodesUnion->NewEntry_Unsafe(Point);
-		}
+		Shard.Cells.Add(GridKey, Shard.Indices.Num());
+		Shard.Indices.Add(NodeIndex);
+		Shard.Points.Add(Point);
+		Shard.Elements.Emplace(NodeIndex, Point.Index, Point.IO);
 
-		return Node;
+		return NodeIndex;
 	}
 
-	TSharedPtr<FUnionNode> FUnionGraph::InsertPoint_Unsafe(const PCGExData::FConstPoint& Point)
+	int32 FUnionGraph::InsertPoint_Unsafe(const PCGExData::FConstPoint& Point)
 	{
 		const FVector Origin = Point.GetLocation();
 
-		TSharedPtr<FUnionNode> Node;
+		if (Octree) { return InsertPointOctree(Point, Origin); }
 
-		if (!Octree)
+		const uint64 GridKey = FuseDetails.GetGridKey(Origin, Point.Index);
+		FUnionNodeShard& Shard = NodeShards[GetUnionShard(GridKey)];
+
+		if (const int32* LocalIndex = Shard.Cells.Find(GridKey))
 		{
-			const uint64 GridKey = FuseDetails.GetGridKey(Origin, Point.Index);
+			const int32 NodeIndex = Shard.Indices[*LocalIndex];
+			Shard.Elements.Emplace(NodeIndex, Point.Index, Point.IO);
+			return NodeIndex;
+		}
 
-			if (TSharedPtr<FUnionNode>* NodePtr = GridTree.Find(GridKey))
-			{
-				Node = *NodePtr;
-				NodesUnion->Append_Unsafe(Node->Index, Point);
-				return Node;
-			}
+		const int32 NodeIndex = NodeCount++;
 
-			Node = MakeShared<FUnionNode>(Point, Origin, Nodes.Num());
-			Nodes.Add(Node);
-			NodesUnion->NewEntry_Unsafe(Point);
-			GridTree.Add(GridKey, Node);
+		Shard.Cells.Add(GridKey, Shard.Indices.Num());
+		Shard.Indices.Add(NodeIndex);
+		Shard.Points.Add(Point);
+		Shard.Elements.Emplace(NodeIndex, Point.Index, Point.IO);
 
-			return Node;
-		}
+		return NodeIndex;
+	}
 
+	int32 FUnionGraph::InsertPointOctree(const PCGExData::FConstPoint& Point, const FVector& Origin)
+	{
 		PCGExMath::FClosestPosition ClosestNode(Origin);
 
 		if (FuseDetails.bComponentWiseTolerance)
 		{
 			Octree->FindElementsWithBoundsTest(
-				FuseDetails.GetOctreeBox(Origin, Point.Index), [&](const FUnionNode* ExistingNode)
+				FuseDetails.GetOctreeBox(Origin, Point.Index), [&](const PCGExOctree::FItem& Item)
 				{
-					if (FuseDetails.IsWithinToleranceComponentWise(Point, ExistingNode->Point))
+					const FUnionNode& ExistingNode = Nodes[Item.Index];
+					if (FuseDetails.IsWithinToleranceComponentWise(Point, ExistingNode.Point))
 					{
-						ClosestNode.Update(ExistingNode->Center, ExistingNode->Index);
+						ClosestNode.Update(ExistingNode.Center, ExistingNode.Index);
 						return false;
 					}
 					return true;
@@ -242,11 +214,12 @@ namespace PCGExGraph
 		else
 		{
 			Octree->FindElementsWithBoundsTest(
-				FuseDetails.GetOctreeBox(Origin, Point.Index), [&](const FUnionNode* ExistingNode)
+				FuseDetails.GetOctreeBox(Origin, Point.Index), [&](const PCGExOctree::FItem& Item)
 				{
-					if (FuseDetails.IsWithinTolerance(Point, ExistingNode->Point))
+					const FUnionNode& ExistingNode = Nodes[Item.Index];
+					if (FuseDetails.IsWithinTolerance(Point, ExistingNode.Point))
 					{
-						ClosestNode.Update(ExistingNode->Center, ExistingNode->Index);
+						ClosestNode.Update(ExistingNode.Center, ExistingNode.Index);
 						return false;
 					}
 					return true;
@@ -255,141 +228,141 @@ namespace PCGExGraph
 
 		if (ClosestNode.bValid)
 		{
-			NodesUnion->Append_Unsafe(ClosestNode.Index, Point);
-			return Nodes[ClosestNode.Index];
+			NodeShards[0].Elements.Emplace(ClosestNode.Index, Point.Index, Point.IO);
+			return ClosestNode.Index;
 		}
 
-		Node = MakeShared<FUnionNode>(Point, Origin, Nodes.Num());
-		Nodes.Add(Node);
-		Octree->AddElement(Node.Get());
-		NodesUnion->NewEntry_Unsafe(Point);
+		const int32 NodeIndex = NodeCount++;
+
+		const FUnionNode& Node = Nodes.Emplace_GetRef(Point, Origin, NodeIndex);
+		Octree->AddElement(PCGExOctree::FItem(NodeIndex, Node.Bounds));
+		NodeShards[0].Elements.Emplace(NodeIndex, Point.Index, Point.IO);
 
-		return Node;
+		return NodeIndex;
 	}
 
-	TSharedPtr<PCGExData::IUnionData> FUnionGraph::InsertEdge(const PCGExData::FConstPoint& From, const PCGExData::FConstPoint& To, const PCGExData::FConstPoint& Edge)
+	int32 FUnionGraph::InsertEdge(const PCGExData::FConstPoint& From, const PCGExData::FConstPoint& To, const PCGExData::FConstPoint& Edge)
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(IUnionData::InsertEdge);
+		TRACE_CPUPROFILER_EVENT_SCOPE(FUnionGraph::InsertEdge);
 
-		const TSharedPtr<FUnionNode> StartVtx = InsertPoint(From);
-		const TSharedPtr<FUnionNode> EndVtx = InsertPoint(To);
+		const int32 StartIndex = InsertPoint(From);
+		const int32 EndIndex = InsertPoint(To);
 
-		if (StartVtx == EndVtx) { return nullptr; } // Edge got fused entirely
+		if (StartIndex == EndIndex) { return -1; } // Edge got fused entirely
 
-		StartVtx->Add(EndVtx->Index);
-		EndVtx->Add(StartVtx->Index);
+		const uint64 H = PCGEx::H64U(StartIndex, EndIndex);
+		FUnionEdgeShard& Shard = EdgeShards[GetUnionShard(H)];
 
-		TSharedPtr<PCGExData::IUnionData> EdgeUnion;
-
-		const uint64 H = PCGEx::H64U(StartVtx->Index, EndVtx->Index);
+		FWriteScopeLock WriteLockEdges(Shard.Lock);
+		return InsertEdgeInShard_Unsafe(Shard, H, StartIndex, EndIndex, Edge, true);
+	}
 
-		{
-			FReadScopeLock ReadLockEdges(EdgesLock);
-			if (const FEdge* ExistingEdge = Edges.Find(H))
-			{
-				EdgeUnion = EdgesUnion->Entries[ExistingEdge->Index];
-			}
+	int32 FUnionGraph::InsertEdge_Unsafe(const PCGExData::FConstPoint& From, const PCGExData::FConstPoint& To, const PCGExData::FConstPoint& Edge)
+	{
+		const int32 StartIndex = InsertPoint_Unsafe(From);
+		const int32 EndIndex = InsertPoint_Unsafe(To);
 
-			if (EdgeUnion)
-			{
-				// Abstract tracking to get valid union data
-				if (Edge.IO == -1) { EdgeUnion->Add(EdgeUnion->Num(), -1); }
-				else { EdgeUnion->Add(Edge); }
+		if (StartIndex == EndIndex) { return -1; } // Edge got fused entirely
 
-				return EdgeUnion;
-			}
-		}
+		const uint64 H = PCGEx::H64U(StartIndex, EndIndex);
+		return InsertEdgeInShard_Unsafe(EdgeShards[GetUnionShard(H)], H, StartIndex, EndIndex, Edge, false);
+	}
 
+	int32 FUnionGraph::InsertEdgeInShard_Unsafe(FUnionEdgeShard& Shard, const uint64 H, const int32 StartIndex, const int32 EndIndex, const PCGExData::FConstPoint& Edge, const bool bAtomic)
+	{
+		if (const int32* LocalIndex = Shard.Lookup.Find(H))
 		{
-			FWriteScopeLock WriteLockEdges(EdgesLock);
+			const int32 EdgeIndex = Shard.Edges[*LocalIndex].Index;
+			int32& UnionSize = Shard.UnionSizes[*LocalIndex];
 
-			if (const FEdge* ExistingEdge = Edges.Find(H)) { EdgeUnion = EdgesUnion->Entries[ExistingEdge->Index]; }
+			// Abstract edge management, so we have some valid metadata even tho there are no valid input edges
+			// So EdgeIOIndex will be invalid, be we can still track union data
+			if (Edge.IO == -1) { Shard.Elements.Emplace(EdgeIndex, UnionSize, -1); }
+			else { Shard.Elements.Emplace(EdgeIndex, Edge.Index, Edge.IO); }
 
-			if (EdgeUnion)
-			{
-				// Abstract tracking to get valid union data
-				if (Edge.IO == -1) { EdgeUnion->Add(EdgeUnion->Num(), -1); }
-				else { EdgeUnion->Add(Edge); }
+			UnionSize++;
+			return EdgeIndex;
+		}
 
-				return EdgeUnion;
-			}
+		const int32 EdgeIndex = bAtomic ? FPlatformAtomics::InterlockedAdd(&EdgeCount, 1) : EdgeCount++;
 
-			EdgeUnion = EdgesUnion->NewEntry_Unsafe(Edge);
-			Edges.Add(H, FEdge(Edges.Num(), StartVtx->Index, EndVtx->Index));
-		}
+		Shard.Lookup.Add(H, Shard.Edges.Num());
+		Shard.Edges.Emplace(EdgeIndex, StartIndex, EndIndex);
+		Shard.UnionSizes.Add(1);
 
-		return EdgeUnion;
+		// Abstract edges are force-initialized at item index 0
+		Shard.Elements.Emplace(EdgeIndex, Edge.IO == -1 ? 0 : Edge.Index, Edge.IO);
+
+		return EdgeIndex;
 	}
 
-	TSharedPtr<PCGExData::IUnionData> FUnionGraph::InsertEdge_Unsafe(const PCGExData::FConstPoint& From, const PCGExData::FConstPoint& To, const PCGExData::FConstPoint& Edge)
+	void FUnionGraph::MergeShards()
 	{
-		const TSharedPtr<FUnionNode> StartVtx = InsertPoint_Unsafe(From);
-		const TSharedPtr<FUnionNode> EndVtx = InsertPoint_Unsafe(To);
-
-		if (StartVtx == EndVtx) { return nullptr; } // Edge got fused entirely
+		if (bShardsMerged) { return; }
+		bShardsMerged = true;
 
-		StartVtx->Adjacency.Add(EndVtx->Index);
-		EndVtx->Adjacency.Add(StartVtx->Index);
+		TRACE_CPUPROFILER_EVENT_SCOPE(FUnionGraph::MergeShards)
 
-		const uint64 H = PCGEx::H64U(StartVtx->Index, EndVtx->Index);
-		TSharedPtr<PCGExData::IUnionData> EdgeUnion;
+		// Node & edge indices are handed out at insertion time, so merging is a plain scatter with no remapping.
 
-		if (Edge.IO == -1)
+		if (!Octree)
 		{
-			// Abstract edge management, so we have some valid metadata even tho there are no valid input edges
-			// So EdgeIOIndex will be invalid, be we can still track union data
-			if (const FEdge* ExistingEdge = Edges.Find(H))
-			{
-				EdgeUnion = EdgesUnion->Entries[ExistingEdge->Index];
-				EdgeUnion->Add_Unsafe(EdgeUnion->Num(), -1);
-			}
-			else
-			{
-				// TODO : Need to look into this, apprently we want NewEntry to be force-initialized at ItemIndex 0
-				// Which is weird, the Safe version of that same method isn't doing this.
-				PCGExData::FConstPoint NewEdge(Edge);
-				NewEdge.Index = -1; // Force entry index to use index 0
+			Nodes.Reset(NodeCount);
+			Nodes.AddUninitialized(NodeCount);
 
-				EdgeUnion = EdgesUnion->NewEntry_Unsafe(NewEdge);
-				Edges.Add(H, FEdge(Edges.Num(), StartVtx->Index, EndVtx->Index));
-			}
+			ParallelFor(
+				NumUnionShards, [&](const int32 ShardIndex)
+				{
+					const FUnionNodeShard& Shard = NodeShards[ShardIndex];
+					for (int i = 0; i < Shard.Indices.Num(); i++)
+					{
+						const int32 NodeIndex = Shard.Indices[i];
+						const PCGExData::FConstPoint& Point = Shard.Points[i];
+						new(Nodes.GetData() + NodeIndex) FUnionNode(Point, Point.GetLocation(), NodeIndex);
+					}
+				});
 		}
-		else
+
+		// A node or an edge only ever lives in a single shard, so each shard is a valid chunk for the flat union build
 		{
-			// Concrete edge management, we have valild input edges			
-			if (const FEdge* ExistingEdge = Edges.Find(H))
-			{
-				EdgeUnion = EdgesUnion->Entries[ExistingEdge->Index];
-				EdgeUnion->Add_Unsafe(Edge);
-			}
-			else
+			TArray<TConstArrayView<PCGExData::FUnionElement>> Chunks;
+			Chunks.Reserve(NodeShards.Num());
+			for (const FUnionNodeShard& Shard : NodeShards) { Chunks.Add(Shard.Elements); }
+			NodesUnion->BuildFlat(NodeCount, Chunks);
+		}
+
+		NodeShards.Empty();
+
+		Edges.SetNumUninitialized(EdgeCount);
+
+		ParallelFor(
+			NumUnionShards, [&](const int32 ShardIndex)
 			{
-				EdgeUnion = EdgesUnion->NewEntry_Unsafe(Edge);
-				Edges.Add(H, FEdge(Edges.Num(), StartVtx->Index, EndVtx->Index));
-			}
+				for (const FEdge& E : EdgeShards[ShardIndex].Edges) { Edges[E.Index] = E; }
+			});
+
+		{
+			TArray<TConstArrayView<PCGExData::FUnionElement>> Chunks;
+			Chunks.Reserve(EdgeShards.Num());
+			for (const FUnionEdgeShard& Shard : EdgeShards) { Chunks.Add(Shard.Elements); }
+			EdgesUnion->BuildFlat(EdgeCount, Chunks);
 		}
 
-		return EdgeUnion;
+		EdgeShards.Empty();
 	}
 
 	void FUnionGraph::GetUniqueEdges(TSet<uint64>& OutEdges)
 	{
-		OutEdges.Empty(Nodes.Num() * 4);
-		for (const TSharedPtr<FUnionNode>& Node : Nodes)
-		{
-			for (const int32 OtherNodeIndex : Node->Adjacency)
-			{
-				const uint64 Hash = PCGEx::H64U(Node->Index, OtherNodeIndex);
-				OutEdges.Add(Hash);
-			}
-		}
+		MergeShards();
+
+		OutEdges.Empty(Edges.Num());
+		for (const FEdge& E : Edges) { OutEdges.Add(E.H64U()); }
 	}
 
 	void FUnionGraph::GetUniqueEdges(TArray<FEdge>& OutEdges)
 	{
-		const int32 NumEdges = Edges.Num();
-		OutEdges.SetNumUninitialized(NumEdges);
-		for (const TPair<uint64, FEdge>& Pair : Edges) { OutEdges[Pair.Value.Index] = Pair.Value; }
+		MergeShards();
+		OutEdges = Edges;
 	}
 
 	void FUnionGraph::WriteNodeMetadata(const TSharedPtr<FGraph>& InGraph) const
@@ -398,11 +371,10 @@ namespace PCGExGraph
 
 		InGraph->NodeMetadata.Reserve(Nodes.Num());
 
-		for (const TSharedPtr<FUnionNode>& Node : Nodes)
+		for (const FUnionNode& Node : Nodes)
 		{
-			const TSharedPtr<PCGExData::IUnionData>& UnionData = NodesUnion->Entries[Node->Index];
-			FGraphNodeMetadata& NodeMeta = InGraph->GetOrCreateNodeMetadata_Unsafe(Node->Index);
-			NodeMeta.UnionSize = UnionData->Num();
+			FGraphNodeMetadata& NodeMeta = InGraph->GetOrCreateNodeMetadata_Unsafe(Node.Index);
+			NodeMeta.UnionSize = NodesUnion->GetNumElements(Node.Index);
 		}
 	}
 
@@ -415,19 +387,9 @@ namespace PCGExGraph
 
 		for (int i = 0; i < NumEdges; i++)
 		{
-			const TSharedPtr<PCGExData::IUnionData>& UnionData = EdgesUnion->Entries[i];
 			FGraphEdgeMetadata& EdgeMetadata = InGraph->GetOrCreateEdgeMetadata_Unsafe(i);
-			EdgeMetadata.UnionSize = UnionData->Num();
-		}
-		/*
-		for (const TPair<uint64, FIndexedEdge>& Pair : Edges)
-		{
-			const int32 Index = Pair.Value.EdgeIndex;
-			const TUniquePtr<PCGExData::IUnionData>& UnionData = EdgesUnion->Items[Index];
-			FGraphEdgeMetadata& EdgeMetadata = FGraphEdgeMetadata::GetOrCreate(Index, nullptr, OutMetadata);
-			EdgeMetadata.UnionSize = UnionData->Num();
+			EdgeMetadata.UnionSize = EdgesUnion->GetNumElements(i);
 		}
-		*/
 	}
 
 	FIntersectionCache::FIntersectionCache(const TSharedPtr<FGraph>& InGraph, const TSharedPtr<PCGExData::FPointIO>& InPointIO)
@@ -648,7 +610,8 @@ namespace PCGExGraph
 		FPESplit Split = FPESplit{};
 
 		const int32 EdgeRootIndex = InIntersections->Graph->FindEdgeMetadataRootIndex_Unsafe(EdgeProxy->Index);
-		const TSet<int32>& RootIOIndices = Graph->EdgesUnion->Entries[EdgeRootIndex]->IOSet;
+		TSet<int32> RootIOIndices;
+		Graph->EdgesUnion->GetIOSet(EdgeRootIndex, RootIOIndices);
 
 		InIntersections->PointIO->GetOutIn()->GetPointOctree().FindElementsWithBoundsTest(
 			EdgeProxy->Box,
@@ -909,7 +872,8 @@ namespace PCGExGraph
 
 		const int32 RootIndex = InIntersections->Graph->FindEdgeMetadata_Unsafe(GraphIndex)->RootIndex;
 		TSharedPtr<PCGExData::FUnionMetadata> EdgesUnion = InIntersections->Graph->EdgesUnion;
-		const TSet<int32>& RootIOIndices = EdgesUnion->Entries[RootIndex]->IOSet;
+		TSet<int32> RootIOIndices;
+		EdgesUnion->GetIOSet(RootIndex, RootIOIndices);
 
 		InIntersections->Octree->FindElementsWithBoundsTest(
 			EdgeProxy->Box,
@@ -58,6 +58,8 @@ namespace PCGExGraph
 	{
 		BuilderDetails = InBuilderDetails;
 
+		UnionGraph->MergeShards();
+
 		const int32 NumUnionNodes = UnionGraph->Nodes.Num();
 		if (NumUnionNodes == 0)
 		{
@@ -108,7 +110,7 @@ namespace PCGExGraph
 
 				PCGEX_SCOPE_LOOP(Index)
 				{
-					TSharedPtr<FUnionNode> UnionNode = This->UnionGraph->Nodes[Index];
+					FUnionNode& UnionNode = This->UnionGraph->Nodes[Index];
 
 					//const PCGMetadataEntryKey Key = OutPoints[i].MetadataEntry;
 					//OutPoints[Index] = UnionNode->Point; // Copy "original" point properties, in case  there's only one
@@ -116,7 +118,7 @@ namespace PCGExGraph
 					//FPCGPoint& Point = OutPoints[Index];
 					//Point.MetadataEntry = Key; // Restore key
 
-					OutTransforms[Index].SetLocation(UnionNode->UpdateCenter(PointsUnion, MainPoints));
+					OutTransforms[Index].SetLocation(UnionNode.UpdateCenter(PointsUnion, MainPoints));
 					Blender->MergeSingle(Index, WeightedPoints, Trackers);
 				}
 			};
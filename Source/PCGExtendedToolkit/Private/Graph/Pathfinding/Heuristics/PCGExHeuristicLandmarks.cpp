@@ -0,0 +1,217 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+
+#include "Graph/Pathfinding/Heuristics/PCGExHeuristicLandmarks.h"
+
+#include "PCGExGlobalSettings.h"
+#include "Data/PCGExPointIO.h"
+#include "Graph/Data/PCGExClusterData.h"
+#include "Graph/Pathfinding/Search/PCGExScoredQueue.h"
+#include "Hash/xxhash.h"
+
+namespace PCGExHeuristics
+{
+	static void ComputeLandmarkDistances(const PCGExCluster::FCluster* InCluster, const int32 InSourceNode, double* OutDistances, PCGExSearch::FScoredQueue& Queue)
+	{
+		const int32 NumNodes = InCluster->Nodes->Num();
+		for (int i = 0; i < NumNodes; i++) { OutDistances[i] = MAX_dbl; }
+
+		Queue.Reset();
+		OutDistances[InSourceNode] = 0;
+		Queue.Enqueue(InSourceNode, 0);
+
+		int32 CurrentNodeIndex;
+		double CurrentScore;
+		while (Queue.Dequeue(CurrentNodeIndex, CurrentScore))
+		{
+			for (const PCGExGraph::FLink Lk : InCluster->GetLinks(CurrentNodeIndex))
+			{
+				const double AltScore = CurrentScore + InCluster->GetDist(static_cast<int32>(Lk.Edge));
+				if (AltScore >= OutDistances[Lk.Node]) { continue; }
+
+				OutDistances[Lk.Node] = AltScore;
+				Queue.Enqueue(Lk.Node, AltScore);
+			}
+		}
+	}
+
+	static uint64 HashNodePositions(const PCGExCluster::FCluster* InCluster)
+	{
+		FXxHash64Builder Builder;
+
+		const int32 NumNodes = InCluster->Nodes->Num();
+		for (int i = 0; i < NumNodes; i++)
+		{
+			const int32 PointIndex = InCluster->GetNodePointIndex(i);
+			const FVector Position = InCluster->GetPos(i);
+			Builder.Update(&PointIndex, sizeof(int32));
+			Builder.Update(&Position, sizeof(FVector));
+		}
+
+		return Builder.Finalize().Hash;
+	}
+
+	bool FLandmarks::Build(const PCGExCluster::FCluster* InCluster, const int32 InNumLandmarks)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExHeuristics::FLandmarks::Build);
+
+		NumRequested = InNumLandmarks;
+		NumNodes = InCluster->Nodes->Num();
+		NumEdges = InCluster->Edges->Num();
+		PositionsHash = HashNodePositions(InCluster);
+		MaxDistance = 0;
+
+		Landmarks.Reset();
+		Distances.Reset();
+
+		if (NumNodes == 0 || InNumLandmarks <= 0) { return false; }
+
+		const int32 MaxLandmarks = FMath::Min(InNumLandmarks, NumNodes);
+		Landmarks.Reserve(MaxLandmarks);
+		Distances.SetNumUninitialized(MaxLandmarks * NumNodes);
+
+		TArray<double> MinDistances;
+		MinDistances.Init(MAX_dbl, NumNodes);
+
+		PCGExSearch::FScoredQueue Queue(NumNodes);
+
+		// First landmark is the node farthest from the cluster center, others use farthest-point selection
+
+		int32 NextLandmark = 0;
+		double BestScore = -1;
+
+		const FVector Center = InCluster->Bounds.GetCenter();
+		for (int i = 0; i < NumNodes; i++)
+		{
+			const double Dist = FVector::DistSquared(InCluster->GetPos(i), Center);
+			if (Dist > BestScore)
+			{
+				BestScore = Dist;
+				NextLandmark = i;
+			}
+		}
+
+		for (int L = 0; L < MaxLandmarks; L++)
+		{
+			Landmarks.Add(NextLandmark);
+
+			double* Row = Distances.GetData() + L * NumNodes;
+			ComputeLandmarkDistances(InCluster, NextLandmark, Row, Queue);
+
+			BestScore = -1;
+			NextLandmark = -1;
+
+			for (int i = 0; i < NumNodes; i++)
+			{
+				const double Dist = Row[i];
+				if (Dist != MAX_dbl) { MaxDistance = FMath::Max(MaxDistance, Dist); }
+
+				// Unreachable nodes keep a MAX_dbl min distance, so disconnected parts get picked first
+				double& MinDist = MinDistances[i];
+				if (Dist < MinDist) { MinDist = Dist; }
+				if (MinDist > BestScore)
+				{
+					BestScore = MinDist;
+					NextLandmark = i;
+				}
+			}
+
+			// Every node is already a landmark
+			if (BestScore <= 0) { break; }
+		}
+
+		Distances.SetNum(Landmarks.Num() * NumNodes);
+		return true;
+	}
+
+	bool FLandmarks::IsValidFor(const PCGExCluster::FCluster* InCluster, const int32 InNumLandmarks) const
+	{
+		return NumRequested == InNumLandmarks &&
+			NumNodes == InCluster->Nodes->Num() &&
+			NumEdges == InCluster->Edges->Num() &&
+			!Landmarks.IsEmpty() &&
+			PositionsHash == HashNodePositions(InCluster); // Vtx may have moved without the topology changing
+	}
+}
+
+void FPCGExHeuristicLandmarks::PrepareForCluster(const TSharedPtr<const PCGExCluster::FCluster>& InCluster)
+{
+	FPCGExHeuristicOperation::PrepareForCluster(InCluster);
+	BoundsSize = InCluster->Bounds.GetSize().Length();
+
+	Landmarks.Reset();
+
+	// Landmarks are cached next to the cluster so repeated pathfinding over the same edges only pays for them once
+
+	const UPCGExClusterEdgesData* EdgesData = nullptr;
+	if (const TSharedPtr<PCGExData::FPointIO> EdgesIO = InCluster->EdgesIO.Pin()) { EdgesData = Cast<UPCGExClusterEdgesData>(EdgesIO->GetIn()); }
+
+	const bool bCacheLandmarks = EdgesData && GetDefault<UPCGExGlobalSettings>()->bCacheClusters;
+
+	if (bCacheLandmarks)
+	{
+		if (const TSharedPtr<PCGExHeuristics::FLandmarks> CachedLandmarks = EdgesData->GetBoundLandmarks();
+			CachedLandmarks && CachedLandmarks->IsValidFor(InCluster.Get(), NumLandmarks))
+		{
+			Landmarks = CachedLandmarks;
+			return;
+		}
+	}
+
+	PCGEX_MAKE_SHARED(NewLandmarks, PCGExHeuristics::FLandmarks)
+	if (!NewLandmarks->Build(InCluster.Get(), NumLandmarks)) { return; }
+
+	Landmarks = NewLandmarks;
+	if (bCacheLandmarks) { EdgesData->SetBoundLandmarks(Landmarks); }
+}
+
+double FPCGExHeuristicLandmarks::GetGlobalScore(
+	const PCGExCluster::FNode& From,
+	const PCGExCluster::FNode& Seed,
+	const PCGExCluster::FNode& Goal) const
+{
+	const double Dist = Cluster->GetDist(From, Goal);
+	if (!Landmarks || Landmarks->MaxDistance <= 0) { return GetScoreInternal(Dist / BoundsSize); }
+
+	// Both the landmark bound and the straight line are lower bounds of the path length, keep the tightest one
+	const double Bound = FMath::Max(Landmarks->GetLowerBound(From.Index, Goal.Index), Dist);
+	return GetScoreInternal(Bound / Landmarks->MaxDistance);
+}
+
+double FPCGExHeuristicLandmarks::GetEdgeScore(
+	const PCGExCluster::FNode& From,
+	const PCGExCluster::FNode& To,
+	const PCGExGraph::FEdge& Edge,
+	const PCGExCluster::FNode& Seed,
+	const PCGExCluster::FNode& Goal,
+	const TSharedPtr<PCGEx::FHashLookup> TravelStack) const
+{
+	return GetScoreInternal((*Cluster->EdgeLengths)[Edge.Index]);
+}
+
+TSharedPtr<FPCGExHeuristicOperation> UPCGExHeuristicsFactoryLandmarks::CreateOperation(FPCGExContext* InContext) const
+{
+	PCGEX_FACTORY_NEW_OPERATION(HeuristicLandmarks)
+	PCGEX_FORWARD_HEURISTIC_CONFIG
+	NewOperation->NumLandmarks = Config.NumLandmarks;
+	return NewOperation;
+}
+
+PCGEX_HEURISTIC_FACTORY_BOILERPLATE_IMPL(Landmarks, {})
+
+UPCGExFactoryData* UPCGExHeuristicsLandmarksProviderSettings::CreateFactory(FPCGExContext* InContext, UPCGExFactoryData* InFactory) const
+{
+	UPCGExHeuristicsFactoryLandmarks* NewFactory = InContext->ManagedObjects->New<UPCGExHeuristicsFactoryLandmarks>();
+	PCGEX_FORWARD_HEURISTIC_FACTORY
+	return Super::CreateFactory(InContext, NewFactory);
+}
+
+#if WITH_EDITOR
+FString UPCGExHeuristicsLandmarksProviderSettings::GetDisplayName() const
+{
+	return GetDefaultNodeTitle().ToString().Replace(TEXT("PCGEx | Heuristics"), TEXT("HX"))
+		+ TEXT(" @ ")
+		+ FString::Printf(TEXT("%.3f"), (static_cast<int32>(1000 * Config.WeightFactor) / 1000.0));
+}
+#endif
@@ -72,16 +72,71 @@ namespace PCGExHeuristics
 		return true;
 	}
 
+	bool FHeuristicsHandler::SupportsSharedSeedQueries() const
+	{
+		if (HasAnyFeedback()) { return false; }
+		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations) { if (Op->HasGoalDependentEdgeScore()) { return false; } }
+		return true;
+	}
+
 	void FHeuristicsHandler::PrepareForCluster(const TSharedPtr<PCGExCluster::FCluster>& InCluster)
 	{
 		InCluster->ComputeEdgeLengths(true); // TODO : Make our own copy
 
 		Cluster = InCluster;
 		bUseDynamicWeight = false;
+
+		TArray<FPCGExHeuristicOperation*> StaticOperations;
+		DynamicOperations.Reset();
+
 		for (const TSharedPtr<FPCGExHeuristicOperation>& Operation : Operations)
 		{
 			Operation->PrepareForCluster(InCluster);
 			if (Operation->bHasCustomLocalWeightMultiplier) { bUseDynamicWeight = true; }
+
+			if (Operation->HasStaticEdgeScore()) { StaticOperations.Add(Operation.Get()); }
+			else { DynamicOperations.Add(Operation.Get()); }
+		}
+
+		BakeStaticEdgeScores(StaticOperations);
+	}
+
+	void FHeuristicsHandler::BakeStaticEdgeScores(const TArray<FPCGExHeuristicOperation*>& StaticOperations)
+	{
+		StaticEdgeScores.Reset();
+		StaticEdgeWeights.Reset();
+
+		if (StaticOperations.IsEmpty() && !bUseDynamicWeight) { return; }
+
+		TRACE_CPUPROFILER_EVENT_SCOPE(FHeuristicsHandler::BakeStaticEdgeScores);
+
+		const int32 NumEdges = Cluster->Edges->Num();
+		if (!StaticOperations.IsEmpty()) { StaticEdgeScores.SetNumZeroed(NumEdges * 2); }
+		if (bUseDynamicWeight) { StaticEdgeWeights.SetNumZeroed(NumEdges * 2); }
+
+		for (const PCGExGraph::FEdge& Edge : *Cluster->Edges)
+		{
+			const PCGExCluster::FNode& Start = *Cluster->GetEdgeStart(Edge);
+			const PCGExCluster::FNode& End = *Cluster->GetEdgeEnd(Edge);
+
+			for (int32 Dir = 0; Dir < 2; Dir++)
+			{
+				const PCGExCluster::FNode& From = Dir == 0 ? Start : End;
+				const PCGExCluster::FNode& To = Dir == 0 ? End : Start;
+				const int32 Index = Edge.Index * 2 + Dir;
+
+				if (!StaticEdgeScores.IsEmpty())
+				{
+					double& EScore = StaticEdgeScores[Index];
+					for (const FPCGExHeuristicOperation* Op : StaticOperations) { EScore += Op->GetEdgeScore(From, To, Edge, From, To, nullptr); }
+				}
+
+				if (bUseDynamicWeight)
+				{
+					double& EWeight = StaticEdgeWeights[Index];
+					for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations) { EWeight += (Op->WeightFactor * Op->GetCustomWeightMultiplier(To.Index, Edge.PointIndex)); }
+				}
+			}
 		}
 	}
 
@@ -118,12 +173,15 @@ namespace PCGExHeuristics
 		const FLocalFeedbackHandler* LocalFeedback,
 		const TSharedPtr<PCGEx::FHashLookup>& TravelStack) const
 	{
-		double EScore = 0;
-		double EWeight = TotalStaticWeight;
+		const int32 DirectedIndex = GetDirectedEdgeIndex(From, Edge);
+
+		// Static terms are baked, only dynamic ones (feedback, travel-stack or goal dependent) are evaluated per edge
+		double EScore = StaticEdgeScores.IsEmpty() ? 0 : StaticEdgeScores[DirectedIndex];
+		for (const FPCGExHeuristicOperation* Op : DynamicOperations) { EScore += Op->GetEdgeScore(From, To, Edge, Seed, Goal, TravelStack); }
 
 		if (!bUseDynamicWeight)
 		{
-			for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations) { EScore += Op->GetEdgeScore(From, To, Edge, Seed, Goal, TravelStack); }
+			double EWeight = TotalStaticWeight;
 
 			if (LocalFeedback)
 			{
@@ -134,13 +192,7 @@ namespace PCGExHeuristics
 			return EScore / EWeight;
 		}
 
-		EWeight = 0;
-
-		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations)
-		{
-			EScore += Op->GetEdgeScore(From, To, Edge, Seed, Goal, TravelStack);
-			EWeight += (Op->WeightFactor * Op->GetCustomWeightMultiplier(To.Index, Edge.PointIndex));
-		}
+		const double EWeight = StaticEdgeWeights[DirectedIndex];
 
 		if (LocalFeedback)
 		{
@@ -34,27 +34,47 @@ namespace PCGExPathfinding
 		NumNodes = InCluster->Nodes->Num();
 
 		Visited.Init(false, NumNodes);
-		TravelStack = PCGEx::NewHashLookup<PCGEx::FHashLookupArray>(PCGEx::NH64(-1, -1), NumNodes);
+		TravelStack = PCGEx::NewHashLookup<PCGEx::FHashLookupEpochArray>(PCGEx::NH64(-1, -1), NumNodes);
 		ScoredQueue = MakeShared<PCGExSearch::FScoredQueue>(NumNodes);
 	}
 
 	void FSearchAllocations::Reset()
 	{
-		if (GScore.Num() == Visited.Num())
-		{
-			for (int i = 0; i < NumNodes; i++)
-			{
-				Visited[i] = false;
-				GScore[i] = -1;
-			}
-		}
-		else
+		// All O(1)
+		Visited.Reset();
+		GScore.Reset();
+		TravelStack->Reset();
+		ScoredQueue->Reset();
+	}
+
+	FSearchAllocationsPool::FSearchAllocationsPool(const TSharedPtr<FPCGExSearchOperation>& InSearchOperation)
+		: SearchOperation(InSearchOperation)
+	{
+	}
+
+	TSharedPtr<FSearchAllocations> FSearchAllocationsPool::Acquire()
+	{
 		{
-			for (int i = 0; i < NumNodes; i++) { Visited[i] = false; }
+			FWriteScopeLock WriteScopeLock(PoolLock);
+			if (!Available.IsEmpty()) { return Available.Pop(EAllowShrinking::No); }
+			NumCreated++;
 		}
 
-		TravelStack->Reset();
-		ScoredQueue->Reset();
+		// Allocate outside the lock, this is the expensive part
+		return SearchOperation->NewAllocations();
+	}
+
+	void FSearchAllocationsPool::Release(const TSharedPtr<FSearchAllocations>& InAllocations)
+	{
+		if (!InAllocations) { return; }
+		FWriteScopeLock WriteScopeLock(PoolLock);
+		Available.Add(InAllocations);
+	}
+
+	int32 FSearchAllocationsPool::GetNumCreated() const
+	{
+		FReadScopeLock ReadScopeLock(PoolLock);
+		return NumCreated;
 	}
 
 	EQueryPickResolution FPathQuery::ResolvePicks(const FPCGExNodeSelectionDetails& SeedSelectionDetails, const FPCGExNodeSelectionDetails& GoalSelectionDetails)
@@ -184,6 +204,19 @@ namespace PCGExPathfinding
 		PathEdges.Empty();
 	}
 
+	void FindPathsFromSharedSeed(
+		const TArrayView<const TSharedPtr<FPathQuery>> InQueries,
+		const TSharedPtr<FPCGExSearchOperation>& SearchOperation,
+		const TSharedPtr<FSearchAllocations>& Allocations,
+		const TSharedPtr<PCGExHeuristics::FHeuristicsHandler>& HeuristicsHandler)
+	{
+		SearchOperation->ResolveSharedSeedQueries(InQueries, Allocations, HeuristicsHandler);
+		for (const TSharedPtr<FPathQuery>& Query : InQueries)
+		{
+			Query->SetResolution(Query->HasValidPathPoints() ? EPathfindingResolution::Success : EPathfindingResolution::Fail);
+		}
+	}
+
 	void FPlotQuery::BuildPlotQuery(
 		const TSharedPtr<PCGExData::FFacade>& InPlot,
 		const FPCGExNodeSelectionDetails& SeedSelectionDetails,
@@ -223,7 +256,8 @@ namespace PCGExPathfinding
 		const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager,
 		const TSharedPtr<FPCGExSearchOperation>& SearchOperation,
 		const TSharedPtr<FSearchAllocations>& Allocations,
-		const TSharedPtr<PCGExHeuristics::FHeuristicsHandler>& HeuristicsHandler)
+		const TSharedPtr<PCGExHeuristics::FHeuristicsHandler>& HeuristicsHandler,
+		const TSharedPtr<FSearchAllocationsPool>& AllocationsPool)
 	{
 		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, PlotTasks)
 
@@ -238,15 +272,16 @@ namespace PCGExPathfinding
 			};
 
 		PlotTasks->OnSubLoopStartCallback =
-			[PCGEX_ASYNC_THIS_CAPTURE, SearchOperation, Allocations, HeuristicsHandler](const PCGExMT::FScope& Scope)
+			[PCGEX_ASYNC_THIS_CAPTURE, SearchOperation, Allocations, HeuristicsHandler, AllocationsPool](const PCGExMT::FScope& Scope)
 			{
 				PCGEX_ASYNC_THIS
 				TSharedPtr<FSearchAllocations> LocalAllocations = Allocations;
-				if (!LocalAllocations) { LocalAllocations = SearchOperation->NewAllocations(); }
+				if (!LocalAllocations) { LocalAllocations = AllocationsPool ? AllocationsPool->Acquire() : SearchOperation->NewAllocations(); }
 				PCGEX_SCOPE_LOOP(Index)
 				{
 					This->SubQueries[Index]->FindPath(SearchOperation, LocalAllocations, HeuristicsHandler, This->LocalFeedbackHandler);
 				}
+				if (!Allocations && AllocationsPool) { AllocationsPool->Release(LocalAllocations); }
 			};
 
 		PlotTasks->StartSubLoops(SubQueries.Num(), 12, HeuristicsHandler->HasAnyFeedback() || (Allocations != nullptr));
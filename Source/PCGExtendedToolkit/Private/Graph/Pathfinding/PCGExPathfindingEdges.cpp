@@ -198,6 +198,7 @@ bool FPCGExPathfindingEdgesElement::ExecuteInternal(FPCGContext* InContext) cons
 			[&](const TSharedPtr<PCGExClusterMT::IBatch>& NewBatch)
 			{
 				NewBatch->SetWantsHeuristics(true);
+				NewBatch->bWantsPackedAdjacency = true;
 			}))
 		{
 			return Context->CancelExecution(TEXT("Could not build any clusters."));
@@ -244,6 +245,10 @@ namespace PCGExPathfindingEdges
 
 		bForceSingleThreadedProcessRange = HeuristicsHandler->HasGlobalFeedback() || !Settings->bGreedyQueries;
 		if (bForceSingleThreadedProcessRange) { SearchAllocations = SearchOperation->NewAllocations(); }
+		else { SearchAllocationsPool = MakeShared<PCGExPathfinding::FSearchAllocationsPool>(SearchOperation); }
+
+		bBatchBySeed = Settings->bBatchQueriesBySeed && HeuristicsHandler->SupportsSharedSeedQueries();
+		StartTime = FPlatformTime::Seconds();
 
 		PCGEx::InitArray(Queries, Context->SeedGoalPairs.Num());
 		for (int i = 0; i < Queries.Num(); i++)
@@ -263,6 +268,15 @@ namespace PCGExPathfindingEdges
 
 	void FProcessor::ProcessRange(const PCGExMT::FScope& Scope)
 	{
+		if (bBatchBySeed)
+		{
+			// Only resolve picks for now, queries are grouped by seed once they're all known
+			PCGEX_SCOPE_LOOP(Index) { Queries[Index]->ResolvePicks(Settings->SeedPicking, Settings->GoalPicking); }
+			return;
+		}
+
+		const TSharedPtr<PCGExPathfinding::FSearchAllocations> LocalAllocations = SearchAllocations ? SearchAllocations : SearchAllocationsPool->Acquire();
+
 		PCGEX_SCOPE_LOOP(Index)
 		{
 			TSharedPtr<PCGExPathfinding::FPathQuery> Query = Queries[Index];
@@ -271,14 +285,114 @@ namespace PCGExPathfindingEdges
 
 			Query->ResolvePicks(Settings->SeedPicking, Settings->GoalPicking);
 
-			if (!Query->HasValidEndpoints()) { return; }
+			if (!Query->HasValidEndpoints()) { continue; }
 
-			Query->FindPath(SearchOperation, SearchAllocations, HeuristicsHandler, nullptr);
+			Query->FindPath(SearchOperation, LocalAllocations, HeuristicsHandler, nullptr);
 
-			if (!Query->IsQuerySuccessful()) { return; }
+			if (!Query->IsQuerySuccessful()) { continue; }
 
 			Context->BuildPath(Query);
 		}
+
+		if (!SearchAllocations) { SearchAllocationsPool->Release(LocalAllocations); }
+	}
+
+	void FProcessor::OnRangeProcessingComplete()
+	{
+		if (!bBatchBySeed)
+		{
+			LogThroughput();
+			return;
+		}
+
+		ProcessSeedGroups();
+	}
+
+	void FProcessor::ProcessSeedGroups()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExPathfindingEdges::ProcessSeedGroups);
+
+		// Sort valid queries by seed node, keeping query order within a group
+
+		TArray<uint64> SortedKeys;
+		SortedKeys.Reserve(Queries.Num());
+
+		for (int i = 0; i < Queries.Num(); i++)
+		{
+			const TSharedPtr<PCGExPathfinding::FPathQuery>& Query = Queries[i];
+			if (Query->HasValidEndpoints()) { SortedKeys.Add(PCGEx::H64(Query->Seed.Node->Index, i)); }
+			else { Query->Cleanup(); }
+		}
+
+		if (SortedKeys.IsEmpty())
+		{
+			LogThroughput();
+			return;
+		}
+
+		SortedKeys.Sort();
+
+		SeedGroupQueries.SetNumUninitialized(SortedKeys.Num());
+		SeedGroupStarts.Reset();
+
+		int32 PrevSeed = -1;
+		for (int i = 0; i < SortedKeys.Num(); i++)
+		{
+			const int32 Seed = PCGEx::H64A(SortedKeys[i]);
+			if (Seed != PrevSeed)
+			{
+				SeedGroupStarts.Add(i);
+				PrevSeed = Seed;
+			}
+			SeedGroupQueries[i] = Queries[PCGEx::H64B(SortedKeys[i])];
+		}
+
+		const int32 NumGroups = SeedGroupStarts.Num();
+		SeedGroupStarts.Add(SortedKeys.Num());
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, SeedGroupTasks)
+
+		SeedGroupTasks->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->LogThroughput();
+			};
+
+		SeedGroupTasks->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+
+				const TSharedPtr<PCGExPathfinding::FSearchAllocations> LocalAllocations = This->SearchAllocations ? This->SearchAllocations : This->SearchAllocationsPool->Acquire();
+
+				PCGEX_SCOPE_LOOP(GroupIndex)
+				{
+					const int32 Start = This->SeedGroupStarts[GroupIndex];
+					const TArrayView<const TSharedPtr<PCGExPathfinding::FPathQuery>> Group = MakeArrayView(This->SeedGroupQueries.GetData() + Start, This->SeedGroupStarts[GroupIndex + 1] - Start);
+
+					PCGExPathfinding::FindPathsFromSharedSeed(Group, This->SearchOperation, LocalAllocations, This->HeuristicsHandler);
+
+					for (const TSharedPtr<PCGExPathfinding::FPathQuery>& Query : Group)
+					{
+						if (Query->IsQuerySuccessful()) { This->Context->BuildPath(Query); }
+						Query->Cleanup();
+					}
+				}
+
+				if (!This->SearchAllocations) { This->SearchAllocationsPool->Release(LocalAllocations); }
+			};
+
+		SeedGroupTasks->StartSubLoops(NumGroups, 1, bForceSingleThreadedProcessRange);
+	}
+
+	void FProcessor::LogThroughput() const
+	{
+		const double Elapsed = FPlatformTime::Seconds() - StartTime;
+		UE_LOG(
+			LogPCGEx, Verbose, TEXT("Pathfinding : %d queries (%d seed groups) resolved in %.3fms, %.0f queries/s, %d search allocations."),
+			Queries.Num(), FMath::Max(0, SeedGroupStarts.Num() - 1), Elapsed * 1000, Elapsed > 0 ? Queries.Num() / Elapsed : 0,
+			SearchAllocationsPool ? SearchAllocationsPool->GetNumCreated() : 1);
 	}
 }
 
@@ -215,6 +215,7 @@ bool FPCGExPathfindingPlotEdgesElement::ExecuteInternal(FPCGContext* InContext)
 			[&](const TSharedPtr<PCGExClusterMT::IBatch>& NewBatch)
 			{
 				NewBatch->SetWantsHeuristics(true);
+				NewBatch->bWantsPackedAdjacency = true;
 			}))
 		{
 			return Context->CancelExecution(TEXT("Could not build any clusters."));
@@ -267,6 +268,7 @@ namespace PCGExPathfindingPlotEdges
 
 		bForceSingleThreadedProcessRange = HeuristicsHandler->HasGlobalFeedback() || !Settings->bGreedyQueries;
 		if (bForceSingleThreadedProcessRange) { SearchAllocations = SearchOperation->NewAllocations(); }
+		else { SearchAllocationsPool = MakeShared<PCGExPathfinding::FSearchAllocationsPool>(SearchOperation); }
 
 		StartParallelLoopForRange(Queries.Num(), 1);
 		return true;
@@ -284,7 +286,7 @@ namespace PCGExPathfindingPlotEdges
 				This->Context->BuildPath(Plot);
 				Plot->Cleanup();
 			};
-			Query->FindPaths(AsyncManager, SearchOperation, SearchAllocations, HeuristicsHandler);
+			Query->FindPaths(AsyncManager, SearchOperation, SearchAllocations, HeuristicsHandler, SearchAllocationsPool);
 		}
 	}
 }
@@ -29,13 +29,13 @@ bool FPCGExSearchOperationAStar::ResolveQuery(
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(UPCGExSearchAStar::FindPath);
 
-	TBitArray<>& Visited = LocalAllocations->Visited;
-	TArray<double>& GScore = LocalAllocations->GScore;
+	PCGEx::TEpochArray<bool>& Visited = LocalAllocations->Visited;
+	PCGEx::TEpochArray<double>& GScore = LocalAllocations->GScore;
 	const TSharedPtr<PCGEx::FHashLookup> TravelStack = LocalAllocations->TravelStack;
 	const TSharedPtr<PCGExSearch::FScoredQueue> ScoredQueue = LocalAllocations->ScoredQueue;
 	ScoredQueue->Enqueue(SeedNode.Index, Heuristics->GetGlobalScore(SeedNode, SeedNode, GoalNode));
 
-	GScore[SeedNode.Index] = 0;
+	GScore.Set(SeedNode.Index, 0);
 
 	const PCGExHeuristics::FLocalFeedbackHandler* Feedback = LocalFeedback.Get();
 
@@ -46,19 +46,19 @@ bool FPCGExSearchOperationAStar::ResolveQuery(
 	{
 		if (bEarlyExit && CurrentNodeIndex == GoalNode.Index) { break; } // Exit early
 
-		const double CurrentGScore = GScore[CurrentNodeIndex];
+		const double CurrentGScore = GScore.Get(CurrentNodeIndex);
 		const PCGExCluster::FNode& Current = NodesRef[CurrentNodeIndex];
 
-		if (Visited[CurrentNodeIndex]) { continue; }
-		Visited[CurrentNodeIndex] = true;
+		if (Visited.Get(CurrentNodeIndex)) { continue; }
+		Visited.Set(CurrentNodeIndex, true);
 		VisitedNum++;
 
-		for (const PCGExGraph::FLink Lk : Current.Links)
+		for (const PCGExGraph::FLink Lk : Cluster->GetLinks(CurrentNodeIndex))
 		{
 			const uint32 NeighborIndex = Lk.Node;
 			const uint32 EdgeIndex = Lk.Edge;
 
-			if (Visited[NeighborIndex]) { continue; }
+			if (Visited.Get(NeighborIndex)) { continue; }
 
 			const PCGExCluster::FNode& AdjacentNode = NodesRef[NeighborIndex];
 			const PCGExGraph::FEdge& Edge = EdgesRef[EdgeIndex];
@@ -66,11 +66,11 @@ bool FPCGExSearchOperationAStar::ResolveQuery(
 			const double EScore = Heuristics->GetEdgeScore(Current, AdjacentNode, Edge, SeedNode, GoalNode, Feedback, TravelStack);
 			const double TentativeGScore = CurrentGScore + EScore;
 
-			const double PreviousGScore = GScore[NeighborIndex];
+			const double PreviousGScore = GScore.Get(NeighborIndex);
 			if (PreviousGScore != -1 && TentativeGScore >= PreviousGScore) { continue; }
 
 			TravelStack->Set(NeighborIndex, PCGEx::NH64(CurrentNodeIndex, EdgeIndex));
-			GScore[NeighborIndex] = TentativeGScore;
+			GScore.Set(NeighborIndex, TentativeGScore);
 
 			const double GS = Heuristics->GetGlobalScore(AdjacentNode, SeedNode, GoalNode, Feedback);
 			const double FScore = TentativeGScore + GS * Heuristics->ReferenceWeight;
@@ -24,18 +24,13 @@ bool FPCGExSearchOperationDijkstra::ResolveQuery(
 	const PCGExCluster::FNode& SeedNode = *InQuery->Seed.Node;
 	const PCGExCluster::FNode& GoalNode = *InQuery->Goal.Node;
 
-	const int32 NumNodes = NodesRef.Num();
-
 	TRACE_CPUPROFILER_EVENT_SCOPE(UPCGExSearchDijkstra::FindPath);
 
 	// Basic Dijkstra implementation
 
-	TBitArray<> Visited;
-	Visited.Init(false, NumNodes);
-
-	const TSharedPtr<PCGEx::FHashLookup> TravelStack = PCGEx::NewHashLookup<PCGEx::FHashLookupArray>(PCGEx::NH64(-1, -1), NumNodes);
-
-	const TUniquePtr<PCGExSearch::FScoredQueue> ScoredQueue = MakeUnique<PCGExSearch::FScoredQueue>(NumNodes);
+	PCGEx::TEpochArray<bool>& Visited = LocalAllocations->Visited;
+	const TSharedPtr<PCGEx::FHashLookup> TravelStack = LocalAllocations->TravelStack;
+	const TSharedPtr<PCGExSearch::FScoredQueue> ScoredQueue = LocalAllocations->ScoredQueue;
 	ScoredQueue->Enqueue(SeedNode.Index, 0);
 
 	const PCGExHeuristics::FLocalFeedbackHandler* Feedback = LocalFeedback.Get();
@@ -49,16 +44,16 @@ bool FPCGExSearchOperationDijkstra::ResolveQuery(
 
 		const PCGExCluster::FNode& Current = NodesRef[CurrentNodeIndex];
 
-		if (Visited[CurrentNodeIndex]) { continue; }
-		Visited[CurrentNodeIndex] = true;
+		if (Visited.Get(CurrentNodeIndex)) { continue; }
+		Visited.Set(CurrentNodeIndex, true);
 		VisitedNum++;
 
-		for (const PCGExGraph::FLink Lk : Current.Links)
+		for (const PCGExGraph::FLink Lk : Cluster->GetLinks(CurrentNodeIndex))
 		{
 			const uint32 NeighborIndex = Lk.Node;
 			const uint32 EdgeIndex = Lk.Edge;
 
-			if (Visited[NeighborIndex]) { continue; }
+			if (Visited.Get(NeighborIndex)) { continue; }
 
 			const PCGExCluster::FNode& AdjacentNode = NodesRef[NeighborIndex];
 			const PCGExGraph::FEdge& Edge = EdgesRef[EdgeIndex];
@@ -4,7 +4,10 @@
 
 #include "Graph/Pathfinding/Search/PCGExSearchOperation.h"
 
+#include "Graph/PCGExCluster.h"
 #include "Graph/Pathfinding/PCGExPathfinding.h"
+#include "Graph/Pathfinding/Heuristics/PCGExHeuristics.h"
+#include "Graph/Pathfinding/Search/PCGExScoredQueue.h"
 
 void FPCGExSearchOperation::PrepareForCluster(PCGExCluster::FCluster* InCluster)
 {
@@ -20,6 +23,90 @@ bool FPCGExSearchOperation::ResolveQuery(
 	return false;
 }
 
+int32 FPCGExSearchOperation::ResolveSharedSeedQueries(
+	const TArrayView<const TSharedPtr<PCGExPathfinding::FPathQuery>> InQueries,
+	const TSharedPtr<PCGExPathfinding::FSearchAllocations>& Allocations,
+	const TSharedPtr<PCGExHeuristics::FHeuristicsHandler>& Heuristics) const
+{
+	if (InQueries.IsEmpty()) { return 0; }
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExSearchOperation::ResolveSharedSeedQueries);
+
+	TSharedPtr<PCGExPathfinding::FSearchAllocations> LocalAllocations = Allocations;
+	if (!LocalAllocations) { LocalAllocations = NewAllocations(); }
+	else { LocalAllocations->Reset(); }
+
+	const TArray<PCGExCluster::FNode>& NodesRef = *Cluster->Nodes;
+	const TArray<PCGExGraph::FEdge>& EdgesRef = *Cluster->Edges;
+
+	const PCGExCluster::FNode& SeedNode = *InQueries[0]->Seed.Node;
+
+	// Edge scores are goal-agnostic by contract, any goal will do as a stand-in
+	const PCGExCluster::FNode& AnyGoalNode = *InQueries[0]->Goal.Node;
+
+	TSet<int32> PendingGoals;
+	PendingGoals.Reserve(InQueries.Num());
+	for (const TSharedPtr<PCGExPathfinding::FPathQuery>& Query : InQueries) { PendingGoals.Add(Query->Goal.Node->Index); }
+
+	// One-to-many Dijkstra, stops once every goal has been settled
+
+	PCGEx::TEpochArray<bool>& Visited = LocalAllocations->Visited;
+	const TSharedPtr<PCGEx::FHashLookup> TravelStack = LocalAllocations->TravelStack;
+	const TSharedPtr<PCGExSearch::FScoredQueue> ScoredQueue = LocalAllocations->ScoredQueue;
+	ScoredQueue->Enqueue(SeedNode.Index, 0);
+
+	int32 CurrentNodeIndex;
+	double CurrentScore;
+	while (ScoredQueue->Dequeue(CurrentNodeIndex, CurrentScore))
+	{
+		if (Visited.Get(CurrentNodeIndex)) { continue; }
+		Visited.Set(CurrentNodeIndex, true);
+
+		if (PendingGoals.Remove(CurrentNodeIndex) && bEarlyExit && PendingGoals.IsEmpty()) { break; }
+
+		const PCGExCluster::FNode& Current = NodesRef[CurrentNodeIndex];
+
+		for (const PCGExGraph::FLink Lk : Cluster->GetLinks(CurrentNodeIndex))
+		{
+			const uint32 NeighborIndex = Lk.Node;
+			const uint32 EdgeIndex = Lk.Edge;
+
+			if (Visited.Get(NeighborIndex)) { continue; }
+
+			const double AltScore = CurrentScore + Heuristics->GetEdgeScore(Current, NodesRef[NeighborIndex], EdgesRef[EdgeIndex], SeedNode, AnyGoalNode, nullptr, TravelStack);
+			if (ScoredQueue->Enqueue(NeighborIndex, AltScore))
+			{
+				TravelStack->Set(NeighborIndex, PCGEx::NH64(CurrentNodeIndex, EdgeIndex));
+			}
+		}
+	}
+
+	int32 NumResolved = 0;
+
+	for (const TSharedPtr<PCGExPathfinding::FPathQuery>& Query : InQueries)
+	{
+		const int32 GoalIndex = Query->Goal.Node->Index;
+
+		int32 PathNodeIndex = PCGEx::NH64A(TravelStack->Get(GoalIndex));
+		int32 PathEdgeIndex = -1;
+
+		if (PathNodeIndex == -1) { continue; }
+
+		NumResolved++;
+		Query->AddPathNode(GoalIndex);
+
+		while (PathNodeIndex != -1)
+		{
+			const int32 CurrentIndex = PathNodeIndex;
+			PCGEx::NH64(TravelStack->Get(CurrentIndex), PathNodeIndex, PathEdgeIndex);
+
+			Query->AddPathNode(CurrentIndex, PathEdgeIndex);
+		}
+	}
+
+	return NumResolved;
+}
+
 TSharedPtr<PCGExPathfinding::FSearchAllocations> FPCGExSearchOperation::NewAllocations() const
 {
 	TSharedPtr<PCGExPathfinding::FSearchAllocations> Allocations = MakeShared<PCGExPathfinding::FSearchAllocations>();
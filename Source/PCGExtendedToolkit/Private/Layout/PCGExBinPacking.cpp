@@ -136,11 +136,10 @@ namespace PCGExBinPacking
 {
 	void FBin::AddSpace(const FBox& InBox)
 	{
-		FSpace& NewSpace = Spaces.Emplace_GetRef(InBox, Seed);
-		NewSpace.DistanceScore /= MaxDist;
+		Spaces->Add(InBox);
 	}
 
-	FBin::FBin(const PCGExData::FConstPoint& InBinPoint, const FVector& InSeed, const TSharedPtr<FBinSplit>& InSplitter)
+	FBin::FBin(const PCGExData::FConstPoint& InBinPoint, const FVector& InSeed, const TSharedPtr<FBinSplit>& InSplitter, const bool bMergeSpaces)
 	{
 		Splitter = InSplitter;
 		Seed = InSeed;
@@ -161,43 +160,22 @@ namespace PCGExBinPacking
 
 		MaxDist = FVector::DistSquared(FurthestLocation, Seed);
 
+		Spaces = MakeShared<PCGExLayout::FSpaceIndex>(Bounds, Seed, MaxDist, bMergeSpaces);
 		AddSpace(Bounds);
 	}
 
 	int32 FBin::GetBestSpaceScore(const FItem& InItem, double& OutScore, FRotator& OutRotator) const
 	{
-		int32 BestIndex = -1;
-		const double BoxVolume = InItem.Box.GetVolume();
-		const FVector ItemSize = InItem.Box.GetSize();
-
-		for (int i = 0; i < Spaces.Num(); i++)
-		{
-			const FSpace& Space = Spaces[i];
-
-			// TODO : Rotate & try fit
-
-			if (Space.CanFit(ItemSize))
-			{
-				const double SpaceScore = 1 - ((Space.Volume - BoxVolume) / MaxVolume);
-				const double DistScore = Space.DistanceScore;
-				const double Score = SpaceScore + DistScore;
-
-				if (Score < OutScore)
-				{
-					BestIndex = i;
-					OutScore = Score;
-				}
-			}
-		}
-
-		return BestIndex;
+		// TODO : Rotate & try fit
+		return Spaces->FindBestFit(InItem.Box.GetSize(), MaxVolume, OutScore);
 	}
 
 	void FBin::AddItem(int32 SpaceIndex, FItem& InItem)
 	{
 		Items.Add(InItem);
 
-		const FSpace& Space = Spaces[SpaceIndex];
+		// Copy, the slot is released before the partitions are added
+		const FSpace Space = Spaces->Get(SpaceIndex);
 
 		const FVector ItemSize = InItem.Box.GetSize();
 		FVector ItemMin = Space.Box.Min;
@@ -218,9 +196,7 @@ namespace PCGExBinPacking
 		TArray<FBox> NewPartitions;
 		Splitter->SplitSpace(Space, ItemBox, NewPartitions);
 
-		Spaces.RemoveAt(SpaceIndex);
-		Spaces.Reserve(Spaces.Num() + NewPartitions.Num());
-
+		Spaces->Remove(SpaceIndex);
 		for (const FBox& Partition : NewPartitions) { AddSpace(Partition); }
 	}
 
@@ -325,7 +301,7 @@ namespace PCGExBinPacking
 		}
 
 		PCGEx::ArrayOfIndices(ProcessingOrder, PointDataFacade->GetNum());
-		if (Sorter && Sorter->Init(Context)) { ProcessingOrder.Sort([&](const int32& A, const int32& B) { return Sorter->Sort(A, B); }); }
+		if (Sorter && Sorter->Init(Context)) { Sorter->Sort(ProcessingOrder); }
 
 		if (Settings->bAvoidWastedSpace)
 		{
@@ -353,7 +329,7 @@ namespace PCGExBinPacking
 				Seed = BinPoint.GetTransform().InverseTransformPositionNoScale(SeedGetter ? SeedGetter->FetchSingle(BinPoint, FVector::ZeroVector) : Settings->SeedPosition);
 			}
 
-			PCGEX_MAKE_SHARED(NewBin, FBin, BinPoint, Seed, Splitter)
+			PCGEX_MAKE_SHARED(NewBin, FBin, BinPoint, Seed, Splitter, Settings->bMergeFreeSpaces)
 
 			NewBin->Settings = Settings;
 			NewBin->WastedSpaceThresholds = FVector(MinOccupation);
@@ -48,4 +48,152 @@ namespace PCGExLayout
 			if (InBox.Max[C] > InSpace.Max[C]) { InBox.Max[C] = InSpace.Max[C]; }
 		}
 	}
+
+	FSpaceIndex::FFaceKey::FFaceKey(const FBox& InBox, const int32 InAxis, const double InPlane)
+		: Axis(InAxis), Plane(InPlane)
+	{
+		const int32 A = (InAxis + 1) % 3;
+		const int32 B = (InAxis + 2) % 3;
+		Min = FVector2D(InBox.Min[A], InBox.Min[B]);
+		Max = FVector2D(InBox.Max[A], InBox.Max[B]);
+	}
+
+	FSpaceIndex::FSpaceIndex(const FBox& InBounds, const FVector& InSeed, const double InMaxDist, const bool bInMergeAdjacent)
+		: Seed(InSeed), MaxDist(InMaxDist), bMergeAdjacent(bInMergeAdjacent)
+	{
+		// Buckets are powers of two below the largest bin dimension
+		BaseSize = FMath::Max(InBounds.GetSize().GetMax(), UE_DOUBLE_KINDA_SMALL_NUMBER) / static_cast<double>(1 << (NumBuckets - 2));
+	}
+
+	int32 FSpaceIndex::GetBucket(const FVector& InSize) const
+	{
+		const double MinSize = InSize.GetMin();
+		if (MinSize < BaseSize) { return 0; }
+		return FMath::Min(NumBuckets - 1, 1 + FMath::FloorToInt32(FMath::Log2(MinSize / BaseSize)));
+	}
+
+	void FSpaceIndex::Add(const FBox& InBox)
+	{
+		FBox Box = InBox;
+		if (bMergeAdjacent) { while (TryMerge(Box)) { } }
+		Insert(Box);
+	}
+
+	int32 FSpaceIndex::Insert(const FBox& InBox)
+	{
+		FSpace NewSpace(InBox, Seed);
+		NewSpace.DistanceScore /= MaxDist;
+
+		const int32 Slot = FreeSlots.IsEmpty() ? Slots.AddDefaulted() : FreeSlots.Pop(EAllowShrinking::No);
+		FSlot& NewSlot = Slots[Slot].Emplace(NewSpace);
+		NewSlot.Order = NextOrder++;
+		NewSlot.Bucket = GetBucket(NewSpace.Size);
+
+		FBucket& Bucket = Buckets[NewSlot.Bucket];
+		NewSlot.BucketIndex = Bucket.Slots.Add(Slot);
+		Bucket.MaxVolume = FMath::Max(Bucket.MaxVolume, NewSpace.Volume);
+		Bucket.MinDistanceScore = FMath::Min(Bucket.MinDistanceScore, NewSpace.DistanceScore);
+
+		if (bMergeAdjacent)
+		{
+			for (int C = 0; C < 3; C++)
+			{
+				MinFaces.Add(FFaceKey(InBox, C, InBox.Min[C]), Slot);
+				MaxFaces.Add(FFaceKey(InBox, C, InBox.Max[C]), Slot);
+			}
+		}
+
+		NumSpaces++;
+		return Slot;
+	}
+
+	void FSpaceIndex::Remove(const int32 Slot)
+	{
+		const FSlot& OldSlot = Slots[Slot].GetValue();
+
+		FBucket& Bucket = Buckets[OldSlot.Bucket];
+		Bucket.Slots.RemoveAtSwap(OldSlot.BucketIndex, 1, EAllowShrinking::No);
+		if (Bucket.Slots.IsValidIndex(OldSlot.BucketIndex)) { Slots[Bucket.Slots[OldSlot.BucketIndex]]->BucketIndex = OldSlot.BucketIndex; }
+
+		if (Bucket.Slots.IsEmpty())
+		{
+			Bucket.MaxVolume = 0;
+			Bucket.MinDistanceScore = MAX_dbl;
+		}
+
+		if (bMergeAdjacent)
+		{
+			const FBox& Box = OldSlot.Space.Box;
+			for (int C = 0; C < 3; C++)
+			{
+				// Overlapping spaces may have claimed the same face since
+				const FFaceKey MinKey(Box, C, Box.Min[C]);
+				if (const int32* Owner = MinFaces.Find(MinKey); Owner && *Owner == Slot) { MinFaces.Remove(MinKey); }
+
+				const FFaceKey MaxKey(Box, C, Box.Max[C]);
+				if (const int32* Owner = MaxFaces.Find(MaxKey); Owner && *Owner == Slot) { MaxFaces.Remove(MaxKey); }
+			}
+		}
+
+		Slots[Slot].Reset();
+		FreeSlots.Add(Slot);
+		NumSpaces--;
+	}
+
+	bool FSpaceIndex::TryMerge(FBox& InOutBox)
+	{
+		for (int C = 0; C < 3; C++)
+		{
+			// A space whose max face touches our min face, or the other way around
+			int32 Neighbor = -1;
+			if (const int32* Found = MaxFaces.Find(FFaceKey(InOutBox, C, InOutBox.Min[C]))) { Neighbor = *Found; }
+			else if (const int32* Found2 = MinFaces.Find(FFaceKey(InOutBox, C, InOutBox.Max[C]))) { Neighbor = *Found2; }
+
+			if (Neighbor == -1) { continue; }
+
+			InOutBox += Slots[Neighbor]->Space.Box;
+			Remove(Neighbor);
+			return true;
+		}
+
+		return false;
+	}
+
+	int32 FSpaceIndex::FindBestFit(const FVector& InItemSize, const double InMaxVolume, double& OutScore) const
+	{
+		int32 BestSlot = -1;
+		int32 BestOrder = MAX_int32;
+		const double BoxVolume = InItemSize.X * InItemSize.Y * InItemSize.Z;
+
+		// Any space that fits is at least as thick as the item' thinnest side
+		for (int32 b = GetBucket(InItemSize); b < NumBuckets; b++)
+		{
+			const FBucket& Bucket = Buckets[b];
+			if (Bucket.Slots.IsEmpty()) { continue; }
+
+			// Lowest score this bucket could possibly hold
+			const double LowerBound = (1 - ((Bucket.MaxVolume - BoxVolume) / InMaxVolume)) + Bucket.MinDistanceScore;
+			if (LowerBound > OutScore) { continue; }
+
+			for (const int32 Slot : Bucket.Slots)
+			{
+				const FSlot& Candidate = Slots[Slot].GetValue();
+				const FSpace& Space = Candidate.Space;
+
+				if (!Space.CanFit(InItemSize)) { continue; }
+
+				const double SpaceScore = 1 - ((Space.Volume - BoxVolume) / InMaxVolume);
+				const double Score = SpaceScore + Space.DistanceScore;
+
+				if (Score < OutScore || (Score == OutScore && Candidate.Order < BestOrder))
+				{
+					BestSlot = Slot;
+					BestOrder = Candidate.Order;
+					OutScore = Score;
+				}
+			}
+		}
+
+		return BestSlot;
+	}
 }
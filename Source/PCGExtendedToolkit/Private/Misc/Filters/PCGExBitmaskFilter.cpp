@@ -66,6 +66,19 @@ bool PCGExPointFilter::FBitmaskFilter::Test(const int32 PointIndex) const
 	return TypedFilterFactory->Config.bInvertResult ? !Result : Result;
 }
 
+void PCGExPointFilter::FBitmaskFilter::TestScope(const PCGExMT::FScope& Scope, TArrayView<int8> OutResults) const
+{
+	TArray<int64> Flags;
+	TArray<int64> Masks;
+	Flags.SetNumUninitialized(Scope.Count);
+	Masks.SetNumUninitialized(Scope.Count);
+
+	FlagsReader->ReadRange(Scope.Start, Flags);
+	MaskReader->ReadRange(Scope.Start, Masks);
+
+	PCGExCompare::CompareRange(TypedFilterFactory->Config.Comparison, Flags, Masks, OutResults, TypedFilterFactory->Config.bInvertResult);
+}
+
 bool PCGExPointFilter::FBitmaskFilter::Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const
 {
 	int64 OutFlags = 0;
@@ -90,6 +90,37 @@ bool PCGExPointFilter::FDotFilter::Test(const int32 PointIndex) const
 		PointIndex);
 }
 
+void PCGExPointFilter::FDotFilter::TestScope(const PCGExMT::FScope& Scope, TArrayView<int8> OutResults) const
+{
+	const int32 Num = Scope.Count;
+
+	TArray<FVector> A;
+	TArray<FVector> B;
+	A.SetNumUninitialized(Num);
+	B.SetNumUninitialized(Num);
+
+	OperandA->ReadRange(Scope.Start, A);
+	OperandB->ReadRange(Scope.Start, B);
+
+	const bool bTransformA = TypedFilterFactory->Config.bTransformOperandA;
+	const bool bTransformB = TypedFilterFactory->Config.bTransformOperandB;
+
+	TArray<double> Dots;
+	Dots.SetNumUninitialized(Num);
+
+	for (int i = 0; i < Num; i++)
+	{
+		const FTransform& Transform = InTransforms[Scope.Start + i];
+		const FVector VA = A[i] * OperandAMultiplier;
+		const FVector VB = B[i].GetSafeNormal() * OperandBMultiplier;
+		Dots[i] = FVector::DotProduct(
+			bTransformA ? Transform.TransformVectorNoScale(VA) : VA,
+			bTransformB ? Transform.TransformVectorNoScale(VB) : VB);
+	}
+
+	DotComparison.TestRange(Scope.Start, Dots, OutResults);
+}
+
 bool PCGExPointFilter::FDotFilter::Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const
 {
 	PCGEX_SHARED_CONTEXT(IO->GetContextHandle())
@@ -38,6 +38,7 @@ void UPCGExInclusionFilterFactory::InitConfig_Internal()
 	WindingMutation = Config.WindingMutation;
 	bScaleTolerance = Config.bSplineScalesTolerance;
 	bIgnoreSelf = Config.bIgnoreSelf;
+	bUseInclusionGrid = Config.bUseInclusionGrid;
 }
 
 namespace PCGExPointFilter
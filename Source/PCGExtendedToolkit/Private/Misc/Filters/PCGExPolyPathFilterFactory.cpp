@@ -126,6 +126,7 @@ PCGExFactories::EPreparationResult UPCGExPolyPathFilterFactory::Prepare(FPCGExCo
 			if (Path)
 			{
 				if (bBuildEdgeOctree) { Path->BuildEdgeOctree(); }
+				if (bUseInclusionGrid) { Path->EnableInclusionGrid(); }
 				TempPolyPaths[Index] = Path;
 			}
 		};
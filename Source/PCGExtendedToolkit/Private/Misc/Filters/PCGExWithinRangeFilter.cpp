@@ -82,6 +82,34 @@ bool PCGExPointFilter::FWithinRangeFilter::Test(const int32 PointIndex) const
 	return bInvert;
 }
 
+void PCGExPointFilter::FWithinRangeFilter::TestScope(const PCGExMT::FScope& Scope, TArrayView<int8> OutResults) const
+{
+	const int32 Num = Scope.Count;
+
+	TArray<double> Values;
+	Values.SetNumUninitialized(Num);
+	OperandA->ReadRange(Scope.Start, Values);
+
+	// One branchless pass per range, accumulating whether each value falls in any of them
+	TArray<int8> Within;
+	Within.SetNumZeroed(Num);
+
+	const double* RESTRICT V = Values.GetData();
+	int8* RESTRICT W = Within.GetData();
+
+	for (const FPCGExPickerConstantRangeConfig& Range : Ranges)
+	{
+		const double Min = Range.RelativeStartIndex;
+		const double Max = Range.RelativeEndIndex;
+
+		if (bInclusive) { for (int i = 0; i < Num; i++) { W[i] |= static_cast<int8>(V[i] >= Min && V[i] <= Max); } }
+		else { for (int i = 0; i < Num; i++) { W[i] |= static_cast<int8>(V[i] >= Min && V[i] < Max); } }
+	}
+
+	int8* RESTRICT R = OutResults.GetData();
+	for (int i = 0; i < Num; i++) { R[i] &= static_cast<int8>(W[i] != bInvert); }
+}
+
 bool PCGExPointFilter::FWithinRangeFilter::Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const
 {
 	double A = 0;
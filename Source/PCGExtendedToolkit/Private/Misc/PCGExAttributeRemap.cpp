@@ -251,6 +251,9 @@ namespace PCGExAttributeRemap
 
 				This->PointDataFacade->Fetch(Scope);
 
+				TArray<double> Values;
+				Values.SetNumUninitialized(Scope.Count);
+
 				// Find min/max & clamp values
 
 				for (int d = 0; d < This->Dimensions; d++)
@@ -263,27 +266,29 @@ namespace PCGExAttributeRemap
 					double Min = MAX_dbl;
 					double Max = MIN_dbl_neg;
 
+					InProxy->GetRange(Scope, Values);
+
 					if (Rule.RemapDetails.bUseAbsoluteRange)
 					{
-						PCGEX_SCOPE_LOOP(i)
+						for (double& V : Values)
 						{
-							double V = Rule.InputClampDetails.GetClampedValue(InProxy->Get(i));
+							V = Rule.InputClampDetails.GetClampedValue(V);
 							Min = FMath::Min(Min, FMath::Abs(V));
 							Max = FMath::Max(Max, FMath::Abs(V));
-							OutProxy->Set(i, V);
 						}
 					}
 					else
 					{
-						PCGEX_SCOPE_LOOP(i)
+						for (double& V : Values)
 						{
-							double V = Rule.InputClampDetails.GetClampedValue(InProxy->Get(i));
+							V = Rule.InputClampDetails.GetClampedValue(V);
 							Min = FMath::Min(Min, V);
 							Max = FMath::Max(Max, V);
-							OutProxy->Set(i, V);
 						}
 					}
 
+					OutProxy->SetRange(Scope, Values);
+
 					Rule.MinCache->Set(Scope, Min);
 					Rule.MaxCache->Set(Scope, Max);
 				}
@@ -298,32 +303,33 @@ namespace PCGExAttributeRemap
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExAttributeRemap::RemapRange);
 
+		TArray<double> Values;
+		Values.SetNumUninitialized(Scope.Count);
+
 		for (int d = 0; d < Dimensions; d++)
 		{
 			FPCGExComponentRemapRule& Rule = Rules[d];
 			TSharedPtr<PCGExData::TBufferProxy<double>> InProxy = InputProxies[d];
 			TSharedPtr<PCGExData::TBufferProxy<double>> OutProxy = OutputProxies[d];
 
+			InProxy->GetRange(Scope, Values);
+
 			if (Rule.RemapDetails.bUseAbsoluteRange)
 			{
 				if (Rule.RemapDetails.bPreserveSign)
 				{
-					PCGEX_SCOPE_LOOP(i)
+					for (double& V : Values)
 					{
-						double V = InProxy->Get(i);
-						OutProxy->Set(
-							i, Rule.OutputClampDetails.GetClampedValue(
-								Rule.RemapDetails.GetRemappedValue(FMath::Abs(V)) * PCGExMath::SignPlus(V)));
+						V = Rule.OutputClampDetails.GetClampedValue(
+							Rule.RemapDetails.GetRemappedValue(FMath::Abs(V)) * PCGExMath::SignPlus(V));
 					}
 				}
 				else
 				{
-					PCGEX_SCOPE_LOOP(i)
+					for (double& V : Values)
 					{
-						OutProxy->Set(
-							i, Rule.OutputClampDetails.GetClampedValue(
-								Rule.RemapDetails.GetRemappedValue(
-									FMath::Abs(InProxy->Get(i)))));
+						V = Rule.OutputClampDetails.GetClampedValue(
+							Rule.RemapDetails.GetRemappedValue(FMath::Abs(V)));
 					}
 				}
 			}
@@ -331,25 +337,23 @@ namespace PCGExAttributeRemap
 			{
 				if (Rule.RemapDetails.bPreserveSign)
 				{
-					PCGEX_SCOPE_LOOP(i)
+					for (double& V : Values)
 					{
-						OutProxy->Set(
-							i, Rule.OutputClampDetails.GetClampedValue(
-								Rule.RemapDetails.GetRemappedValue(
-									InProxy->Get(i))));
+						V = Rule.OutputClampDetails.GetClampedValue(
+							Rule.RemapDetails.GetRemappedValue(V));
 					}
 				}
 				else
 				{
-					PCGEX_SCOPE_LOOP(i)
+					for (double& V : Values)
 					{
-						OutProxy->Set(
-							i, Rule.OutputClampDetails.GetClampedValue(
-								Rule.RemapDetails.GetRemappedValue(
-									FMath::Abs(InProxy->Get(i)))));
+						V = Rule.OutputClampDetails.GetClampedValue(
+							Rule.RemapDetails.GetRemappedValue(FMath::Abs(V)));
 					}
 				}
 			}
+
+			OutProxy->SetRange(Scope, Values);
 		}
 	}
 
@@ -93,11 +93,7 @@ namespace PCGExBlendAttributes
 		PointDataFacade->Fetch(Scope);
 		FilterScope(Scope);
 
-		PCGEX_SCOPE_LOOP(Index)
-		{
-			if (!PointFilterCache[Index]) { continue; }
-			BlendOpsManager->BlendAutoWeight(Index, Index);
-		}
+		BlendOpsManager->BlendAutoWeightRange(Scope, Scope.GetView(PointFilterCache));
 	}
 
 	void FProcessor::CompleteWork()
@@ -134,7 +134,7 @@ namespace PCGExFusePoints
 		for (int i = 0; i < Scope.Count; ++i)
 		{
 			const int32 Idx = Scope.Start + i;
-			ReadIndices[i] = UnionGraph->Nodes[Idx]->Point.Index;
+			ReadIndices[i] = UnionGraph->Nodes[Idx].Point.Index;
 			WriteIndices[i] = Idx;
 		}
 
@@ -148,7 +148,7 @@ namespace PCGExFusePoints
 
 		PCGEX_SCOPE_LOOP(Index)
 		{
-			const FVector Center = UnionGraph->Nodes[Index]->UpdateCenter(UnionGraph->NodesUnion, Context->MainPoints);
+			const FVector Center = UnionGraph->Nodes[Index].UpdateCenter(UnionGraph->NodesUnion, Context->MainPoints);
 
 			if (bUpdateCenter) { Transforms[Index].SetLocation(Center); }
 
@@ -160,6 +160,8 @@ namespace PCGExFusePoints
 
 	void FProcessor::CompleteWork()
 	{
+		UnionGraph->MergeShards();
+
 		const int32 NumUnionNodes = UnionGraph->Nodes.Num();
 
 		UPCGBasePointData* OutData = PointDataFacade->GetOut();
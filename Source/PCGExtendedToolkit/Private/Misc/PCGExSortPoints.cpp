@@ -101,7 +101,7 @@ namespace PCGExSortPoints
 
 		TArray<int32> Order;
 		PCGEx::ArrayOfIndices(Order, PointDataFacade->GetNum());
-		Order.Sort([&](const int32 A, const int32 B) { return Sorter->Sort(A, B); });
+		Sorter->Sort(Order);
 
 		PointDataFacade->Source->InheritPoints(Order, 0);
 
@@ -171,6 +171,72 @@ namespace PCGExCompare
 		}
 	}
 
+#define PCGEX_COMPARE_RANGE(_EXPR) for (int i = 0; i < Num; i++) { R[i] &= static_cast<int8>(_EXPR); } break;
+
+	void CompareRange(const EPCGExComparison Method, const TConstArrayView<double> A, const TConstArrayView<double> B, TArrayView<int8> InOutResults, const double Tolerance)
+	{
+		check(A.Num() == InOutResults.Num() && B.Num() == InOutResults.Num())
+
+		// Method is resolved once per span so each loop stays branchless and can be vectorized
+		const int32 Num = InOutResults.Num();
+		const double* RESTRICT PA = A.GetData();
+		const double* RESTRICT PB = B.GetData();
+		int8* RESTRICT R = InOutResults.GetData();
+
+		switch (Method)
+		{
+		case EPCGExComparison::StrictlyEqual:
+			PCGEX_COMPARE_RANGE(PA[i] == PB[i])
+		case EPCGExComparison::StrictlyNotEqual:
+			PCGEX_COMPARE_RANGE(PA[i] != PB[i])
+		case EPCGExComparison::EqualOrGreater:
+			PCGEX_COMPARE_RANGE(PA[i] >= PB[i])
+		case EPCGExComparison::EqualOrSmaller:
+			PCGEX_COMPARE_RANGE(PA[i] <= PB[i])
+		case EPCGExComparison::StrictlyGreater:
+			PCGEX_COMPARE_RANGE(PA[i] > PB[i])
+		case EPCGExComparison::StrictlySmaller:
+			PCGEX_COMPARE_RANGE(PA[i] < PB[i])
+		case EPCGExComparison::NearlyEqual:
+			PCGEX_COMPARE_RANGE(FMath::Abs(PA[i] - PB[i]) <= Tolerance)
+		case EPCGExComparison::NearlyNotEqual:
+			PCGEX_COMPARE_RANGE(FMath::Abs(PA[i] - PB[i]) > Tolerance)
+		default:
+			FMemory::Memzero(R, Num);
+			break;
+		}
+	}
+
+	void CompareRange(const EPCGExBitflagComparison Method, const TConstArrayView<int64> Flags, const TConstArrayView<int64> Masks, TArrayView<int8> InOutResults, const bool bInvert)
+	{
+		check(Flags.Num() == InOutResults.Num() && Masks.Num() == InOutResults.Num())
+
+		const int32 Num = InOutResults.Num();
+		const int64* RESTRICT F = Flags.GetData();
+		const int64* RESTRICT M = Masks.GetData();
+		int8* RESTRICT R = InOutResults.GetData();
+
+		switch (Method)
+		{
+		case EPCGExBitflagComparison::MatchPartial:
+			PCGEX_COMPARE_RANGE(((F[i] & M[i]) != 0) != bInvert)
+		case EPCGExBitflagComparison::MatchFull:
+			PCGEX_COMPARE_RANGE(((F[i] & M[i]) == M[i]) != bInvert)
+		case EPCGExBitflagComparison::MatchStrict:
+			PCGEX_COMPARE_RANGE((F[i] == M[i]) != bInvert)
+		case EPCGExBitflagComparison::NoMatchPartial:
+			PCGEX_COMPARE_RANGE(((F[i] & M[i]) == 0) != bInvert)
+		case EPCGExBitflagComparison::NoMatchFull:
+			PCGEX_COMPARE_RANGE(((F[i] & M[i]) != M[i]) != bInvert)
+		default:
+			// Scalar Compare fails on unknown methods, which inverts to a pass
+			if (!bInvert) { FMemory::Memzero(R, Num); }
+			break;
+		}
+	}
+
+#undef PCGEX_COMPARE_RANGE
+
 	bool HasMatchingTags(const TSharedPtr<PCGExData::FTags>& InTags, const FString& Query, const EPCGExStringMatchMode MatchMode, const bool bStrict)
 	{
 		if (bStrict)
@@ -339,6 +405,37 @@ bool FPCGExDotComparisonDetails::Test(const double A, const int32 Index) const
 	return Test(A, GetComparisonThreshold(Index));
 }
 
+void FPCGExDotComparisonDetails::TestRange(const int32 Start, TArrayView<double> Dots, TArrayView<int8> InOutResults) const
+{
+	const int32 Num = Dots.Num();
+
+	TArray<double> Thresholds;
+	Thresholds.SetNumUninitialized(Num);
+	ThresholdGetter->ReadRange(Start, Thresholds);
+
+	if (Domain != EPCGExAngularDomain::Scalar) { for (double& Threshold : Thresholds) { Threshold = PCGExMath::DegreesToDot(180 - Threshold); } }
+
+	// Same remapping as Test(A, B), applied to both operands
+	if (bUnsignedComparison)
+	{
+		for (int i = 0; i < Num; i++)
+		{
+			Dots[i] = FMath::Abs(Dots[i]);
+			Thresholds[i] = FMath::Abs(Thresholds[i]);
+		}
+	}
+	else
+	{
+		for (int i = 0; i < Num; i++)
+		{
+			Dots[i] = (1 + Dots[i]) * 0.5;
+			Thresholds[i] = (1 + Thresholds[i]) * 0.5;
+		}
+	}
+
+	PCGExCompare::CompareRange(Comparison, Dots, Thresholds, InOutResults, ComparisonTolerance);
+}
+
 void FPCGExDotComparisonDetails::RegisterBuffersDependencies(FPCGExContext* InContext, PCGExData::FFacadePreloader& FacadePreloader) const
 {
 	if (ThresholdInput == EPCGExInputValueType::Attribute) { FacadePreloader.Register<double>(InContext, ThresholdAttribute); }
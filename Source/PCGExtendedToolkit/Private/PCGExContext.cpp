@@ -7,6 +7,7 @@
 #include "PCGExHelpers.h"
 #include "Details/PCGExMacros.h"
 #include "PCGExMT.h"
+#include "PCGExTelemetry.h"
 #include "PCGManagedResource.h"
 #include "Engine/AssetManager.h"
 #include "Helpers/PCGHelpers.h"
@@ -158,10 +159,12 @@ FPCGExContext::FPCGExContext()
 	WorkPermit = MakeShared<PCGEx::FWorkPermit>();
 	ManagedObjects = MakeShared<PCGEx::FManagedObjects>(this);
 	UniqueNameGenerator = MakeShared<PCGEx::FUniqueNameGenerator>();
+	if (PCGExTelemetry::IsEnabled()) { Telemetry = MakeShared<PCGExTelemetry::FExecutionTelemetry>(); }
 }
 
 FPCGExContext::~FPCGExContext()
 {
+	if (Telemetry) { Telemetry->Submit(this); }
 	WorkPermit.Reset();
 	CancelAssetLoading();
 	ManagedObjects->Flush(); // So cleanups can be recursively triggered while manager is still alive
@@ -213,6 +216,8 @@ void FPCGExContext::OnComplete()
 
 	FWriteScopeLock WriteScopeLock(StagedOutputLock);
 	ManagedObjects->Remove(OutputData.TaggedData);
+
+	if (Telemetry) { Telemetry->Submit(this); }
 }
 
 
@@ -244,6 +249,7 @@ void FPCGExContext::ReadyForExecution()
 void FPCGExContext::SetState(const PCGExCommon::ContextState StateId)
 {
 	CurrentState.store(StateId, std::memory_order_release);
+	if (Telemetry) { Telemetry->EnterPhase(PCGExTelemetry::GetPhase(StateId)); }
 }
 
 void FPCGExContext::Done()
@@ -9,7 +9,10 @@
 #include "PCGExContext.h"
 #include "PCGExGlobalSettings.h"
 #include "PCGExSubSystem.h"
+#include "PCGExTelemetry.h"
 #include "HAL/PlatformTime.h"
+#include "Async/Fundamental/Scheduler.h"
+#include "UObject/ObjectKey.h"
 
 namespace PCGExMT
 {
@@ -63,6 +66,173 @@ namespace PCGExMT
 		return OutSubRanges.Num();
 	}
 
+	FScopeRangeScheduler::FScopeRangeScheduler(TArray<FScope>&& InScopes, const int32 InNumWorkers, const bool InPrepareOnly)
+		: Scopes(MoveTemp(InScopes)), bPrepareOnly(InPrepareOnly)
+	{
+		const int32 NumScopes = Scopes.Num();
+		NumRanges = FMath::Clamp(InNumWorkers, 1, FMath::Max(1, NumScopes));
+		Ranges = MakeUnique<FWorkerRange[]>(NumRanges);
+
+		// Even split, the first workers get one extra scope if it doesn't divide
+		const int32 PerWorker = NumScopes / NumRanges;
+		const int32 Remainder = NumScopes % NumRanges;
+
+		int32 Cursor = 0;
+		for (int32 i = 0; i < NumRanges; i++)
+		{
+			const int32 Count = PerWorker + (i < Remainder ? 1 : 0);
+			Ranges[i].Range.store(Pack(Cursor, Cursor + Count), std::memory_order_relaxed);
+			Cursor += Count;
+		}
+	}
+
+	bool FScopeRangeScheduler::Next(const int32 WorkerIndex, int32& OutScopeIndex)
+	{
+		return Pop(WorkerIndex, OutScopeIndex) || Steal(WorkerIndex, OutScopeIndex);
+	}
+
+	bool FScopeRangeScheduler::Pop(const int32 WorkerIndex, int32& OutScopeIndex)
+	{
+		std::atomic<uint64>& Range = Ranges[WorkerIndex].Range;
+		uint64 Current = Range.load(std::memory_order_acquire);
+
+		while (Begin(Current) < End(Current))
+		{
+			if (Range.compare_exchange_weak(Current, Pack(Begin(Current) + 1, End(Current)), std::memory_order_acq_rel))
+			{
+				OutScopeIndex = Begin(Current);
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool FScopeRangeScheduler::Steal(const int32 WorkerIndex, int32& OutScopeIndex)
+	{
+		for (int32 i = 1; i < NumRanges; i++)
+		{
+			std::atomic<uint64>& VictimRange = Ranges[(WorkerIndex + i) % NumRanges].Range;
+			uint64 Current = VictimRange.load(std::memory_order_acquire);
+
+			while (Begin(Current) < End(Current))
+			{
+				const uint32 VictimBegin = Begin(Current);
+				const uint32 VictimEnd = End(Current);
+
+				// Take the back half, or the last remaining scope
+				const uint32 Mid = VictimEnd - VictimBegin > 1 ? VictimBegin + (VictimEnd - VictimBegin) / 2 : VictimBegin;
+				const uint64 Remaining = Mid == VictimBegin ? Pack(VictimEnd, VictimEnd) : Pack(VictimBegin, Mid);
+
+				if (VictimRange.compare_exchange_weak(Current, Remaining, std::memory_order_acq_rel))
+				{
+					// Our own range is empty at this point; keep the rest of the stolen range for ourselves
+					Ranges[WorkerIndex].Range.store(Pack(Mid + 1, VictimEnd), std::memory_order_release);
+					OutScopeIndex = Mid;
+					return true;
+				}
+			}
+		}
+
+		return false;
+	}
+
+	namespace ChunkSizeTuning
+	{
+		constexpr int32 MinChunkSize = 16;
+		constexpr uint64 MinSampleItems = 256;       // Below this, the estimate is too noisy to act upon
+		constexpr uint64 MaxSampleItems = 1ull << 22; // Past this, older samples start to fade out
+
+		// Object keys carry a serial number, so a new object reusing a destroyed one's index never picks up its estimates
+		using FEstimateKey = TPair<FObjectKey, FName>;
+
+		FRWLock EstimatesLock;
+		TMap<FEstimateKey, TSharedPtr<FChunkSizeTuner::FEstimate>> Estimates;
+		int32 PruneThreshold = 64;
+
+		// Drops estimates of owners that no longer exist; amortized by only running when the map doubled since the last pass
+		void PruneStaleEstimates_Unsafe()
+		{
+			if (Estimates.Num() < PruneThreshold) { return; }
+
+			for (auto It = Estimates.CreateIterator(); It; ++It)
+			{
+				if (!It->Key.Key.ResolveObjectPtr()) { It.RemoveCurrent(); }
+			}
+
+			PruneThreshold = FMath::Max(64, Estimates.Num() * 2);
+		}
+	}
+
+	FChunkSizeTuner::FChunkSizeTuner(const TSharedPtr<FEstimate>& InEstimate, const UObject* InOwner, const FName InLoopName)
+		: Estimate(InEstimate), Owner(InOwner), LoopName(InLoopName)
+	{
+	}
+
+	TSharedPtr<FChunkSizeTuner> FChunkSizeTuner::TryCreate(const UObject* InOwner, const FName InLoopName)
+	{
+		if (!InOwner || !GetDefault<UPCGExGlobalSettings>()->bAutoTuneBatchChunkSize) { return nullptr; }
+
+		const ChunkSizeTuning::FEstimateKey Key(FObjectKey(InOwner), InLoopName);
+		TSharedPtr<FEstimate> Estimate;
+
+		{
+			FReadScopeLock ReadScopeLock(ChunkSizeTuning::EstimatesLock);
+			if (const TSharedPtr<FEstimate>* Existing = ChunkSizeTuning::Estimates.Find(Key)) { Estimate = *Existing; }
+		}
+
+		if (!Estimate)
+		{
+			FWriteScopeLock WriteScopeLock(ChunkSizeTuning::EstimatesLock);
+			ChunkSizeTuning::PruneStaleEstimates_Unsafe();
+
+			TSharedPtr<FEstimate>& Entry = ChunkSizeTuning::Estimates.FindOrAdd(Key);
+			if (!Entry) { Entry = MakeShared<FEstimate>(); }
+			Estimate = Entry;
+		}
+
+		return MakeShared<FChunkSizeTuner>(Estimate, InOwner, InLoopName);
+	}
+
+	int32 FChunkSizeTuner::GetChunkSize(const int32 NumIterations, const int32 DefaultChunkSize) const
+	{
+		uint64 Items = Estimate->Items.load(std::memory_order_relaxed);
+		uint64 Cycles = Estimate->Cycles.load(std::memory_order_relaxed);
+
+		if (Items < ChunkSizeTuning::MinSampleItems || Cycles == 0) { return DefaultChunkSize; }
+
+		if (Items > ChunkSizeTuning::MaxSampleItems)
+		{
+			// Racy by design; at worst a concurrent sample is dropped
+			Items /= 2;
+			Cycles /= 2;
+			Estimate->Items.store(Items, std::memory_order_relaxed);
+			Estimate->Cycles.store(Cycles, std::memory_order_relaxed);
+		}
+
+		const double SecondsPerItem = FPlatformTime::ToSeconds64(Cycles) / static_cast<double>(Items);
+		const double TargetSeconds = GetDefault<UPCGExGlobalSettings>()->AutoTuneTargetChunkDuration * 1e-6;
+		const int32 NumWorkers = static_cast<int32>(LowLevelTasks::FScheduler::Get().GetNumWorkers()) + 1;
+
+		double ChunkSize = TargetSeconds / FMath::Max(SecondsPerItem, UE_DOUBLE_SMALL_NUMBER);
+
+		// If the whole loop is worth spreading, keep a couple of chunks per worker so a slow chunk doesn't hold up the rest
+		if (SecondsPerItem * NumIterations > TargetSeconds * 2)
+		{
+			ChunkSize = FMath::Min(ChunkSize, static_cast<double>(FMath::DivideAndRoundUp(NumIterations, NumWorkers * 2)));
+		}
+
+		const int32 Result = FMath::Clamp(static_cast<int32>(FMath::Min(ChunkSize, static_cast<double>(NumIterations))), FMath::Min(ChunkSizeTuning::MinChunkSize, NumIterations), FMath::Max(1, NumIterations));
+
+		if (Estimate->LastChunkSize.exchange(Result, std::memory_order_relaxed) != Result)
+		{
+			UE_LOG(LogPCGEx, Verbose, TEXT("%s / %s : chunk size %d (%.1f ns per item, %d items)"),
+			       Owner.IsValid() ? *Owner->GetName() : TEXT("?"), *LoopName.ToString(), Result, SecondsPerItem * 1e9, NumIterations);
+		}
+
+		return Result;
+	}
+
 	void AssertEmptyThread(const int32 MaxItems)
 	{
 		// This error can only be triggered from two places, and it's due to an edge-case that's setup-dependant
@@ -265,6 +435,7 @@ namespace PCGExMT
 		: FAsyncMultiHandle(InForceSync, FName("ROOT")), Context(InContext), ContextHandle(InContext->GetOrCreateHandle())
 	{
 		WorkPermit = Context->GetWorkPermit();
+		Telemetry = Context->Telemetry;
 	}
 
 	FTaskManager::~FTaskManager()
@@ -469,6 +640,8 @@ namespace PCGExMT
 		TSharedPtr<FTaskManager> LocalManager = SharedThis(this);
 		if (!InTask->SetRoot(LocalManager, Idx)) { return; }
 
+		if (Telemetry) { Telemetry->AddTasks(1); }
+
 		PCGEX_SHARED_THIS_DECL
 		UE::Tasks::Launch(
 				*InTask->HandleId(),
@@ -497,6 +670,7 @@ namespace PCGExMT
 		if (!IsAvailable()) { return; }
 
 		InTask->SetRoot(SharedThis(this));
+		if (Telemetry) { Telemetry->AddTasks(1); }
 		FAsyncMultiHandle::StartSynchronousTask(InTask);
 	}
 
@@ -518,6 +692,7 @@ namespace PCGExMT
 			bForceSingleThreadeded = true;
 
 			SetExpectedTaskCount(SubLoopScopes(Loops, MaxItems, SanitizedChunkSize));
+			RecordLoop(MaxItems);
 
 			if (OnPrepareSubLoopsCallback) { OnPrepareSubLoopsCallback(Loops); }
 
@@ -526,7 +701,7 @@ namespace PCGExMT
 		}
 		else
 		{
-			StartRanges<FScopeIterationTask>(MaxItems, SanitizedChunkSize, false);
+			StartScopeRanges(MaxItems, SanitizedChunkSize, false);
 		}
 	}
 
@@ -534,7 +709,7 @@ namespace PCGExMT
 	{
 		if (!bForceSingleThreaded)
 		{
-			StartRanges<FScopeIterationTask>(MaxItems, ChunkSize, true);
+			StartScopeRanges(MaxItems, ChunkSize, true);
 			return;
 		}
 
@@ -548,6 +723,7 @@ namespace PCGExMT
 		// Compute sub scopes
 		SetExpectedTaskCount(SubLoopScopes(Loops, MaxItems, FMath::Max(1, ChunkSize)));
 		StaticCastSharedPtr<FTaskManager>(PinnedRoot)->ReserveTasks(Loops.Num());
+		RecordLoop(MaxItems);
 
 		bForceSingleThreadeded = true;
 
@@ -587,6 +763,51 @@ namespace PCGExMT
 		SimpleCallbacks[Index]();
 	}
 
+	void FTaskGroup::StartScopeRanges(const int32 MaxItems, const int32 ChunkSize, const bool bPrepareOnly)
+	{
+		if (!IsAvailable()) { return; }
+
+		const TSharedPtr<FAsyncMultiHandle> PinnedRoot = Root.Pin();
+		if (!PinnedRoot) { return; }
+
+		if (MaxItems <= 0)
+		{
+			AssertEmptyThread(MaxItems);
+			return;
+		}
+
+		const int32 NumScopes = SubLoopScopes(Loops, MaxItems, FMath::Max(1, ChunkSize));
+		RecordLoop(MaxItems);
+
+		if (OnPrepareSubLoopsCallback) { OnPrepareSubLoopsCallback(Loops); }
+
+		// One task per worker thread, plus one since the thread that triggered the loop is usually idle until it completes
+		const int32 NumWorkers = bForceSync ? 1 : FMath::Min(NumScopes, static_cast<int32>(LowLevelTasks::FScheduler::Get().GetNumWorkers()) + 1);
+
+		PCGEX_MAKE_SHARED(Scheduler, FScopeRangeScheduler, MoveTemp(Loops), NumWorkers, bPrepareOnly)
+		Loops.Reset();
+
+		SetExpectedTaskCount(Scheduler->NumWorkers());
+		StaticCastSharedPtr<FTaskManager>(PinnedRoot)->ReserveTasks(Scheduler->NumWorkers());
+
+		for (int32 i = 0; i < Scheduler->NumWorkers(); i++)
+		{
+			PCGEX_MAKE_SHARED(Task, FScopeRangeWorkerTask, i, Scheduler)
+			Launch(Task);
+		}
+	}
+
+	void FTaskGroup::RecordLoop(const int32 MaxItems) const
+	{
+		const TSharedPtr<FAsyncMultiHandle> PinnedRoot = Root.Pin();
+		if (!PinnedRoot) { return; }
+
+		if (const FTaskManager* Manager = static_cast<FTaskManager*>(PinnedRoot.Get()); Manager->Telemetry)
+		{
+			Manager->Telemetry->AddLoop(MaxItems, Loops.Num());
+		}
+	}
+
 	void FTaskGroup::ExecScopeIterations(const FScope& Scope, const bool bPrepareOnly) const
 	{
 		if (!IsAvailable()) { return; }
@@ -614,6 +835,21 @@ namespace PCGExMT
 		StaticCastSharedPtr<FTaskGroup>(PinnedParent)->ExecScopeIterations(Scope, bPrepareOnly);
 	}
 
+	void FScopeRangeWorkerTask::ExecuteTask(const TSharedPtr<FTaskManager>& AsyncManager)
+	{
+		const TSharedPtr<FAsyncMultiHandle> PinnedParent = ParentHandle.Pin();
+		if (!PinnedParent) { return; }
+
+		const TSharedPtr<FTaskGroup> Group = StaticCastSharedPtr<FTaskGroup>(PinnedParent);
+
+		int32 ScopeIndex = -1;
+		while (Scheduler->Next(TaskIndex, ScopeIndex))
+		{
+			if (!Group->IsAvailable()) { return; }
+			Group->ExecScopeIterations(Scheduler->Scopes[ScopeIndex], Scheduler->bPrepareOnly);
+		}
+	}
+
 	void FForceSingleThreadedScopeIterationTask::ExecuteTask(const TSharedPtr<FTaskManager>& AsyncManager)
 	{
 		const TSharedPtr<FAsyncMultiHandle> PinnedParent = ParentHandle.Pin();
@@ -3,6 +3,8 @@
 
 #include "PCGExSorting.h"
 
+#include "Algo/StableSort.h"
+#include "Async/ParallelFor.h"
 #include "PCGExCompare.h"
 #include "PCGExGlobalSettings.h"
 #include "Data/PCGExData.h"
@@ -317,6 +319,257 @@ namespace PCGExSorting
 		return Result < 0;
 	}
 
+	namespace
+	{
+		constexpr int32 KeyReadChunkSize = 4096;
+		constexpr int32 RadixBits = 8;
+		constexpr int32 RadixBuckets = 1 << RadixBits;
+		constexpr int32 SortChunkSize = 16384;
+
+		/** Stable parallel LSD radix sort of (Key, Index) pairs, only looking at the lowest NumBits of each key */
+		void RadixSort(TArray<uint64>& Keys, TArray<int32>& Indices, const int32 NumBits)
+		{
+			const int32 Num = Keys.Num();
+			const int32 NumChunks = FMath::Clamp(Num / SortChunkSize, 1, 64);
+			const int32 ChunkSize = FMath::DivideAndRoundUp(Num, NumChunks);
+
+			TArray<uint64> TempKeys;
+			TArray<int32> TempIndices;
+			TempKeys.SetNumUninitialized(Num);
+			TempIndices.SetNumUninitialized(Num);
+
+			// Per-chunk bucket counts, then write offsets
+			TArray<int32> Offsets;
+			Offsets.SetNumUninitialized(NumChunks * RadixBuckets);
+
+			for (int32 Shift = 0; Shift < NumBits; Shift += RadixBits)
+			{
+				FMemory::Memzero(Offsets.GetData(), Offsets.Num() * sizeof(int32));
+
+				ParallelFor(
+					NumChunks, [&](const int32 Chunk)
+					{
+						int32* RESTRICT Counts = Offsets.GetData() + Chunk * RadixBuckets;
+						const int32 End = FMath::Min(Num, (Chunk + 1) * ChunkSize);
+						for (int32 i = Chunk * ChunkSize; i < End; i++) { Counts[(Keys[i] >> Shift) & (RadixBuckets - 1)]++; }
+					}, NumChunks == 1);
+
+				// Exclusive prefix sum in (bucket, chunk) order keeps the sort stable
+				int32 Sum = 0;
+				bool bSingleBucket = false;
+				for (int32 b = 0; b < RadixBuckets; b++)
+				{
+					const int32 BucketStart = Sum;
+					for (int32 c = 0; c < NumChunks; c++)
+					{
+						int32& Offset = Offsets[c * RadixBuckets + b];
+						const int32 Count = Offset;
+						Offset = Sum;
+						Sum += Count;
+					}
+					if (Sum - BucketStart == Num) { bSingleBucket = true; }
+				}
+
+				// All keys share this digit, nothing to move
+				if (bSingleBucket) { continue; }
+
+				ParallelFor(
+					NumChunks, [&](const int32 Chunk)
+					{
+						int32* RESTRICT Write = Offsets.GetData() + Chunk * RadixBuckets;
+						const int32 End = FMath::Min(Num, (Chunk + 1) * ChunkSize);
+						for (int32 i = Chunk * ChunkSize; i < End; i++)
+						{
+							const int32 Dst = Write[(Keys[i] >> Shift) & (RadixBuckets - 1)]++;
+							TempKeys[Dst] = Keys[i];
+							TempIndices[Dst] = Indices[i];
+						}
+					}, NumChunks == 1);
+
+				Swap(Keys, TempKeys);
+				Swap(Indices, TempIndices);
+			}
+		}
+
+		/** Stable parallel merge sort: chunks are sorted concurrently, then merged pairwise level by level */
+		template <typename PredicateType>
+		void MergeSort(TArray<int32>& Indices, PredicateType&& Predicate)
+		{
+			const int32 Num = Indices.Num();
+			const int32 NumChunks = FMath::Max(1, FMath::DivideAndRoundUp(Num, SortChunkSize));
+
+			ParallelFor(
+				NumChunks, [&](const int32 Chunk)
+				{
+					const int32 Start = Chunk * SortChunkSize;
+					TArrayView<int32> View = MakeArrayView(Indices.GetData() + Start, FMath::Min(SortChunkSize, Num - Start));
+					Algo::StableSort(View, Predicate);
+				}, NumChunks == 1);
+
+			if (NumChunks == 1) { return; }
+
+			TArray<int32> Temp;
+			Temp.SetNumUninitialized(Num);
+
+			for (int32 Width = SortChunkSize; Width < Num; Width *= 2)
+			{
+				const int32 NumMerges = FMath::DivideAndRoundUp(Num, 2 * Width);
+				ParallelFor(
+					NumMerges, [&](const int32 Merge)
+					{
+						const int32 Start = Merge * 2 * Width;
+						const int32 Mid = FMath::Min(Start + Width, Num);
+						const int32 End = FMath::Min(Start + 2 * Width, Num);
+
+						int32 L = Start;
+						int32 R = Mid;
+						int32 Dst = Start;
+
+						// Take from the right run only when strictly smaller, to stay stable
+						while (L < Mid && R < End) { Temp[Dst++] = Predicate(Indices[R], Indices[L]) ? Indices[R++] : Indices[L++]; }
+						while (L < Mid) { Temp[Dst++] = Indices[L++]; }
+						while (R < End) { Temp[Dst++] = Indices[R++]; }
+					});
+
+				Swap(Indices, Temp);
+			}
+		}
+	}
+
+	void FPointSorter::BuildKeys(TArray<uint64>& OutKeys, TArray<int32>& OutBits) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FPointSorter::BuildKeys);
+
+		const int32 NumRules = RuleHandlers.Num();
+		const int32 NumPoints = DataFacade->GetNum();
+		const int32 NumReads = FMath::DivideAndRoundUp(NumPoints, KeyReadChunkSize);
+
+		OutKeys.SetNumUninitialized(NumRules * NumPoints);
+		OutBits.SetNumUninitialized(NumRules);
+
+		TArray<double> Values;
+		Values.SetNumUninitialized(NumPoints);
+
+		for (int32 r = 0; r < NumRules; r++)
+		{
+			const FRuleHandler& RuleHandler = *RuleHandlers[r].Get();
+
+			ParallelFor(
+				NumReads, [&](const int32 Read)
+				{
+					const PCGExMT::FScope Scope(Read * KeyReadChunkSize, FMath::Min(KeyReadChunkSize, NumPoints - Read * KeyReadChunkSize));
+					RuleHandler.Buffer->ReadRangeAsDouble(Scope, Scope.GetView(Values));
+				}, NumReads == 1);
+
+			double Min = MAX_dbl;
+			double Max = MIN_dbl_neg;
+			bool bAllFinite = true;
+			for (const double V : Values)
+			{
+				if (!FMath::IsFinite(V)) { bAllFinite = false; }
+				Min = FMath::Min(Min, V);
+				Max = FMath::Max(Max, V);
+			}
+
+			// Values within tolerance share a bucket, as long as a double can tell all the buckets apart.
+			// Otherwise (non-finite values, or a range too wide for the tolerance) buckets would merge distinct values,
+			// so keys are taken from the IEEE-754 bit pattern instead: exact ordering, tolerance is ignored for that rule.
+			const double Range = Max - Min;
+			const double Step = FMath::Max(RuleHandler.Tolerance, UE_DOUBLE_SMALL_NUMBER);
+			const bool bBucketed = bAllFinite && FMath::IsFinite(Range) && Range / Step <= static_cast<double>(1ULL << 53);
+			const uint64 MaxKey = bBucketed ? static_cast<uint64>(FMath::Floor(Range / Step)) : MAX_uint64;
+
+			// Descending output flips every rule, inverted rules flip once more
+			const bool bFlip = RuleHandler.bInvertRule != (SortDirection == EPCGExSortDirection::Descending);
+
+			uint64* RESTRICT Keys = OutKeys.GetData() + r * NumPoints;
+			ParallelFor(
+				NumReads, [&](const int32 Read)
+				{
+					const int32 Start = Read * KeyReadChunkSize;
+					const int32 End = FMath::Min(NumPoints, Start + KeyReadChunkSize);
+
+					if (bBucketed)
+					{
+						for (int32 i = Start; i < End; i++)
+						{
+							const uint64 Key = FMath::Min(MaxKey, static_cast<uint64>(FMath::Floor((Values[i] - Min) / Step)));
+							Keys[i] = bFlip ? MaxKey - Key : Key;
+						}
+					}
+					else
+					{
+						for (int32 i = Start; i < End; i++)
+						{
+							// Positives get their sign bit set, negatives get all bits flipped; -0 is folded into +0
+							const double Value = Values[i] == 0 ? 0.0 : Values[i];
+							uint64 Bits;
+							FMemory::Memcpy(&Bits, &Value, sizeof(uint64));
+							const uint64 Key = Bits & (1ULL << 63) ? ~Bits : Bits | (1ULL << 63);
+							Keys[i] = bFlip ? ~Key : Key;
+						}
+					}
+				}, NumReads == 1);
+
+			OutBits[r] = MaxKey == 0 ? 0 : 64 - FMath::CountLeadingZeros64(MaxKey);
+		}
+	}
+
+	void FPointSorter::Sort(TArray<int32>& InOutIndices)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FPointSorter::SortIndices);
+
+		if (InOutIndices.Num() < 2 || RuleHandlers.IsEmpty()) { return; }
+
+		const int32 NumRules = RuleHandlers.Num();
+		const int32 NumPoints = DataFacade->GetNum();
+
+		TArray<uint64> RuleKeys;
+		TArray<int32> RuleBits;
+		BuildKeys(RuleKeys, RuleBits);
+
+		int32 TotalBits = 0;
+		for (const int32 Bits : RuleBits) { TotalBits += Bits; }
+
+		if (TotalBits == 0) { return; } // Everything compares equal
+
+		if (TotalBits <= 64)
+		{
+			// Pack all rules in a single key, first rule in the most significant bits
+			TArray<uint64> Keys;
+			Keys.SetNumUninitialized(InOutIndices.Num());
+
+			ParallelFor(
+				InOutIndices.Num(), [&](const int32 i)
+				{
+					const int32 Index = InOutIndices[i];
+					uint64 Key = 0;
+					for (int32 r = 0; r < NumRules; r++)
+					{
+						if (!RuleBits[r]) { continue; }
+						Key = (Key << RuleBits[r]) | RuleKeys[r * NumPoints + Index];
+					}
+					Keys[i] = Key;
+				}, InOutIndices.Num() < KeyReadChunkSize);
+
+			RadixSort(Keys, InOutIndices, TotalBits);
+		}
+		else
+		{
+			MergeSort(
+				InOutIndices, [&](const int32 A, const int32 B)
+				{
+					for (int32 r = 0; r < NumRules; r++)
+					{
+						const uint64 KeyA = RuleKeys[r * NumPoints + A];
+						const uint64 KeyB = RuleKeys[r * NumPoints + B];
+						if (KeyA != KeyB) { return KeyA < KeyB; }
+					}
+					return false;
+				});
+		}
+	}
+
 	TArray<FPCGExSortRuleConfig> GetSortingRules(FPCGExContext* InContext, const FName InLabel)
 	{
 		TArray<FPCGExSortRuleConfig> OutRules;
@@ -0,0 +1,384 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "PCGExTelemetry.h"
+
+#include "PCGComponent.h"
+#include "GameFramework/Actor.h"
+#include "PCGNode.h"
+#include "PCGExContext.h"
+#include "PCGExGlobalSettings.h"
+#include "PCGExPointsMT.h"
+#include "Data/PCGExDataPreloader.h"
+#include "Graph/PCGExClusterMT.h"
+#include "Graph/PCGExGraph.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+
+namespace PCGExTelemetry
+{
+	static TAutoConsoleVariable<bool> CVarTelemetry(
+		TEXT("pcgex.Telemetry"), false,
+		TEXT("Collect per-node execution telemetry for PCGEx elements. See pcgex.Telemetry.Dump / Print / Reset."));
+
+	namespace Registry
+	{
+		FCriticalSection Lock;
+		TArray<FRecord> Records;
+		int32 Next = 0; // Oldest record once the ring is full
+	}
+
+	namespace
+	{
+		constexpr int32 NumPhases = static_cast<int32>(EPhase::Num);
+
+		template <typename T>
+		void AtomicMax(std::atomic<T>& Target, const T Value)
+		{
+			T Current = Target.load(std::memory_order_relaxed);
+			while (Value > Current && !Target.compare_exchange_weak(Current, Value, std::memory_order_relaxed))
+			{
+			}
+		}
+
+		struct FNodeTotals
+		{
+			FString Node;
+			FString NodeClass;
+			int32 NumExecutions = 0;
+			int32 NumCancelled = 0;
+			double PhaseSeconds[NumPhases] = {};
+			double TotalSeconds = 0;
+			double MaxSeconds = 0;
+			int64 NumTasks = 0;
+			int64 BufferBytes = 0;
+			int64 PeakClusterBytes = 0;
+		};
+
+		void GatherTotals(const TArray<FRecord>& InRecords, TArray<FNodeTotals>& OutTotals)
+		{
+			TMap<FString, int32> TotalsMap;
+
+			for (const FRecord& Record : InRecords)
+			{
+				const int32* ExistingIndex = TotalsMap.Find(Record.Node);
+				const int32 Index = ExistingIndex ? *ExistingIndex : TotalsMap.Add(Record.Node, OutTotals.Num());
+
+				if (!ExistingIndex)
+				{
+					FNodeTotals& NewTotals = OutTotals.Emplace_GetRef();
+					NewTotals.Node = Record.Node;
+					NewTotals.NodeClass = Record.NodeClass;
+				}
+
+				FNodeTotals& Totals = OutTotals[Index];
+				Totals.NumExecutions++;
+				if (Record.bCancelled) { Totals.NumCancelled++; }
+				for (int i = 0; i < NumPhases; i++) { Totals.PhaseSeconds[i] += Record.PhaseSeconds[i]; }
+				Totals.TotalSeconds += Record.TotalSeconds;
+				Totals.MaxSeconds = FMath::Max(Totals.MaxSeconds, Record.TotalSeconds);
+				Totals.NumTasks += Record.NumTasks;
+				Totals.BufferBytes += Record.BufferBytes;
+				Totals.PeakClusterBytes = FMath::Max(Totals.PeakClusterBytes, Record.PeakClusterBytes);
+			}
+
+			OutTotals.Sort([](const FNodeTotals& A, const FNodeTotals& B) { return A.TotalSeconds > B.TotalSeconds; });
+		}
+
+		template <typename WriterType>
+		void WritePhases(WriterType& Writer, const double (&PhaseSeconds)[NumPhases])
+		{
+			Writer->WriteObjectStart(TEXT("phases"));
+			for (int i = 0; i < NumPhases; i++) { Writer->WriteValue(GetPhaseName(static_cast<EPhase>(i)), PhaseSeconds[i]); }
+			Writer->WriteObjectEnd();
+		}
+
+		FString GetDefaultDumpPath()
+		{
+			return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("PCGEx"), FString::Printf(TEXT("Telemetry-%s.json"), *FDateTime::Now().ToString()));
+		}
+	}
+
+	const TCHAR* GetPhaseName(const EPhase InPhase)
+	{
+		switch (InPhase)
+		{
+		case EPhase::Boot: return TEXT("boot");
+		case EPhase::AssetLoading: return TEXT("asset_loading");
+		case EPhase::Preload: return TEXT("preload");
+		case EPhase::Process: return TEXT("process");
+		case EPhase::Complete: return TEXT("complete");
+		case EPhase::Write: return TEXT("write");
+		case EPhase::Output: return TEXT("output");
+		default: return TEXT("unknown");
+		}
+	}
+
+	EPhase GetPhase(const PCGExCommon::ContextState InState)
+	{
+		static const TMap<PCGExCommon::ContextState, EPhase> PhaseMap = []()
+		{
+			TMap<PCGExCommon::ContextState, EPhase> Map;
+
+			Map.Add(PCGExCommon::State_Preparation, EPhase::Boot);
+			Map.Add(PCGExCommon::State_AsyncPreparation, EPhase::Boot);
+			Map.Add(PCGExCommon::State_LoadingAssetDependencies, EPhase::AssetLoading);
+
+			Map.Add(PCGExCommon::State_FacadePreloading, EPhase::Preload);
+			Map.Add(PCGExData::State_PreloadingData, EPhase::Preload);
+
+			Map.Add(PCGExCommon::State_Completing, EPhase::Complete);
+			Map.Add(PCGExPointsMT::MTState_PointsCompletingWork, EPhase::Complete);
+			Map.Add(PCGExClusterMT::MTState_ClusterCompletingWork, EPhase::Complete);
+
+			Map.Add(PCGExCommon::State_Writing, EPhase::Write);
+			Map.Add(PCGExCommon::State_UnionWriting, EPhase::Write);
+			Map.Add(PCGExPointsMT::MTState_PointsWriting, EPhase::Write);
+			Map.Add(PCGExClusterMT::MTState_ClusterWriting, EPhase::Write);
+			Map.Add(PCGExGraph::State_WritingClusters, EPhase::Write);
+
+			Map.Add(PCGExCommon::State_Done, EPhase::Output);
+
+			return Map;
+		}();
+
+		const EPhase* Phase = PhaseMap.Find(InState);
+		return Phase ? *Phase : EPhase::Process;
+	}
+
+	bool IsEnabled()
+	{
+		return CVarTelemetry.GetValueOnAnyThread() || GetDefault<UPCGExGlobalSettings>()->bCollectExecutionTelemetry;
+	}
+
+	FExecutionTelemetry::FExecutionTelemetry()
+	{
+		StartCycles = PhaseStartCycles = FPlatformTime::Cycles64();
+	}
+
+	void FExecutionTelemetry::EnterPhase(const EPhase InPhase)
+	{
+		FScopeLock Lock(&PhaseLock);
+
+		if (bSubmitted || InPhase == CurrentPhase) { return; }
+
+		const uint64 Now = FPlatformTime::Cycles64();
+		PhaseCycles[static_cast<uint8>(CurrentPhase)] += Now - PhaseStartCycles;
+		PhaseStartCycles = Now;
+		CurrentPhase = InPhase;
+	}
+
+	void FExecutionTelemetry::AddLoop(const int32 NumIterations, const int32 InNumChunks)
+	{
+		if (NumIterations <= 0 || InNumChunks <= 0) { return; }
+
+		NumLoops.fetch_add(1, std::memory_order_relaxed);
+		NumChunks.fetch_add(InNumChunks, std::memory_order_relaxed);
+		NumLoopIterations.fetch_add(NumIterations, std::memory_order_relaxed);
+		AtomicMax(MaxChunkSize, FMath::DivideAndRoundUp(NumIterations, InNumChunks));
+	}
+
+	void FExecutionTelemetry::AddClusterBytes(const int64 Bytes)
+	{
+		if (Bytes > 0) { NumClusters.fetch_add(1, std::memory_order_relaxed); }
+		const int64 Live = LiveClusterBytes.fetch_add(Bytes, std::memory_order_relaxed) + Bytes;
+		AtomicMax(PeakClusterBytes, Live);
+	}
+
+	void FExecutionTelemetry::Submit(const FPCGExContext* InContext)
+	{
+		FRecord Record;
+
+		{
+			FScopeLock Lock(&PhaseLock);
+
+			if (bSubmitted) { return; }
+			bSubmitted = true;
+
+			const uint64 Now = FPlatformTime::Cycles64();
+			PhaseCycles[static_cast<uint8>(CurrentPhase)] += Now - PhaseStartCycles;
+
+			for (int i = 0; i < NumPhases; i++) { Record.PhaseSeconds[i] = FPlatformTime::ToSeconds64(PhaseCycles[i]); }
+			Record.TotalSeconds = FPlatformTime::ToSeconds64(Now - StartCycles);
+		}
+
+		Record.Timestamp = FDateTime::UtcNow();
+
+		if (InContext)
+		{
+			if (const UPCGSettings* Settings = InContext->GetInputSettings<UPCGSettings>()) { Record.NodeClass = Settings->GetClass()->GetName(); }
+			if (InContext->Node) { Record.Node = InContext->Node->GetPathName(); }
+			if (Record.Node.IsEmpty()) { Record.Node = Record.NodeClass; }
+
+			if (const UPCGComponent* Component = InContext->GetComponent())
+			{
+				const AActor* Owner = Component->GetOwner();
+				Record.Owner = Owner ? Owner->GetName() : Component->GetName();
+			}
+
+			Record.bCancelled = !InContext->CanExecute();
+		}
+
+		Record.NumTasks = NumTasks.load(std::memory_order_relaxed);
+		Record.NumLoops = NumLoops.load(std::memory_order_relaxed);
+		Record.NumChunks = NumChunks.load(std::memory_order_relaxed);
+		Record.NumLoopIterations = NumLoopIterations.load(std::memory_order_relaxed);
+		Record.MaxChunkSize = MaxChunkSize.load(std::memory_order_relaxed);
+		Record.NumBuffers = NumBuffers.load(std::memory_order_relaxed);
+		Record.BufferBytes = BufferBytes.load(std::memory_order_relaxed);
+		Record.NumClusters = NumClusters.load(std::memory_order_relaxed);
+		Record.PeakClusterBytes = PeakClusterBytes.load(std::memory_order_relaxed);
+
+		const int32 MaxRecords = FMath::Max(1, GetDefault<UPCGExGlobalSettings>()->MaxTelemetryRecords);
+
+		FScopeLock Lock(&Registry::Lock);
+		if (Registry::Records.Num() < MaxRecords)
+		{
+			Registry::Records.Add(MoveTemp(Record));
+		}
+		else
+		{
+			Registry::Next %= Registry::Records.Num();
+			Registry::Records[Registry::Next++] = MoveTemp(Record);
+		}
+	}
+
+	void GetRecords(TArray<FRecord>& OutRecords)
+	{
+		FScopeLock Lock(&Registry::Lock);
+
+		const int32 NumRecords = Registry::Records.Num();
+		OutRecords.Reset(NumRecords);
+
+		// Oldest first
+		const int32 First = NumRecords > 0 ? Registry::Next % NumRecords : 0;
+		for (int i = 0; i < NumRecords; i++) { OutRecords.Add(Registry::Records[(First + i) % NumRecords]); }
+	}
+
+	void ResetRecords()
+	{
+		FScopeLock Lock(&Registry::Lock);
+		Registry::Records.Empty();
+		Registry::Next = 0;
+	}
+
+	bool DumpToJson(const FString& InFilePath)
+	{
+		TArray<FRecord> Records;
+		GetRecords(Records);
+
+		TArray<FNodeTotals> Totals;
+		GatherTotals(Records, Totals);
+
+		FString Output;
+		const TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&Output);
+
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("version"), 1);
+		Writer->WriteValue(TEXT("generated"), FDateTime::UtcNow().ToIso8601());
+
+		Writer->WriteArrayStart(TEXT("nodes"));
+		for (const FNodeTotals& Node : Totals)
+		{
+			Writer->WriteObjectStart();
+			Writer->WriteValue(TEXT("node"), Node.Node);
+			Writer->WriteValue(TEXT("class"), Node.NodeClass);
+			Writer->WriteValue(TEXT("executions"), Node.NumExecutions);
+			Writer->WriteValue(TEXT("cancelled"), Node.NumCancelled);
+			Writer->WriteValue(TEXT("total_seconds"), Node.TotalSeconds);
+			Writer->WriteValue(TEXT("max_seconds"), Node.MaxSeconds);
+			WritePhases(Writer, Node.PhaseSeconds);
+			Writer->WriteValue(TEXT("tasks"), Node.NumTasks);
+			Writer->WriteValue(TEXT("buffer_bytes"), Node.BufferBytes);
+			Writer->WriteValue(TEXT("peak_cluster_bytes"), Node.PeakClusterBytes);
+			Writer->WriteObjectEnd();
+		}
+		Writer->WriteArrayEnd();
+
+		Writer->WriteArrayStart(TEXT("executions"));
+		for (const FRecord& Record : Records)
+		{
+			Writer->WriteObjectStart();
+			Writer->WriteValue(TEXT("node"), Record.Node);
+			Writer->WriteValue(TEXT("class"), Record.NodeClass);
+			Writer->WriteValue(TEXT("owner"), Record.Owner);
+			Writer->WriteValue(TEXT("timestamp"), Record.Timestamp.ToIso8601());
+			Writer->WriteValue(TEXT("cancelled"), Record.bCancelled);
+			Writer->WriteValue(TEXT("total_seconds"), Record.TotalSeconds);
+			WritePhases(Writer, Record.PhaseSeconds);
+			Writer->WriteValue(TEXT("tasks"), Record.NumTasks);
+			Writer->WriteObjectStart(TEXT("loops"));
+			Writer->WriteValue(TEXT("count"), Record.NumLoops);
+			Writer->WriteValue(TEXT("chunks"), Record.NumChunks);
+			Writer->WriteValue(TEXT("iterations"), Record.NumLoopIterations);
+			Writer->WriteValue(TEXT("max_chunk_size"), Record.MaxChunkSize);
+			Writer->WriteObjectEnd();
+			Writer->WriteObjectStart(TEXT("memory"));
+			Writer->WriteValue(TEXT("buffers"), Record.NumBuffers);
+			Writer->WriteValue(TEXT("buffer_bytes"), Record.BufferBytes);
+			Writer->WriteValue(TEXT("clusters"), Record.NumClusters);
+			Writer->WriteValue(TEXT("peak_cluster_bytes"), Record.PeakClusterBytes);
+			Writer->WriteObjectEnd();
+			Writer->WriteObjectEnd();
+		}
+		Writer->WriteArrayEnd();
+
+		Writer->WriteObjectEnd();
+		Writer->Close();
+
+		return FFileHelper::SaveStringToFile(Output, *InFilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+	}
+
+	static FAutoConsoleCommand CmdDump(
+		TEXT("pcgex.Telemetry.Dump"),
+		TEXT("Writes collected PCGEx telemetry to a JSON file. Optional argument : output file path (defaults to Saved/PCGEx/)."),
+		FConsoleCommandWithArgsDelegate::CreateLambda(
+			[](const TArray<FString>& Args)
+			{
+				const FString FilePath = Args.IsEmpty() ? GetDefaultDumpPath() : Args[0];
+				if (DumpToJson(FilePath)) { UE_LOG(LogPCGEx, Display, TEXT("PCGEx telemetry written to %s"), *FilePath); }
+				else { UE_LOG(LogPCGEx, Error, TEXT("Could not write PCGEx telemetry to %s"), *FilePath); }
+			}));
+
+	static FAutoConsoleCommand CmdPrint(
+		TEXT("pcgex.Telemetry.Print"),
+		TEXT("Logs the PCGEx nodes that took the most time. Optional argument : number of nodes (defaults to 20)."),
+		FConsoleCommandWithArgsDelegate::CreateLambda(
+			[](const TArray<FString>& Args)
+			{
+				TArray<FRecord> Records;
+				GetRecords(Records);
+
+				TArray<FNodeTotals> Totals;
+				GatherTotals(Records, Totals);
+
+				const int32 MaxNodes = Args.IsEmpty() ? 20 : FCString::Atoi(*Args[0]);
+				UE_LOG(LogPCGEx, Display, TEXT("PCGEx telemetry : %d executions across %d nodes"), Records.Num(), Totals.Num());
+
+				for (int i = 0; i < FMath::Min(MaxNodes, Totals.Num()); i++)
+				{
+					const FNodeTotals& Node = Totals[i];
+
+					FString Phases;
+					for (int p = 0; p < NumPhases; p++)
+					{
+						if (Node.PhaseSeconds[p] <= 0) { continue; }
+						Phases += FString::Printf(TEXT(" %s=%.2fms"), GetPhaseName(static_cast<EPhase>(p)), Node.PhaseSeconds[p] * 1000);
+					}
+
+					UE_LOG(
+						LogPCGEx, Display, TEXT("%8.2fms x%d | %s (%s) |%s | %lld tasks, %lld buffer bytes, %lld peak cluster bytes"),
+						Node.TotalSeconds * 1000, Node.NumExecutions, *Node.Node, *Node.NodeClass, *Phases,
+						Node.NumTasks, Node.BufferBytes, Node.PeakClusterBytes);
+				}
+			}));
+
+	static FAutoConsoleCommand CmdReset(
+		TEXT("pcgex.Telemetry.Reset"),
+		TEXT("Clears collected PCGEx telemetry."),
+		FConsoleCommandDelegate::CreateLambda([]() { ResetRecords(); }));
+}
@@ -78,6 +78,8 @@ bool FPCGExExtrudeTensorsElement::Boot(FPCGExContext* InContext) const
 		return false;
 	}
 
+	Context->TensorField = Settings->TensorHandlerDetails.TryCreateBakedField(Context, Context->TensorFactories);
+
 	Context->ClosedLoopSquaredDistance = FMath::Square(Settings->ClosedLoopSearchDistance);
 	Context->ClosedLoopSearchDot = PCGExMath::DegreesToDot(Settings->ClosedLoopSearchAngle);
 
@@ -374,7 +376,7 @@ namespace PCGExExtrudeTensors
 		}
 
 		TensorsHandler = MakeShared<PCGExTensor::FTensorsHandler>(Settings->TensorHandlerDetails);
-		if (!TensorsHandler->Init(Context, Context->TensorFactories, PointDataFacade)) { return false; }
+		if (!TensorsHandler->Init(Context, Context->TensorFactories, PointDataFacade, Context->TensorField)) { return false; }
 
 		AttributesToPathTags = Settings->AttributesToPathTags;
 		if (!AttributesToPathTags.Init(Context, PointDataFacade)) { return false; }
@@ -11,6 +11,7 @@
 #include "Data/PCGExDataHelpers.h"
 #include "Data/PCGExPointIO.h"
 #include "Details/PCGExDetailsSettings.h"
+#include "Paths/PCGExSegmentTree.h"
 
 #define LOCTEXT_NAMESPACE "PCGExPaths"
 #define PCGEX_NAMESPACE PCGExPaths
@@ -825,6 +826,179 @@ namespace PCGExPaths
 		return Intersection;
 	}
 
+	FPolygonInclusionGrid::FPolygonInclusionGrid(const TArray<FVector2D>& InPolygon, const int32 InMaxResolution)
+		: Polygon(InPolygon)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FPolygonInclusionGrid::Build);
+
+		const int32 NumEdges = Polygon.Num();
+		if (NumEdges < 3) { return; }
+
+		FBox2D Bounds(ForceInit);
+		for (const FVector2D& P : Polygon) { Bounds += P; }
+
+		const FVector2D Size = Bounds.GetSize();
+		if (Size.X <= UE_DOUBLE_SMALL_NUMBER || Size.Y <= UE_DOUBLE_SMALL_NUMBER) { return; }
+
+		// Roughly a couple of edges per row/column, stretched to follow the polygon aspect
+		const int32 MaxRes = FMath::Max(1, InMaxResolution);
+		const double Res = FMath::Clamp(FMath::CeilToDouble(2 * FMath::Sqrt(static_cast<double>(NumEdges))), 4, MaxRes);
+		const double Aspect = FMath::Sqrt(Size.X / Size.Y);
+		ResX = FMath::Clamp(FMath::RoundToInt32(Res * Aspect), 1, MaxRes);
+		ResY = FMath::Clamp(FMath::RoundToInt32(Res / Aspect), 1, MaxRes);
+
+		Origin = Bounds.Min;
+		CellSize = FVector2D(Size.X / ResX, Size.Y / ResY);
+		InvCellSize = FVector2D(1 / CellSize.X, 1 / CellSize.Y);
+
+		const int32 NumCells = ResX * ResY;
+
+		// Register edges to the cells they overlap, flattened as offsets + elements
+
+		EdgeOffsets.Init(0, NumCells + 1);
+		for (int i = 0; i < NumEdges; i++) { ForEachEdgeCell(i, [&](const int32 Cell) { EdgeOffsets[Cell + 1]++; }); }
+		for (int i = 0; i < NumCells; i++) { EdgeOffsets[i + 1] += EdgeOffsets[i]; }
+
+		CellEdges.SetNumUninitialized(EdgeOffsets[NumCells]);
+		{
+			TArray<int32> Cursor(EdgeOffsets.GetData(), NumCells);
+			for (int i = 0; i < NumEdges; i++) { ForEachEdgeCell(i, [&](const int32 Cell) { CellEdges[Cursor[Cell]++] = i; }); }
+		}
+
+		// Winding at cell centers, from a +X ray cast along each row center line.
+		// Every crossing contributes to the cells whose center lies strictly on its left.
+
+		TArray<int32> Crossings;
+		Crossings.Init(0, (ResX + 1) * ResY);
+
+		for (int i = 0; i < NumEdges; i++)
+		{
+			const FVector2D& A = Polygon[i];
+			const FVector2D& B = Polygon[(i + 1) % NumEdges];
+			if (A.Y == B.Y) { continue; }
+
+			const int32 Sign = B.Y > A.Y ? 1 : -1;
+			const int32 FromY = FMath::Max(0, FMath::FloorToInt32((FMath::Min(A.Y, B.Y) - Origin.Y) * InvCellSize.Y - 0.5));
+			const int32 ToY = FMath::Min(ResY - 1, FMath::CeilToInt32((FMath::Max(A.Y, B.Y) - Origin.Y) * InvCellSize.Y - 0.5));
+
+			for (int32 Y = FromY; Y <= ToY; Y++)
+			{
+				const double CY = Origin.Y + (Y + 0.5) * CellSize.Y;
+				if ((A.Y <= CY) == (B.Y <= CY)) { continue; }
+
+				const double IX = A.X + (CY - A.Y) * (B.X - A.X) / (B.Y - A.Y);
+				const double T = (IX - Origin.X) * InvCellSize.X - 0.5;
+				const int32 NumLeft = T <= 0 ? 0 : FMath::Min(ResX, FMath::CeilToInt32(T));
+				Crossings[Y * (ResX + 1) + NumLeft] += Sign;
+			}
+		}
+
+		Winding.SetNumUninitialized(NumCells);
+		Status.SetNumUninitialized(NumCells);
+
+		for (int32 Y = 0; Y < ResY; Y++)
+		{
+			int32 Sum = 0;
+			for (int32 X = ResX - 1; X >= 0; X--)
+			{
+				Sum += Crossings[Y * (ResX + 1) + X + 1];
+
+				const int32 Cell = X + Y * ResX;
+				Winding[Cell] = Sum;
+
+				if (EdgeOffsets[Cell + 1] > EdgeOffsets[Cell]) { Status[Cell] = Boundary; }
+				else { Status[Cell] = Sum != 0 ? Inside : Outside; }
+			}
+		}
+	}
+
+	void FPolygonInclusionGrid::ForEachEdgeCell(const int32 EdgeIndex, const TFunctionRef<void(const int32)>& Func) const
+	{
+		const FVector2D& A = Polygon[EdgeIndex];
+		const FVector2D& B = Polygon[(EdgeIndex + 1) % Polygon.Num()];
+
+		// Slight padding so edges touching a cell border are registered on both sides
+		const FVector2D Pad = CellSize * 1e-3;
+
+		const int32 FromY = FMath::Clamp(FMath::FloorToInt32((FMath::Min(A.Y, B.Y) - Pad.Y - Origin.Y) * InvCellSize.Y), 0, ResY - 1);
+		const int32 ToY = FMath::Clamp(FMath::FloorToInt32((FMath::Max(A.Y, B.Y) + Pad.Y - Origin.Y) * InvCellSize.Y), 0, ResY - 1);
+
+		const double DY = B.Y - A.Y;
+
+		for (int32 Y = FromY; Y <= ToY; Y++)
+		{
+			// Clip the edge to the row band
+			double MinX = FMath::Min(A.X, B.X);
+			double MaxX = FMath::Max(A.X, B.X);
+
+			if (DY != 0)
+			{
+				const double BandMin = Origin.Y + Y * CellSize.Y - Pad.Y;
+				const double BandMax = Origin.Y + (Y + 1) * CellSize.Y + Pad.Y;
+				double T0 = FMath::Clamp((BandMin - A.Y) / DY, 0, 1);
+				double T1 = FMath::Clamp((BandMax - A.Y) / DY, 0, 1);
+				if (T0 > T1) { Swap(T0, T1); }
+
+				const double X0 = A.X + (B.X - A.X) * T0;
+				const double X1 = A.X + (B.X - A.X) * T1;
+				MinX = FMath::Min(X0, X1);
+				MaxX = FMath::Max(X0, X1);
+			}
+
+			const int32 FromX = FMath::Clamp(FMath::FloorToInt32((MinX - Pad.X - Origin.X) * InvCellSize.X), 0, ResX - 1);
+			const int32 ToX = FMath::Clamp(FMath::FloorToInt32((MaxX + Pad.X - Origin.X) * InvCellSize.X), 0, ResX - 1);
+
+			for (int32 X = FromX; X <= ToX; X++) { Func(X + Y * ResX); }
+		}
+	}
+
+	bool FPolygonInclusionGrid::IsInside(const FVector2D& InPoint) const
+	{
+		const double FX = (InPoint.X - Origin.X) * InvCellSize.X;
+		const double FY = (InPoint.Y - Origin.Y) * InvCellSize.Y;
+		if (FX < 0 || FY < 0 || FX > ResX || FY > ResY) { return false; }
+
+		const int32 X = FMath::Min(FMath::FloorToInt32(FX), ResX - 1);
+		const int32 Y = FMath::Min(FMath::FloorToInt32(FY), ResY - 1);
+		const int32 Cell = X + Y * ResX;
+
+		if (Status[Cell] != Boundary) { return Status[Cell] == Inside; }
+
+		// Walk from the cell center to the point: horizontally to (Point.X, Center.Y), then vertically.
+		// Any edge crossing that path lies in this cell, so the local edge list is enough to update the winding.
+
+		const FVector2D Center = GetCellCenter(X, Y);
+		int32 W = Winding[Cell];
+
+		const int32 NumPts = Polygon.Num();
+		for (int32 e = EdgeOffsets[Cell]; e < EdgeOffsets[Cell + 1]; e++)
+		{
+			const int32 i = CellEdges[e];
+			const FVector2D& A = Polygon[i];
+			const FVector2D& B = Polygon[(i + 1) % NumPts];
+
+			if ((A.Y <= Center.Y) != (B.Y <= Center.Y))
+			{
+				// +X ray convention : upward crossings count positive
+				const double IX = A.X + (Center.Y - A.Y) * (B.X - A.X) / (B.Y - A.Y);
+				const int32 Sign = B.Y > A.Y ? 1 : -1;
+				if (InPoint.X < Center.X) { if (IX > InPoint.X && IX <= Center.X) { W += Sign; } }
+				else if (IX > Center.X && IX <= InPoint.X) { W -= Sign; }
+			}
+
+			if ((A.X <= InPoint.X) != (B.X <= InPoint.X))
+			{
+				// +Y ray convention : leftward crossings count positive
+				const double IY = A.Y + (InPoint.X - A.X) * (B.Y - A.Y) / (B.X - A.X);
+				const int32 Sign = B.X < A.X ? 1 : -1;
+				if (InPoint.Y < Center.Y) { if (IY > InPoint.Y && IY <= Center.Y) { W += Sign; } }
+				else if (IY > Center.Y && IY <= InPoint.Y) { W -= Sign; }
+			}
+		}
+
+		return W != 0;
+	}
+
 	FPolyPath::FPolyPath(
 		const TSharedPtr<PCGExData::FPointIO>& InPointIO,
 		const FPCGExGeo2DProjectionDetails& InProjection,
@@ -923,16 +1097,68 @@ namespace PCGExPaths
 		}
 	}
 
+	const FPolygonInclusionGrid* FPolyPath::GetInclusionGrid() const
+	{
+		if (!bInclusionGridReady.load(std::memory_order_acquire))
+		{
+			FWriteScopeLock WriteScopeLock(InclusionGridLock);
+			if (!bInclusionGridReady.load(std::memory_order_relaxed))
+			{
+				const TSharedPtr<FPolygonInclusionGrid> NewGrid = MakeShared<FPolygonInclusionGrid>(ProjectedPoints);
+				if (NewGrid->IsValid()) { InclusionGrid = NewGrid; }
+				bInclusionGridReady.store(true, std::memory_order_release);
+			}
+		}
+
+		return InclusionGrid.Get();
+	}
+
+	const FSegmentTree* FPolyPath::GetSegmentTree() const
+	{
+		if (!bSegmentTreeReady.load(std::memory_order_acquire))
+		{
+			FWriteScopeLock WriteScopeLock(SegmentTreeLock);
+			if (!bSegmentTreeReady.load(std::memory_order_relaxed))
+			{
+				// Paths built from points sample a linear spline of those same points, so the polyline is exact
+				const TSharedPtr<FSegmentTree> NewTree = LocalSpline ?
+					                                         MakeShared<FSegmentTree>(Positions, bClosedLoop) :
+					                                         MakeShared<FSegmentTree>(*Spline);
+				if (NewTree->IsValid()) { SegmentTree = NewTree; }
+				bSegmentTreeReady.store(true, std::memory_order_release);
+			}
+		}
+
+		return SegmentTree.Get();
+	}
+
+	float FPolyPath::FindClosestInputKey(const FVector& WorldPosition) const
+	{
+		if (bUseSegmentTree)
+		{
+			double Key = 0;
+			if (const FSegmentTree* Tree = GetSegmentTree(); Tree && Tree->FindClosestKey(WorldPosition, Key)) { return static_cast<float>(Key); }
+		}
+
+		return Spline->FindInputKeyClosestToWorldLocation(WorldPosition);
+	}
+
 	bool FPolyPath::IsInsideProjection(const FVector& WorldPosition) const
 	{
 		const FVector ProjectedPoint = Projection.Project(WorldPosition);
 		if (!PolyBox.IsInside(ProjectedPoint)) { return false; }
+
+		if (bUseInclusionGrid)
+		{
+			if (const FPolygonInclusionGrid* Grid = GetInclusionGrid()) { return Grid->IsInside(FVector2D(ProjectedPoint)); }
+		}
+
 		return FGeomTools2D::IsPointInPolygon(FVector2D(ProjectedPoint), ProjectedPoints);
 	}
 
 	FTransform FPolyPath::GetClosestTransform(const FVector& WorldPosition, int32& OutEdgeIndex, float& OutLerp, const bool bUseScale) const
 	{
-		const float ClosestKey = Spline->FindInputKeyClosestToWorldLocation(WorldPosition);
+		const float ClosestKey = FindClosestInputKey(WorldPosition);
 		OutEdgeIndex = FMath::FloorToInt32(ClosestKey);
 		OutLerp = ClosestKey - OutEdgeIndex;
 		return Spline->GetTransformAtSplineInputKey(ClosestKey, ESplineCoordinateSpace::World, bUseScale);
@@ -940,7 +1166,7 @@ namespace PCGExPaths
 
 	FTransform FPolyPath::GetClosestTransform(const FVector& WorldPosition, float& OutAlpha, const bool bUseScale) const
 	{
-		const float ClosestKey = Spline->FindInputKeyClosestToWorldLocation(WorldPosition);
+		const float ClosestKey = FindClosestInputKey(WorldPosition);
 		OutAlpha = ClosestKey / Spline->GetNumberOfSplineSegments();
 		return Spline->GetTransformAtSplineInputKey(ClosestKey, ESplineCoordinateSpace::World, bUseScale);
 	}
@@ -948,12 +1174,12 @@ namespace PCGExPaths
 	FTransform FPolyPath::GetClosestTransform(const FVector& WorldPosition, bool& bIsInside, const bool bUseScale) const
 	{
 		bIsInside = IsInsideProjection(WorldPosition);
-		return Spline->GetTransformAtSplineInputKey(Spline->FindInputKeyClosestToWorldLocation(WorldPosition), ESplineCoordinateSpace::World, bUseScale);
+		return Spline->GetTransformAtSplineInputKey(FindClosestInputKey(WorldPosition), ESplineCoordinateSpace::World, bUseScale);
 	}
 
 	FTransform FPolyPath::GetClosestTransform(const FVector& WorldPosition, const bool bUseScale) const
 	{
-		return Spline->GetTransformAtSplineInputKey(Spline->FindInputKeyClosestToWorldLocation(WorldPosition), ESplineCoordinateSpace::World, bUseScale);
+		return Spline->GetTransformAtSplineInputKey(FindClosestInputKey(WorldPosition), ESplineCoordinateSpace::World, bUseScale);
 	}
 
 	bool FPolyPath::GetClosestPosition(const FVector& WorldPosition, FVector& OutPosition) const
@@ -972,7 +1198,7 @@ namespace PCGExPaths
 
 	int32 FPolyPath::GetClosestEdge(const FVector& WorldPosition, float& OutLerp) const
 	{
-		const float ClosestKey = Spline->FindInputKeyClosestToWorldLocation(WorldPosition);
+		const float ClosestKey = FindClosestInputKey(WorldPosition);
 		const int32 OutEdgeIndex = FMath::FloorToInt32(ClosestKey);
 		OutLerp = ClosestKey - OutEdgeIndex;
 		return FMath::Min(OutEdgeIndex, this->LastEdge);
@@ -0,0 +1,253 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Paths/PCGExSegmentTree.h"
+
+#include "Algo/Sort.h"
+#include "Data/PCGSplineStruct.h"
+
+namespace PCGExPaths
+{
+	FSegmentTree::FSegmentTree(const FPCGSplineStruct& InSpline, const double Fidelity)
+		: Spline(&InSpline)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FSegmentTree::FromSpline);
+
+		const int32 NumSplineSegments = InSpline.GetNumberOfSplineSegments();
+		if (NumSplineSegments <= 0) { return; }
+
+		const FInterpCurveVector& Curve = InSpline.GetSplinePointsPosition();
+		const FTransform& Transform = InSpline.GetTransform();
+		const double SafeFidelity = FMath::Max(Fidelity, UE_KINDA_SMALL_NUMBER);
+
+		constexpr int32 NumProbes = 4;
+
+		Points.Reserve(NumSplineSegments * 4 + 1);
+		Keys.Reserve(NumSplineSegments * 4 + 1);
+
+		Points.Add(Transform.TransformPosition(Curve.Eval(0.f, FVector::ZeroVector)));
+		Keys.Add(0);
+
+		for (int32 s = 0; s < NumSplineSegments; s++)
+		{
+			// Rough segment length from a handful of probes, only used to pick a subdivision count
+			double Length = 0;
+			FVector Prev = Points.Last();
+			for (int32 p = 1; p <= NumProbes; p++)
+			{
+				const FVector Next = Transform.TransformPosition(Curve.Eval(static_cast<float>(s + static_cast<double>(p) / NumProbes), FVector::ZeroVector));
+				Length += FVector::Dist(Prev, Next);
+				Prev = Next;
+			}
+
+			const int32 Subdivisions = FMath::Clamp(FMath::CeilToInt32(Length / SafeFidelity), 1, MaxSubdivisions);
+			for (int32 d = 1; d <= Subdivisions; d++)
+			{
+				const double Key = s + static_cast<double>(d) / Subdivisions;
+				Points.Add(Transform.TransformPosition(Curve.Eval(static_cast<float>(Key), FVector::ZeroVector)));
+				Keys.Add(Key);
+
+				// Neither the probed length nor the subdivision cap guarantee chords stay within Fidelity of the curve,
+				// so measure how far the curve actually strays from each chord
+				const FVector& A = Points.Last(1);
+				const FVector& B = Points.Last();
+				const double PrevKey = Keys.Last(1);
+
+				for (int32 p = 1; p < NumProbes; p++)
+				{
+					const FVector OnCurve = Transform.TransformPosition(Curve.Eval(static_cast<float>(FMath::Lerp(PrevKey, Key, static_cast<double>(p) / NumProbes)), FVector::ZeroVector));
+					MaxDeviation = FMath::Max(MaxDeviation, FMath::PointDistToSegment(OnCurve, A, B));
+				}
+			}
+		}
+
+		Build();
+	}
+
+	FSegmentTree::FSegmentTree(const TConstPCGValueRange<FTransform>& InTransforms, const bool bClosedLoop)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FSegmentTree::FromPolyline);
+
+		const int32 NumPoints = InTransforms.Num();
+		if (NumPoints < 2) { return; }
+
+		const int32 NumPts = bClosedLoop ? NumPoints + 1 : NumPoints;
+		Points.SetNumUninitialized(NumPts);
+		Keys.SetNumUninitialized(NumPts);
+
+		for (int i = 0; i < NumPts; i++)
+		{
+			Points[i] = InTransforms[i % NumPoints].GetLocation();
+			Keys[i] = i;
+		}
+
+		Build();
+	}
+
+	void FSegmentTree::Build()
+	{
+		const int32 NumSegs = NumSegments();
+		if (NumSegs <= 0) { return; }
+
+		TArray<FVector> Centers;
+		Centers.SetNumUninitialized(NumSegs);
+		SegmentOrder.SetNumUninitialized(NumSegs);
+
+		for (int i = 0; i < NumSegs; i++)
+		{
+			Centers[i] = (Points[i] + Points[i + 1]) * 0.5;
+			SegmentOrder[i] = i;
+		}
+
+		Nodes.Reserve(2 * FMath::DivideAndRoundUp(NumSegs, LeafSize));
+		BuildNode(0, NumSegs, Centers);
+	}
+
+	int32 FSegmentTree::BuildNode(const int32 Start, const int32 Count, TArray<FVector>& Centers)
+	{
+		const int32 NodeIndex = Nodes.Emplace();
+
+		FBox Bounds(ForceInit);
+		FBox CenterBounds(ForceInit);
+		for (int i = Start; i < Start + Count; i++)
+		{
+			const int32 Seg = SegmentOrder[i];
+			Bounds += Points[Seg];
+			Bounds += Points[Seg + 1];
+			CenterBounds += Centers[Seg];
+		}
+
+		Nodes[NodeIndex].Bounds = Bounds;
+
+		if (Count <= LeafSize)
+		{
+			Nodes[NodeIndex].Start = Start;
+			Nodes[NodeIndex].Count = Count;
+			return NodeIndex;
+		}
+
+		// Median split along the largest axis of segment centers
+		const FVector Extent = CenterBounds.GetSize();
+		const int32 Axis = Extent.X >= Extent.Y ? (Extent.X >= Extent.Z ? 0 : 2) : (Extent.Y >= Extent.Z ? 1 : 2);
+		const int32 Half = Count / 2;
+
+		TArrayView<int32> Range = MakeArrayView(SegmentOrder.GetData() + Start, Count);
+		Algo::Sort(Range, [&](const int32 A, const int32 B) { return Centers[A][Axis] < Centers[B][Axis]; });
+
+		// Children are laid out right after their parent, the right one's index is stored
+		BuildNode(Start, Half, Centers);
+		const int32 Right = BuildNode(Start + Half, Count - Half, Centers);
+
+		Nodes[NodeIndex].Start = Right;
+		return NodeIndex;
+	}
+
+	bool FSegmentTree::FindClosestKey(const FVector& WorldPosition, double& OutKey, double& OutDistSquared, const double MaxDistSquared) const
+	{
+		if (Nodes.IsEmpty()) { return false; }
+
+		int32 BestSegment = -1;
+		double BestAlpha = 0;
+		double BestDistSquared = MaxDistSquared;
+
+		TArray<int32, TInlineAllocator<64>> Stack;
+		Stack.Add(0);
+
+		while (!Stack.IsEmpty())
+		{
+			const int32 NodeIndex = Stack.Pop(EAllowShrinking::No);
+			const FNode& Node = Nodes[NodeIndex];
+
+			if (Node.Bounds.ComputeSquaredDistanceToPoint(WorldPosition) >= BestDistSquared) { continue; }
+
+			if (Node.Count > 0)
+			{
+				for (int i = Node.Start; i < Node.Start + Node.Count; i++)
+				{
+					const int32 Seg = SegmentOrder[i];
+					const FVector& A = Points[Seg];
+					const FVector AB = Points[Seg + 1] - A;
+					const double LenSquared = AB.SizeSquared();
+					const double Alpha = LenSquared > 0 ? FMath::Clamp(FVector::DotProduct(WorldPosition - A, AB) / LenSquared, 0, 1) : 0;
+					const double DistSquared = FVector::DistSquared(WorldPosition, A + AB * Alpha);
+
+					if (DistSquared < BestDistSquared || (DistSquared == BestDistSquared && Seg < BestSegment))
+					{
+						BestSegment = Seg;
+						BestAlpha = Alpha;
+						BestDistSquared = DistSquared;
+					}
+				}
+
+				continue;
+			}
+
+			// Push the farthest child first so the closest one is visited first and tightens the bound early
+			const int32 Left = NodeIndex + 1;
+			const int32 Right = Node.Start;
+			const double LeftDist = Nodes[Left].Bounds.ComputeSquaredDistanceToPoint(WorldPosition);
+			const double RightDist = Nodes[Right].Bounds.ComputeSquaredDistanceToPoint(WorldPosition);
+
+			if (LeftDist < RightDist)
+			{
+				Stack.Add(Right);
+				Stack.Add(Left);
+			}
+			else
+			{
+				Stack.Add(Left);
+				Stack.Add(Right);
+			}
+		}
+
+		if (BestSegment == -1) { return false; }
+
+		const double Key = FMath::Lerp(Keys[BestSegment], Keys[BestSegment + 1], BestAlpha);
+		OutKey = Spline ? Refine(WorldPosition, BestSegment, Key, BestDistSquared) : Key;
+		OutDistSquared = BestDistSquared;
+
+		return true;
+	}
+
+	double FSegmentTree::Refine(const FVector& WorldPosition, const int32 Segment, const double Key, double& InOutDistSquared) const
+	{
+		const FInterpCurveVector& Curve = Spline->GetSplinePointsPosition();
+		const FTransform& Transform = Spline->GetTransform();
+
+		// Allow the search to drift into neighboring segments, the tessellation may have picked the wrong side of a bend
+		const double MinKey = Keys[FMath::Max(0, Segment - 1)];
+		const double MaxKey = Keys[FMath::Min(Keys.Num() - 1, Segment + 2)];
+
+		constexpr int32 MaxIterations = 8;
+		double T = Key;
+
+		for (int32 i = 0; i < MaxIterations; i++)
+		{
+			const FVector Delta = Transform.TransformPosition(Curve.Eval(static_cast<float>(T), FVector::ZeroVector)) - WorldPosition;
+			const FVector D1 = Transform.TransformVector(Curve.EvalDerivative(static_cast<float>(T), FVector::ZeroVector));
+			const FVector D2 = Transform.TransformVector(Curve.EvalSecondDerivative(static_cast<float>(T), FVector::ZeroVector));
+
+			const double Slope = FVector::DotProduct(Delta, D1);
+			const double Curvature = D1.SizeSquared() + FVector::DotProduct(Delta, D2);
+			if (Curvature <= UE_DOUBLE_SMALL_NUMBER) { break; }
+
+			const double Next = FMath::Clamp(T - Slope / Curvature, MinKey, MaxKey);
+			const bool bConverged = FMath::Abs(Next - T) < UE_KINDA_SMALL_NUMBER;
+			T = Next;
+
+			if (bConverged) { break; }
+		}
+
+		const double RefinedDistSquared = FVector::DistSquared(Transform.TransformPosition(Curve.Eval(static_cast<float>(T), FVector::ZeroVector)), WorldPosition);
+		const double InitialDistSquared = FVector::DistSquared(Transform.TransformPosition(Curve.Eval(static_cast<float>(Key), FVector::ZeroVector)), WorldPosition);
+
+		if (RefinedDistSquared <= InitialDistSquared)
+		{
+			InOutDistSquared = RefinedDistSquared;
+			return T;
+		}
+
+		InOutDistSquared = InitialDistSquared;
+		return Key;
+	}
+}
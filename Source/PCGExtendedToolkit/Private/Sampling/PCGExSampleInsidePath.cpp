@@ -221,6 +221,7 @@ namespace PCGExSampleInsidePath
 		PCGEX_INIT_IO(PointDataFacade->Source, PCGExData::EIOInit::Duplicate)
 
 		Path = MakeShared<PCGExPaths::FPolyPath>(PointDataFacade, Settings->ProjectionDetails, 1, Settings->HeightInclusion);
+		if (Settings->bUseInclusionGrid) { Path->EnableInclusionGrid(); }
 
 		// Allocate edge native properties
 
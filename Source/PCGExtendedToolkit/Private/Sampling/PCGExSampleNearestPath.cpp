@@ -102,6 +102,7 @@ bool FPCGExSampleNearestPathElement::Boot(FPCGExContext* InContext) const
 			TSharedPtr<PCGExPaths::FPolyPath> Path = MakeShared<PCGExPaths::FPolyPath>(IO, Settings->ProjectionDetails, 1, Settings->HeightInclusion);
 
 			if (!Path->Bounds.IsValid) { return FBox(NoInit); }
+			if (Settings->bUseSegmentTree) { Path->EnableSegmentTree(); }
 
 			Path->IOIndex = IO->IOIndex;
 			Path->Idx = Idx;
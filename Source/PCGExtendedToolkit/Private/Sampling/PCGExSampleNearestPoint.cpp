@@ -107,6 +107,12 @@ bool FPCGExSampleNearestPointElement::Boot(FPCGExContext* InContext) const
 
 	Context->TargetsHandler->SetDistances(Settings->DistanceDetails);
 
+	// Closest/farthest picks ranked by plain center distance can be answered by a kd-tree instead of a full scan
+	Context->bUseTargetsKDTree =
+		(Settings->SampleMethod == EPCGExSampleMethod::ClosestTarget || Settings->SampleMethod == EPCGExSampleMethod::FarthestTarget) &&
+		Settings->WeightMode == EPCGExSampleWeightMode::Distance &&
+		Context->TargetsHandler->GetDistances()->IsCenterToCenter();
+
 	if (Settings->SampleMethod == EPCGExSampleMethod::BestCandidate)
 	{
 		Context->Sorter = MakeShared<PCGExSorting::FPointSorter>(PCGExSorting::GetSortingRules(Context, PCGExSorting::SourceSortingRules));
@@ -196,6 +202,8 @@ bool FPCGExSampleNearestPointElement::ExecuteInternal(FPCGContext* InContext) co
 
 			Context->TargetsHandler->SetMatchingDetails(Context, &Settings->DataMatching);
 
+			if (Context->bUseTargetsKDTree) { Context->TargetsHandler->BuildKDTree(); }
+
 			if (Context->Sorter && !Context->Sorter->Init(Context, Context->TargetsHandler->GetFacades()))
 			{
 				Context->CancelExecution(TEXT("Invalid sort rules"));
@@ -377,7 +385,7 @@ namespace PCGExSampleNearestPoint
 
 			if (RangeMin > RangeMax) { std::swap(RangeMin, RangeMax); }
 
-			if (RangeMax == 0) { Union->Elements.Reserve(Context->NumMaxTargets); }
+			if (RangeMax == 0 && !Context->bUseTargetsKDTree) { Union->Elements.Reserve(Context->NumMaxTargets); }
 
 			const PCGExData::FMutablePoint Point = PointDataFacade->GetOutPoint(Index);
 			const FVector Origin = Transforms[Index].GetLocation();
@@ -425,7 +433,26 @@ namespace PCGExSampleNearestPoint
 				}
 			};
 
-			if (RangeMax > 0)
+			if (Context->bUseTargetsKDTree)
+			{
+				PCGExData::FElement Hit;
+				double HitDistSquared = 0;
+
+				const double MinDistSquared = RangeMax > 0 ? RangeMin : 0;
+				const double MaxDistSquared = RangeMax > 0 ? RangeMax : MAX_dbl;
+
+				const bool bFound = Settings->SampleMethod == EPCGExSampleMethod::ClosestTarget ?
+					                    Context->TargetsHandler->FindNearestTarget(Origin, Hit, HitDistSquared, MinDistSquared, MaxDistSquared, &IgnoreList) :
+					                    Context->TargetsHandler->FindFarthestTarget(Origin, Hit, HitDistSquared, MinDistSquared, MaxDistSquared, &IgnoreList);
+
+				if (bFound)
+				{
+					PCGExData::FConstPoint Target = Context->TargetsHandler->GetPoint(Hit.IO, Hit.Index);
+					Target.IO = Hit.IO;
+					SampleTarget(Target);
+				}
+			}
+			else if (RangeMax > 0)
 			{
 				const FBox Box = FBoxCenterAndExtent(Origin, FVector(FMath::Sqrt(RangeMax))).GetBox();
 				Context->TargetsHandler->FindElementsWithBoundsTest(Box, SampleTarget, &IgnoreList);
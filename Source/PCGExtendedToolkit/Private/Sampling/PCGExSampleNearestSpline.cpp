@@ -4,11 +4,13 @@
 #include "Sampling/PCGExSampleNearestSpline.h"
 
 #include "PCGExScopedContainers.h"
+#include "Async/ParallelFor.h"
 #include "Data/PCGExDataTag.h"
 #include "Data/PCGExPointIO.h"
 #include "Data/Blending//PCGExBlendModes.h"
 #include "Details/PCGExDetailsDistances.h"
 #include "Details/PCGExDetailsSettings.h"
+#include "Paths/PCGExSegmentTree.h"
 
 #define LOCTEXT_NAMESPACE "PCGExSampleNearestSplineElement"
 #define PCGEX_NAMESPACE SampleNearestPolyLine
@@ -147,6 +149,17 @@ bool FPCGExSampleNearestSplineElement::Boot(FPCGExContext* InContext) const
 		for (int i = 0; i < Context->NumTargets; i++) { Context->SplineOctree->AddElement(PCGExOctree::FItem(i, SplineBounds[i])); }
 	}
 
+	if (Settings->bUseSegmentTree && !Settings->bSampleSpecificAlpha)
+	{
+		Context->SegmentTrees.Init(nullptr, Context->NumTargets);
+		ParallelFor(
+			Context->NumTargets, [&](const int32 i)
+			{
+				PCGEX_MAKE_SHARED(Tree, PCGExPaths::FSegmentTree, Context->Splines[i], Settings->SegmentTreeFidelity)
+				if (Tree->IsValid()) { Context->SegmentTrees[i] = Tree; }
+			});
+	}
+
 	PCGEX_FOREACH_FIELD_NEARESTPOLYLINE(PCGEX_OUTPUT_VALIDATE_NAME)
 
 	Context->bComputeTangents = Settings->bWriteArriveTangent || Settings->bWriteLeaveTangent;
@@ -274,6 +287,9 @@ namespace PCGExSampleNearestSpline
 		bSingleSample = Settings->SampleMethod != EPCGExSampleMethod::WithinRange;
 		bClosestSample = Settings->SampleMethod != EPCGExSampleMethod::FarthestTarget;
 
+		// Targets out of range can be skipped before evaluating the spline, as long as nothing else depends on them
+		bPruneByRange = !Context->SegmentTrees.IsEmpty() && !Settings->bWriteDepth && !Settings->bSplineScalesRanges && Settings->DistanceSettings == EPCGExDistance::Center;
+
 		StartParallelLoopForPoints();
 
 		return true;
@@ -454,10 +470,26 @@ namespace PCGExSampleNearestSpline
 			// First: Sample all valid targets
 			if (!Settings->bSampleSpecificAlpha)
 			{
+				const bool bPruneTrees = bPruneByRange && BaseRangeMax > 0;
+
 				auto ProcessClosestAlpha = [&](const int32 TargetIndex)
 				{
 					const FPCGSplineStruct& Line = Context->Splines[TargetIndex];
-					const double Time = Line.FindInputKeyClosestToWorldLocation(Origin);
+					double Time = 0;
+
+					if (const PCGExPaths::FSegmentTree* Tree = Context->SegmentTrees.IsEmpty() ? nullptr : Context->SegmentTrees[TargetIndex].Get())
+					{
+						// Tessellation can sit farther than the curve itself, pad by how far this tree strays from it; the exact range test happens in ProcessTarget
+						const double PruneDistSquared = bPruneTrees ? FMath::Square(BaseRangeMax + Tree->GetMaxDeviation()) : MAX_dbl;
+
+						double DistSquared = 0;
+						if (!Tree->FindClosestKey(Origin, Time, DistSquared, PruneDistSquared)) { return; }
+					}
+					else
+					{
+						Time = Line.FindInputKeyClosestToWorldLocation(Origin);
+					}
+
 					ProcessTarget(
 						Line.GetTransformAtSplineInputKey(static_cast<float>(Time), ESplineCoordinateSpace::World, Settings->bSplineScalesRanges),
 						Time, Context->SegmentCounts[TargetIndex], Line);
@@ -372,7 +372,7 @@ namespace PCGExSampling
 	{
 		for (int i = 0; i < TargetFacades.Num(); i++)
 		{
-			if (Exclude && Exclude->Contains(TargetFacades[i]->GetIn())) { return; }
+			if (Exclude && Exclude->Contains(TargetFacades[i]->GetIn())) { continue; }
 			const int32 NumPoints = TargetFacades[i]->GetNum();
 			for (int j = 0; j < NumPoints; j++) { It(PCGExData::FPoint(j, i)); }
 		}
@@ -383,7 +383,7 @@ namespace PCGExSampling
 		for (int i = 0; i < TargetFacades.Num(); i++)
 		{
 			const TSharedRef<PCGExData::FFacade>& Target = TargetFacades[i];
-			if (Exclude && Exclude->Contains(Target->GetIn())) { return; }
+			if (Exclude && Exclude->Contains(Target->GetIn())) { continue; }
 			const int32 NumPoints = TargetFacades[i]->GetNum();
 			for (int j = 0; j < NumPoints; j++)
 			{
@@ -605,6 +605,74 @@ namespace PCGExSampling
 			});
 	}
 
+	void FTargetsHandler::BuildKDTree()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FTargetsHandler::BuildKDTree);
+
+		int32 NumPoints = 0;
+		for (const TSharedRef<PCGExData::FFacade>& Target : TargetFacades) { NumPoints += Target->GetNum(); }
+
+		TArray<FVector> Positions;
+		Positions.Reserve(NumPoints);
+		KDTreeElements.Reset(NumPoints);
+
+		for (int i = 0; i < TargetFacades.Num(); i++)
+		{
+			const TConstPCGValueRange<FTransform> Transforms = TargetFacades[i]->GetIn()->GetConstTransformValueRange();
+			for (int j = 0; j < Transforms.Num(); j++)
+			{
+				Positions.Add(Transforms[j].GetLocation());
+				KDTreeElements.Emplace(j, i);
+			}
+		}
+
+		TargetsKDTree = MakeShared<PCGExGeo::FKDTree>();
+		TargetsKDTree->Build(Positions);
+	}
+
+	bool FTargetsHandler::FindNearestTarget(const FVector& Center, PCGExData::FElement& OutTarget, double& OutDistSquared, const double MinDistSquared, const double MaxDistSquared, const TSet<const UPCGData*>* Exclude) const
+	{
+		PCGExGeo::FKDTree::FHit Hit;
+
+		const bool bFound = Exclude && !Exclude->IsEmpty() ?
+			                    TargetsKDTree->FindNearest(Center, Hit, [&](const int32 Item) { return !Exclude->Contains(TargetFacades[KDTreeElements[Item].IO]->GetIn()); }, MinDistSquared, MaxDistSquared) :
+			                    TargetsKDTree->FindNearest(Center, Hit, [](const int32 Item) { return true; }, MinDistSquared, MaxDistSquared);
+
+		if (!bFound) { return false; }
+
+		OutTarget = KDTreeElements[Hit.Item];
+		OutDistSquared = Hit.DistSquared;
+		return true;
+	}
+
+	bool FTargetsHandler::FindFarthestTarget(const FVector& Center, PCGExData::FElement& OutTarget, double& OutDistSquared, const double MinDistSquared, const double MaxDistSquared, const TSet<const UPCGData*>* Exclude) const
+	{
+		PCGExGeo::FKDTree::FHit Hit;
+
+		const bool bFound = Exclude && !Exclude->IsEmpty() ?
+			                    TargetsKDTree->FindFarthest(Center, Hit, [&](const int32 Item) { return !Exclude->Contains(TargetFacades[KDTreeElements[Item].IO]->GetIn()); }, MinDistSquared, MaxDistSquared) :
+			                    TargetsKDTree->FindFarthest(Center, Hit, [](const int32 Item) { return true; }, MinDistSquared, MaxDistSquared);
+
+		if (!bFound) { return false; }
+
+		OutTarget = KDTreeElements[Hit.Item];
+		OutDistSquared = Hit.DistSquared;
+		return true;
+	}
+
+	int32 FTargetsHandler::FindKNearestTargets(const FVector& Center, const int32 K, TArray<PCGExData::FElement>& OutTargets, const double MaxDistSquared, const TSet<const UPCGData*>* Exclude) const
+	{
+		TArray<PCGExGeo::FKDTree::FHit> Hits;
+
+		if (Exclude && !Exclude->IsEmpty()) { TargetsKDTree->FindKNearest(Center, K, Hits, [&](const int32 Item) { return !Exclude->Contains(TargetFacades[KDTreeElements[Item].IO]->GetIn()); }, MaxDistSquared); }
+		else { TargetsKDTree->FindKNearest(Center, K, Hits, [](const int32 Item) { return true; }, MaxDistSquared); }
+
+		OutTargets.Reset(Hits.Num());
+		for (const PCGExGeo::FKDTree::FHit& Hit : Hits) { OutTargets.Add(KDTreeElements[Hit.Item]); }
+
+		return OutTargets.Num();
+	}
+
 	PCGExData::FConstPoint FTargetsHandler::GetPoint(const int32 IO, const int32 Index) const
 	{
 		return TargetFacades[IO]->GetInPoint(Index);
@@ -119,7 +119,7 @@ namespace PCGExSelfPruning
 		{
 			TSharedPtr<PCGExSorting::FPointSorter> Sorter = MakeShared<PCGExSorting::FPointSorter>(Context, PointDataFacade, PCGExSorting::GetSortingRules(Context, PCGExSorting::SourceSortingRules));
 			Sorter->SortDirection = Settings->SortDirection;
-			if (Sorter->Init(Context)) { Order.Sort([&](const int32 A, const int32 B) { return Sorter->Sort(A, B); }); }
+			if (Sorter->Init(Context)) { Sorter->Sort(Order); }
 
 			if (Settings->bRandomize)
 			{
@@ -111,40 +111,30 @@ namespace PCGExLloydRelax
 	{
 		NumIterations--;
 
-		TUniquePtr<PCGExGeo::TDelaunay3> Delaunay = MakeUnique<PCGExGeo::TDelaunay3>();
 		TArray<FVector>& Positions = Processor->ActivePositions;
-
-		//FPCGExPointsProcessorContext* Context = static_cast<FPCGExPointsProcessorContext*>(Manager->Context);
-
-		const TArrayView<FVector> View = MakeArrayView(Positions);
-		if (!Delaunay->Process<false, false>(View)) { return; }
-
 		const int32 NumPoints = Positions.Num();
+		if (NumPoints <= 3) { return; }
 
-		TArray<FVector> Sum;
-		TArray<double> Counts;
-		Sum.Append(Processor->ActivePositions);
-		Counts.SetNum(NumPoints);
-		for (int i = 0; i < NumPoints; i++) { Counts[i] = 1; }
+		// Only the tetrahedra are needed, skip the edges & sites TDelaunay3 would build
+		const TArrayView<FVector> View = MakeArrayView(Positions);
+		TArray<FIntVector4> Tetrahedra;
 
-		FVector Centroid;
-		for (const PCGExGeo::FDelaunaySite3& Site : Delaunay->Sites)
 		{
-			PCGExGeo::GetCentroid(Positions, Site.Vtx, Centroid);
-			for (const int32 PtIndex : Site.Vtx)
-			{
-				Counts[PtIndex] += 1;
-				Sum[PtIndex] += Centroid;
-			}
+			UE::Geometry::FDelaunay3 Tetrahedralization;
+			if (!Tetrahedralization.Triangulate(View)) { return; }
+			Tetrahedra = Tetrahedralization.GetTetrahedra();
 		}
 
+		TArray<FVector> Averages;
+		PCGExGeo::GetAverageSiteCentroids(
+			View, TConstArrayView<int32>(reinterpret_cast<const int32*>(Tetrahedra.GetData()), Tetrahedra.Num() * 4), 4,
+			Averages);
+
 		if (InfluenceSettings->bProgressiveInfluence)
 		{
-			for (int i = 0; i < NumPoints; i++) { Positions[i] = FMath::Lerp(Positions[i], Sum[i] / Counts[i], InfluenceSettings->GetInfluence(i)); }
+			for (int i = 0; i < NumPoints; i++) { Positions[i] = FMath::Lerp(Positions[i], Averages[i], InfluenceSettings->GetInfluence(i)); }
 		}
 
-		Delaunay.Reset();
-
 		if (NumIterations > 0)
 		{
 			PCGEX_LAUNCH_INTERNAL(FLloydRelaxTask, TaskIndex + 1, Processor, InfluenceSettings, NumIterations)
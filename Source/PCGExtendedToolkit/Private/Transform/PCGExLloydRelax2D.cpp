@@ -119,42 +119,26 @@ namespace PCGExLloydRelax2D
 	{
 		NumIterations--;
 
-		TUniquePtr<PCGExGeo::TDelaunay2> Delaunay = MakeUnique<PCGExGeo::TDelaunay2>();
+		PCGExGeo::FWarmDelaunay2& Delaunay = Processor->Delaunay;
 		TArray<FVector>& Positions = Processor->ActivePositions;
 
-		//FPCGExPointsProcessorContext* Context = static_cast<FPCGExPointsProcessorContext*>(Manager->Context);
-
 		const TArrayView<FVector> View = MakeArrayView(Positions);
-		if (!Delaunay->Process(View, Processor->ProjectionDetails)) { return; }
+		if (!Delaunay.Update(View, Processor->ProjectionDetails)) { return; }
 
 		const int32 NumPoints = Positions.Num();
 
-		TArray<FVector> Sum;
-		TArray<double> Counts;
-		Sum.Append(Processor->ActivePositions);
-		Counts.SetNum(NumPoints);
-		for (int i = 0; i < NumPoints; i++) { Counts[i] = 1; }
-
-		FVector Centroid;
-		for (const PCGExGeo::FDelaunaySite2& Site : Delaunay->Sites)
-		{
-			PCGExGeo::GetCentroid(Positions, Site.Vtx, Centroid);
-			for (const int32 PtIndex : Site.Vtx)
-			{
-				Counts[PtIndex] += 1;
-				Sum[PtIndex] += Centroid;
-			}
-		}
+		TArray<FVector> Averages;
+		PCGExGeo::GetAverageSiteCentroids(View, Delaunay.Triangles, 3, Averages);
 
 		if (InfluenceSettings->bProgressiveInfluence)
 		{
 			for (int i = 0; i < NumPoints; i++)
 			{
-				Positions[i] = FMath::Lerp(Positions[i], Sum[i] / Counts[i], InfluenceSettings->GetInfluence(i));
+				Positions[i] = FMath::Lerp(Positions[i], Averages[i], InfluenceSettings->GetInfluence(i));
 			}
 		}
 
-		Delaunay.Reset();
+		if (NumIterations == 0) { Delaunay.Reset(); }
 
 		if (NumIterations > 0)
 		{
@@ -45,6 +45,8 @@ bool FPCGExTensorsTransformElement::Boot(FPCGExContext* InContext) const
 
 	PCGEX_FOREACH_FIELD_TRTENSOR(PCGEX_OUTPUT_VALIDATE_NAME)
 
+	Context->TensorField = Settings->TensorHandlerDetails.TryCreateBakedField(Context, Context->TensorFactories);
+
 	GetInputFactories(
 		Context, PCGExPointFilter::SourceStopConditionLabel, Context->StopFilterFactories,
 		PCGExFactories::PointFilters, false);
@@ -102,7 +104,7 @@ namespace PCGExTensorsTransform
 		}
 
 		TensorsHandler = MakeShared<PCGExTensor::FTensorsHandler>(Settings->TensorHandlerDetails);
-		if (!TensorsHandler->Init(Context, Context->TensorFactories, PointDataFacade)) { return false; }
+		if (!TensorsHandler->Init(Context, Context->TensorFactories, PointDataFacade, Context->TensorField)) { return false; }
 
 		{
 			const TSharedRef<PCGExData::FFacade>& OutputFacade = PointDataFacade;
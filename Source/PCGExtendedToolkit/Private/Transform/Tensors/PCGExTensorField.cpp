@@ -0,0 +1,162 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Transform/Tensors/PCGExTensorField.h"
+
+#include "Transform/Tensors/PCGExTensorFactoryProvider.h"
+#include "Transform/Tensors/PCGExTensorOperation.h"
+#include "Transform/Tensors/Samplers/PCGExTensorSampler.h"
+
+namespace PCGExTensor
+{
+	FTensorField::FTensorField(const double InCellSize)
+		: CellSize(FMath::Max(InCellSize, 1.0)), InvCellSize(1.0 / CellSize)
+	{
+	}
+
+	bool FTensorField::Init(FPCGExContext* InContext, const TArray<TObjectPtr<const UPCGExTensorFactoryData>>& InFactories)
+	{
+		TArray<TSharedPtr<PCGExTensorOperation>> InTensors;
+		InTensors.Reserve(InFactories.Num());
+
+		for (const UPCGExTensorFactoryData* Factory : InFactories)
+		{
+			TSharedPtr<PCGExTensorOperation> Op = Factory->CreateOperation(InContext);
+			if (!Op || !Op->PrepareForData(nullptr)) { continue; }
+			InTensors.Add(Op);
+		}
+
+		return Init(InTensors);
+	}
+
+	bool FTensorField::Init(const TArray<TSharedPtr<PCGExTensorOperation>>& InTensors)
+	{
+		if (InTensors.IsEmpty() || !CanBake(InTensors)) { return false; }
+		Tensors = InTensors;
+		return true;
+	}
+
+	bool FTensorField::CanBake(const TArray<TSharedPtr<PCGExTensorOperation>>& InTensors)
+	{
+		for (const TSharedPtr<PCGExTensorOperation>& Op : InTensors) { if (!Op->CanBake()) { return false; } }
+		return true;
+	}
+
+	int32 FTensorField::NumBricks() const
+	{
+		FReadScopeLock ReadScopeLock(BricksLock);
+		return Bricks.Num();
+	}
+
+	bool FTensorField::Sample(const FVector& InPosition, FTensorSample& OutSample) const
+	{
+		const FVector Grid = InPosition * InvCellSize;
+		const FVector Floor = FVector(FMath::FloorToDouble(Grid.X), FMath::FloorToDouble(Grid.Y), FMath::FloorToDouble(Grid.Z));
+		const FIntVector Cell = FIntVector(static_cast<int32>(Floor.X), static_cast<int32>(Floor.Y), static_cast<int32>(Floor.Z));
+		const FIntVector Brick = FIntVector(
+			FMath::FloorToInt32(static_cast<double>(Cell.X) / BrickCells),
+			FMath::FloorToInt32(static_cast<double>(Cell.Y) / BrickCells),
+			FMath::FloorToInt32(static_cast<double>(Cell.Z) / BrickCells));
+
+		const FBrick* B = FindOrBuildBrick(Brick);
+
+		const FIntVector Local = Cell - Brick * BrickCells;
+		const FVector T = Grid - Floor;
+
+		FVector DirectionAndSize = FVector::ZeroVector;
+		FQuat4f Rotation = FQuat4f(0, 0, 0, 0);
+		double Effectors = 0;
+		double Weight = 0;
+
+		const FQuat4f& Reference = B->Rotation[VertIndex(Local.X, Local.Y, Local.Z)];
+
+		for (int i = 0; i < 8; i++)
+		{
+			const int32 DX = i & 1;
+			const int32 DY = (i >> 1) & 1;
+			const int32 DZ = (i >> 2) & 1;
+
+			const double W = (DX ? T.X : 1 - T.X) * (DY ? T.Y : 1 - T.Y) * (DZ ? T.Z : 1 - T.Z);
+			if (W <= 0) { continue; }
+
+			const int32 V = VertIndex(Local.X + DX, Local.Y + DY, Local.Z + DZ);
+
+			DirectionAndSize += FVector(B->DirectionAndSize[V]) * W;
+			Effectors += B->Effectors[V] * W;
+			Weight += B->Weight[V] * W;
+
+			// Keep quaternions in the same hemisphere before blending
+			const FQuat4f& Q = B->Rotation[V];
+			Rotation += (Q | Reference) < 0 ? Q * static_cast<float>(-W) : Q * static_cast<float>(W);
+		}
+
+		OutSample.DirectionAndSize = DirectionAndSize;
+		OutSample.Rotation = FQuat(Rotation.GetNormalized());
+		OutSample.Effectors = FMath::CeilToInt32(Effectors - UE_KINDA_SMALL_NUMBER);
+		OutSample.Weight = Weight;
+
+		return true;
+	}
+
+	const FTensorField::FBrick* FTensorField::FindOrBuildBrick(const FIntVector& InBrick) const
+	{
+		TSharedPtr<FBrick> Brick;
+
+		{
+			FReadScopeLock ReadScopeLock(BricksLock);
+			if (const TSharedPtr<FBrick>* Existing = Bricks.Find(InBrick)) { Brick = *Existing; }
+		}
+
+		if (!Brick)
+		{
+			FWriteScopeLock WriteScopeLock(BricksLock);
+			if (const TSharedPtr<FBrick>* Existing = Bricks.Find(InBrick)) { Brick = *Existing; } // Another worker got there first
+			else { Brick = Bricks.Add(InBrick, MakeShared<FBrick>()); }
+		}
+
+		if (Brick->bReady.load(std::memory_order_acquire)) { return Brick.Get(); }
+
+		// Built under the brick' own lock, so other bricks can be built concurrently
+		// while workers that need this one wait for it instead of sampling the tensors live
+		{
+			FScopeLock BuildScopeLock(&Brick->BuildLock);
+			if (!Brick->bReady.load(std::memory_order_acquire))
+			{
+				BuildBrick(InBrick, *Brick);
+				Brick->bReady.store(true, std::memory_order_release);
+			}
+		}
+
+		return Brick.Get();
+	}
+
+	void FTensorField::BuildBrick(const FIntVector& InBrick, FBrick& OutBrick) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FTensorField::BuildBrick);
+
+		OutBrick.DirectionAndSize.SetNumUninitialized(NumBrickVerts);
+		OutBrick.Rotation.SetNumUninitialized(NumBrickVerts);
+		OutBrick.Effectors.SetNumUninitialized(NumBrickVerts);
+		OutBrick.Weight.SetNumUninitialized(NumBrickVerts);
+
+		const FIntVector Origin = InBrick * BrickCells;
+
+		for (int z = 0; z < BrickVerts; z++)
+		{
+			for (int y = 0; y < BrickVerts; y++)
+			{
+				for (int x = 0; x < BrickVerts; x++)
+				{
+					const FVector Position = FVector(Origin.X + x, Origin.Y + y, Origin.Z + z) * CellSize;
+					const FTensorSample Sample = UPCGExTensorSampler::SampleTensors(Tensors, -1, FTransform(Position));
+
+					const int32 V = VertIndex(x, y, z);
+					OutBrick.DirectionAndSize[V] = FVector3f(Sample.DirectionAndSize);
+					OutBrick.Rotation[V] = FQuat4f(Sample.Rotation);
+					OutBrick.Effectors[V] = Sample.Effectors;
+					OutBrick.Weight[V] = Sample.Weight;
+				}
+			}
+		}
+	}
+}
@@ -7,9 +7,24 @@
 #include "Transform/Tensors/PCGExTensor.h"
 #include "Transform/Tensors/PCGExTensorFactoryProvider.h"
 #include "Transform/Tensors/PCGExTensorOperation.h"
+#include "Transform/Tensors/PCGExTensorField.h"
 
 PCGEX_SETTING_VALUE_IMPL(FPCGExTensorHandlerDetails, Size, double, SizeInput, SizeAttribute, SizeConstant)
 
+TSharedPtr<PCGExTensor::FTensorField> FPCGExTensorHandlerDetails::TryCreateBakedField(FPCGExContext* InContext, const TArray<TObjectPtr<const UPCGExTensorFactoryData>>& InFactories) const
+{
+	if (!bBake) { return nullptr; }
+
+	PCGEX_MAKE_SHARED(Field, PCGExTensor::FTensorField, BakeCellSize)
+	if (!Field->Init(InContext, InFactories))
+	{
+		PCGE_LOG_C(Warning, GraphAndLog, InContext, FTEXT("Some tensors depend on the probe orientation and cannot be baked; they will be sampled directly."));
+		return nullptr;
+	}
+
+	return Field;
+}
+
 namespace PCGExTensor
 {
 	FTensorsHandler::FTensorsHandler(const FPCGExTensorHandlerDetails& InConfig)
@@ -17,7 +32,7 @@ namespace PCGExTensor
 	{
 	}
 
-	bool FTensorsHandler::Init(FPCGExContext* InContext, const TArray<TObjectPtr<const UPCGExTensorFactoryData>>& InFactories, const TSharedPtr<PCGExData::FFacade>& InDataFacade)
+	bool FTensorsHandler::Init(FPCGExContext* InContext, const TArray<TObjectPtr<const UPCGExTensorFactoryData>>& InFactories, const TSharedPtr<PCGExData::FFacade>& InDataFacade, const TSharedPtr<FTensorField>& InBakedField)
 	{
 		if (!InContext->GetWorkPermit().Pin())
 		{
@@ -50,6 +65,16 @@ namespace PCGExTensor
 		// Fwd settings
 		SamplerInstance->Radius = Config.SamplerSettings.Radius;
 
+		if (Config.bBake)
+		{
+			SamplerInstance->BakedField = InBakedField;
+			if (!SamplerInstance->BakedField && FTensorField::CanBake(Tensors))
+			{
+				SamplerInstance->BakedField = MakeShared<FTensorField>(Config.BakeCellSize);
+				if (!SamplerInstance->BakedField->Init(Tensors)) { SamplerInstance->BakedField.Reset(); }
+			}
+		}
+
 		return SamplerInstance->PrepareForData(InContext);
 	}
 
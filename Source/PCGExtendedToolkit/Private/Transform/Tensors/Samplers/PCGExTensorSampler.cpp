@@ -6,6 +6,7 @@
 
 
 #include "Transform/Tensors/PCGExTensorOperation.h"
+#include "Transform/Tensors/PCGExTensorField.h"
 
 
 void UPCGExTensorSampler::CopySettingsFrom(const UPCGExInstancedFactory* Other)
@@ -18,10 +19,8 @@ bool UPCGExTensorSampler::PrepareForData(FPCGExContext* InContext)
 	return true;
 }
 
-PCGExTensor::FTensorSample UPCGExTensorSampler::RawSample(const TArray<TSharedPtr<PCGExTensorOperation>>& InTensors, const int32 InSeedIndex, const FTransform& InProbe) const
+PCGExTensor::FTensorSample UPCGExTensorSampler::SampleTensors(const TArray<TSharedPtr<PCGExTensorOperation>>& InTensors, const int32 InSeedIndex, const FTransform& InProbe)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(UPCGExTensorSampler::RawSample);
-
 	PCGExTensor::FTensorSample Result = PCGExTensor::FTensorSample();
 
 	TArray<PCGExTensor::FTensorSample> Samples;
@@ -66,6 +65,19 @@ PCGExTensor::FTensorSample UPCGExTensorSampler::RawSample(const TArray<TSharedPt
 	return Result;
 }
 
+PCGExTensor::FTensorSample UPCGExTensorSampler::RawSample(const TArray<TSharedPtr<PCGExTensorOperation>>& InTensors, const int32 InSeedIndex, const FTransform& InProbe) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPCGExTensorSampler::RawSample);
+
+	if (BakedField)
+	{
+		PCGExTensor::FTensorSample Result;
+		if (BakedField->Sample(InProbe.GetLocation(), Result)) { return Result; }
+	}
+
+	return SampleTensors(InTensors, InSeedIndex, InProbe);
+}
+
 PCGExTensor::FTensorSample UPCGExTensorSampler::Sample(const TArray<TSharedPtr<PCGExTensorOperation>>& InTensors, const int32 InSeedIndex, const FTransform& InProbe, bool& OutSuccess) const
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UPCGExTensorSampler::Sample);
@@ -181,6 +181,7 @@ public:
 	virtual bool PrepareForData(FPCGExContext* InContext);
 
 	virtual void BlendAutoWeight(const int32 SourceIndex, const int32 TargetIndex);
+	virtual void BlendAutoWeightRange(const PCGExMT::FScope& Scope, const TConstArrayView<int8> Mask);
 	virtual void Blend(const int32 SourceIndex, const int32 TargetIndex, const double InWeight);
 	virtual void Blend(const int32 SourceIndexA, const int32 SourceIndexB, const int32 TargetIndex, const double InWeight);
 
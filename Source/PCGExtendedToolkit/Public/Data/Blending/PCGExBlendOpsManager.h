@@ -53,6 +53,9 @@ namespace PCGExDataBlending
 		bool Init(FPCGExContext* InContext, const TArray<TObjectPtr<const UPCGExBlendOpFactory>>& InFactories);
 
 		void BlendAutoWeight(const int32 SourceIndex, const int32 TargetIndex) const;
+
+		// Same as BlendAutoWeight(Index, Index) over a whole scope, skipping indices where Mask is 0
+		void BlendAutoWeightRange(const PCGExMT::FScope& Scope, const TConstArrayView<int8> Mask) const;
 		virtual void Blend(const int32 SourceIndex, const int32 TargetIndex, const double InWeight) const override;
 		virtual void Blend(const int32 SourceAIndex, const int32 SourceBIndex, const int32 TargetIndex, const double InWeight) const override;
 
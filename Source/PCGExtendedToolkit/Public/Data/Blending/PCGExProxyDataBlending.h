@@ -94,8 +94,10 @@ namespace PCGExDataBlending
 
 		virtual void InitTrackers(TArray<PCGEx::FOpStats>& Trackers) const = 0;
 		virtual int32 ComputeWeights(const int32 WriteIndex, const TSharedPtr<PCGExData::IUnionData>& InUnionData, TArray<PCGExData::FWeightedPoint>& OutWeightedPoints) const = 0;
+		virtual int32 ComputeWeights(const int32 WriteIndex, const TConstArrayView<PCGExData::FElement> InElements, TArray<PCGExData::FWeightedPoint>& OutWeightedPoints) const = 0;
 		virtual void Blend(const int32 WriteIndex, const TArray<PCGExData::FWeightedPoint>& InWeightedPoints, TArray<PCGEx::FOpStats>& Trackers) const = 0;
 		virtual void MergeSingle(const int32 WriteIndex, const TSharedPtr<PCGExData::IUnionData>& InUnionData, TArray<PCGExData::FWeightedPoint>& OutWeightedPoints, TArray<PCGEx::FOpStats>& Trackers) const = 0;
+		virtual void MergeSingle(const int32 WriteIndex, const TConstArrayView<PCGExData::FElement> InElements, TArray<PCGExData::FWeightedPoint>& OutWeightedPoints, TArray<PCGEx::FOpStats>& Trackers) const = 0;
 		virtual void MergeSingle(const int32 UnionIndex, TArray<PCGExData::FWeightedPoint>& OutWeightedPoints, TArray<PCGEx::FOpStats>& Trackers) const = 0;
 
 		FORCEINLINE EPCGPointNativeProperties GetAllocatedProperties() const { return AllocatedProperties; }
@@ -115,6 +117,7 @@ namespace PCGExDataBlending
 		{
 		};
 		virtual int32 ComputeWeights(const int32 WriteIndex, const TSharedPtr<PCGExData::IUnionData>& InUnionData, TArray<PCGExData::FWeightedPoint>& OutWeightedPoints) const override;
+		virtual int32 ComputeWeights(const int32 WriteIndex, const TConstArrayView<PCGExData::FElement> InElements, TArray<PCGExData::FWeightedPoint>& OutWeightedPoints) const override;
 
 		virtual void Blend(const int32 WriteIndex, const TArray<PCGExData::FWeightedPoint>& InWeightedPoints, TArray<PCGEx::FOpStats>& Trackers) const override
 		{
@@ -124,6 +127,10 @@ namespace PCGExDataBlending
 		{
 		};
 
+		virtual void MergeSingle(const int32 WriteIndex, const TConstArrayView<PCGExData::FElement> InElements, TArray<PCGExData::FWeightedPoint>& OutWeightedPoints, TArray<PCGEx::FOpStats>& Trackers) const override
+		{
+		};
+
 		virtual void MergeSingle(const int32 UnionIndex, TArray<PCGExData::FWeightedPoint>& OutWeightedPoints, TArray<PCGEx::FOpStats>& Trackers) const override
 		{
 		};
@@ -153,6 +160,10 @@ namespace PCGExDataBlending
 		// Target = SourceA|SourceB
 		virtual void Blend(const int32 SourceIndexA, const int32 SourceIndexB, const int32 TargetIndex, const double Weight) = 0;
 
+		// Target = Source|Target, for every index in scope
+		// Weights & Mask are relative to Scope.Start; only indices with a non-zero mask are written
+		virtual void BlendRange(const PCGExMT::FScope& Scope, const TConstArrayView<double> Weights, const TConstArrayView<int8> Mask) = 0;
+
 		virtual PCGEx::FOpStats BeginMultiBlend(const int32 TargetIndex) = 0;
 		virtual void MultiBlend(const int32 SourceIndex, const int32 TargetIndex, const double Weight, PCGEx::FOpStats& Tracker) = 0;
 		virtual void EndMultiBlend(const int32 TargetIndex, PCGEx::FOpStats& Tracker) = 0;
@@ -194,6 +205,9 @@ extern template void FProxyDataBlender::Set<_TYPE>(const int32 TargetIndex, cons
 		virtual void Blend(const int32 SourceIndexA, const int32 SourceIndexB, const int32 TargetIndex, const double Weight = 1) override
 		PCGEX_NOT_IMPLEMENTED(Blend(const int32 SourceIndexA, const int32 SourceIndexB, const int32 TargetIndex, const double Weight = 1))
 
+		virtual void BlendRange(const PCGExMT::FScope& Scope, const TConstArrayView<double> Weights, const TConstArrayView<int8> Mask) override
+		PCGEX_NOT_IMPLEMENTED(BlendRange(const PCGExMT::FScope& Scope, const TConstArrayView<double> Weights, const TConstArrayView<int8> Mask))
+
 		virtual PCGEx::FOpStats BeginMultiBlend(const int32 TargetIndex) override
 		PCGEX_NOT_IMPLEMENTED_RET(BeginMultiBlend(const int32 TargetIndex), PCGEx::FOpStats{})
 
@@ -240,6 +254,7 @@ extern template class IProxyDataBlender<_TYPE>;
 		virtual ~TProxyDataBlender() override = default;
 
 		virtual void Blend(const int32 SourceIndexA, const int32 SourceIndexB, const int32 TargetIndex, const double Weight = 1) override;
+		virtual void BlendRange(const PCGExMT::FScope& Scope, const TConstArrayView<double> Weights, const TConstArrayView<int8> Mask) override;
 
 		virtual PCGEx::FOpStats BeginMultiBlend(const int32 TargetIndex) override;
 		virtual void MultiBlend(const int32 SourceIndex, const int32 TargetIndex, const double Weight, PCGEx::FOpStats& Tracker) override;
@@ -248,6 +263,9 @@ extern template class IProxyDataBlender<_TYPE>;
 		// Target = Target / Divider
 		// Useful for finalizing multi-source ops
 		virtual void Div(const int32 TargetIndex, const double Divider) override;
+
+	protected:
+		static T_WORKING BlendValues(const T_WORKING& InA, const T_WORKING& InB, const double Weight);
 	};
 
 #pragma region externalization
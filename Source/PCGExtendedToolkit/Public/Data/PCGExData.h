@@ -62,6 +62,24 @@ namespace PCGExData
 	PCGEXTENDEDTOOLKIT_API
 	FPCGAttributeIdentifier GetBufferIdentifierFromSelector(const FPCGAttributePropertyInputSelector& InSelector, const UPCGData* InData);
 
+	/**
+	 * Fully-read input values, shared by every buffer reading the same attribute from the same input data.
+	 * Input data is immutable, so readers alias a single read-only array instead of each facade holding its own copy.
+	 * Entries don't own anything and expire along with the last buffer referencing them.
+	 */
+	namespace SharedReadables
+	{
+		PCGEXTENDEDTOOLKIT_API
+		bool IsEnabled();
+
+		PCGEXTENDEDTOOLKIT_API
+		TSharedPtr<void> Find(const UPCGBasePointData* InData, const uint64 InBufferUID);
+
+		/** Registers the given values, unless some are already registered for that data & buffer, in which case those are returned instead. */
+		PCGEXTENDEDTOOLKIT_API
+		TSharedPtr<void> FindOrAdd(const UPCGBasePointData* InData, const uint64 InBufferUID, const TSharedPtr<void>& InValues);
+	}
+
 	class PCGEXTENDEDTOOLKIT_API IBuffer : public TSharedFromThis<IBuffer>
 	{
 		friend class FFacade;
@@ -131,6 +149,7 @@ namespace PCGExData
 
 	protected:
 		void SetType(const EPCGMetadataTypes InType);
+		void TrackAllocation(const SIZE_T InBytes) const;
 	};
 
 #define PCGEX_TPL(_TYPE, _NAME, ...) \
@@ -159,6 +178,9 @@ extern template bool IBuffer::IsA<_TYPE>() const;
 		// Unsafe read from input
 		virtual const T& Read(const int32 Index) const = 0;
 
+		// Unsafe read of OutValues.Num() consecutive input values, starting at Start
+		virtual void ReadRange(const int32 Start, TArrayView<T> OutValues) const;
+
 		// Unsafe read from output
 		virtual const T& GetValue(const int32 Index) = 0;
 
@@ -171,6 +193,9 @@ extern template bool IBuffer::IsA<_TYPE>() const;
 		// Unsafe set value in output
 		virtual void SetValue(const int32 Index, const T& Value) = 0;
 
+		// Unsafe set of InValues.Num() consecutive output values, starting at Start
+		virtual void SetRange(const int32 Start, TConstArrayView<T> InValues);
+
 		virtual bool InitForRead(const EIOSide InSide = EIOSide::In, const bool bScoped = false) = 0;
 		virtual bool InitForBroadcast(const FPCGAttributePropertyInputSelector& InSelector, const bool bCaptureMinMax = false, const bool bScoped = false) = 0;
 		virtual bool InitForWrite(const T& DefaultValue, bool bAllowInterpolation, EBufferInit Init = EBufferInit::Inherit) = 0;
@@ -220,11 +245,14 @@ extern template bool IBuffer::IsA<_TYPE>() const;
 		virtual bool ReadsFromOutput() override;
 
 		virtual const T& Read(const int32 Index) const override;
+		virtual void ReadRange(const int32 Start, TArrayView<T> OutValues) const override;
 		virtual const T& GetValue(const int32 Index) override;
 		virtual void SetValue(const int32 Index, const T& Value) override;
+		virtual void SetRange(const int32 Start, TConstArrayView<T> InValues) override;
 
 	protected:
 		virtual void InitForReadInternal(const bool bScoped, const FPCGMetadataAttributeBase* Attribute);
+		bool TryShareReadValues(const bool bRegister);
 		virtual void InitForWriteInternal(FPCGMetadataAttributeBase* Attribute, const T& InDefaultValue, const EBufferInit Init);
 
 	public:
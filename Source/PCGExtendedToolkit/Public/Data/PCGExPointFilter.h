@@ -1,4 +1,4 @@
-// Copyright 2025 Timothé Lapetite and contributors
+﻿// Copyright 2025 Timothé Lapetite and contributors
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #pragma once
@@ -192,6 +192,13 @@ namespace PCGExPointFilter
 
 		virtual bool Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const; // destined for collection only, is expected to test internal PointDataFacade directly.
 
+		/**
+		 * Batch test of every point in Scope. OutResults maps to the scope (OutResults[i] is the result of Scope.Start + i);
+		 * entries that are already cleared may be skipped, entries that fail are cleared, passing entries are left untouched.
+		 * Default implementation falls back to Test(Index).
+		 */
+		virtual void TestScope(const PCGExMT::FScope& Scope, TArrayView<int8> OutResults) const;
+
 		virtual void SetSupportedTypes(const TSet<PCGExFactories::EType>* InTypes)
 		{
 		}
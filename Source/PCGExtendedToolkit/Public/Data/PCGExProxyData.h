@@ -5,6 +5,7 @@
 
 #include "CoreMinimal.h"
 #include "PCGExBroadcast.h"
+#include "PCGExMT.h"
 #include "Metadata/PCGAttributePropertySelector.h"
 #include "UObject/Object.h"
 
@@ -27,6 +28,9 @@ namespace PCGExData
 		Write
 	};
 
+	// Number of values converted at once by range reads & writes that can't work in place
+	constexpr int32 ProxyRangeChunkSize = 64;
+
 	struct PCGEXTENDEDTOOLKIT_API FProxyDescriptor
 	{
 		FPCGAttributePropertyInputSelector Selector;
@@ -88,6 +92,11 @@ namespace PCGExData
 #define PCGEX_CONVERTING_READ(_TYPE, _NAME, ...) FORCEINLINE virtual _TYPE ReadAs##_NAME(const int32 Index) const PCGEX_NOT_IMPLEMENTED_RET(ReadAs##_NAME, _TYPE{})
 		PCGEX_FOREACH_SUPPORTEDTYPES(PCGEX_CONVERTING_READ)
 #undef PCGEX_CONVERTING_READ
+
+		// Bulk converting reads, OutValues[i] is the value at Scope.Start + i
+#define PCGEX_CONVERTING_READ_RANGE(_TYPE, _NAME, ...) virtual void ReadRangeAs##_NAME(const PCGExMT::FScope& Scope, TArrayView<_TYPE> OutValues) const PCGEX_NOT_IMPLEMENTED(ReadRangeAs##_NAME)
+		PCGEX_FOREACH_SUPPORTEDTYPES(PCGEX_CONVERTING_READ_RANGE)
+#undef PCGEX_CONVERTING_READ_RANGE
 	};
 
 	template <typename T_WORKING>
@@ -101,12 +110,38 @@ namespace PCGExData
 		virtual T_WORKING GetCurrent(const int32 Index) const { return Get(Index); };
 		virtual TSharedPtr<IBuffer> GetBuffer() const override { return nullptr; }
 
+		// Bulk Get, OutValues[i] is the value at Scope.Start + i
+		virtual void GetRange(const PCGExMT::FScope& Scope, TArrayView<T_WORKING> OutValues) const;
+
+		// Bulk Set, InValues[i] is written at Scope.Start + i
+		virtual void SetRange(const PCGExMT::FScope& Scope, TConstArrayView<T_WORKING> InValues) const;
+
 #define PCGEX_CONVERTING_READ(_TYPE, _NAME, ...) FORCEINLINE virtual _TYPE ReadAs##_NAME(const int32 Index) const override { \
 		if constexpr (std::is_same_v<_TYPE, T_WORKING>) { return Get(Index); } \
 		else { return PCGEx::Convert<T_WORKING, _TYPE>(Get(Index)); } \
 	}
 		PCGEX_FOREACH_SUPPORTEDTYPES(PCGEX_CONVERTING_READ)
 #undef PCGEX_CONVERTING_READ
+
+#define PCGEX_CONVERTING_READ_RANGE(_TYPE, _NAME, ...) virtual void ReadRangeAs##_NAME(const PCGExMT::FScope& Scope, TArrayView<_TYPE> OutValues) const override { \
+		if constexpr (std::is_same_v<_TYPE, T_WORKING>) { GetRange(Scope, OutValues); } \
+		else { ConvertRange<_TYPE>(Scope, OutValues); } \
+	}
+		PCGEX_FOREACH_SUPPORTEDTYPES(PCGEX_CONVERTING_READ_RANGE)
+#undef PCGEX_CONVERTING_READ_RANGE
+
+	protected:
+		template <typename T_TO>
+		void ConvertRange(const PCGExMT::FScope& Scope, TArrayView<T_TO> OutValues) const
+		{
+			T_WORKING Chunk[ProxyRangeChunkSize];
+			for (int32 Offset = 0; Offset < Scope.Count; Offset += ProxyRangeChunkSize)
+			{
+				const int32 Num = FMath::Min(ProxyRangeChunkSize, Scope.Count - Offset);
+				GetRange(PCGExMT::FScope(Scope.Start + Offset, Num), MakeArrayView(Chunk, Num));
+				for (int i = 0; i < Num; i++) { OutValues[Offset + i] = PCGEx::Convert<T_WORKING, T_TO>(Chunk[i]); }
+			}
+		}
 	};
 
 	template <typename T_REAL, typename T_WORKING, bool bSubSelection>
@@ -123,6 +158,9 @@ namespace PCGExData
 		virtual void Set(const int32 Index, const T_WORKING& Value) const override;
 		virtual T_WORKING GetCurrent(const int32 Index) const override;
 
+		virtual void GetRange(const PCGExMT::FScope& Scope, TArrayView<T_WORKING> OutValues) const override;
+		virtual void SetRange(const PCGExMT::FScope& Scope, TConstArrayView<T_WORKING> InValues) const override;
+
 		virtual TSharedPtr<IBuffer> GetBuffer() const override;
 		virtual bool EnsureReadable() const override;
 	};
@@ -138,6 +176,10 @@ namespace PCGExData
 
 		virtual T_WORKING Get(const int32 Index) const override;
 		virtual void Set(const int32 Index, const T_WORKING& Value) const override;
+
+		// Fetch the property value range once for the whole scope
+		virtual void GetRange(const PCGExMT::FScope& Scope, TArrayView<T_WORKING> OutValues) const override;
+		virtual void SetRange(const PCGExMT::FScope& Scope, TConstArrayView<T_WORKING> InValues) const override;
 	};
 
 #pragma region externalization TPointPropertyProxy
@@ -207,6 +249,14 @@ extern template class TPointExtraPropertyProxy<_REALTYPE, _TYPE, false, _PROPERT
 			check(false)
 		}
 
+		virtual void GetRange(const PCGExMT::FScope& Scope, TArrayView<T_WORKING> OutValues) const override { for (int i = 0; i < Scope.Count; i++) { OutValues[i] = Constant; } }
+
+		virtual void SetRange(const PCGExMT::FScope& Scope, TConstArrayView<T_WORKING> InValues) const override
+		{
+			// This should never happen, check the callstack
+			check(false)
+		}
+
 		virtual bool Validate(const FProxyDescriptor& InDescriptor) const override { return InDescriptor.WorkingType == this->WorkingType; }
 	};
 
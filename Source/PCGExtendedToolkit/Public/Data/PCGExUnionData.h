@@ -29,6 +29,15 @@ namespace PCGExData
 
 #pragma region Compound
 
+	PCGEXTENDEDTOOLKIT_API
+	int32 ComputeUnionWeights(
+		const TConstArrayView<FElement> InElements,
+		const TArray<const UPCGBasePointData*>& Sources,
+		const TSharedPtr<PCGEx::FIndexLookup>& IdxLookup,
+		const FPoint& Target,
+		const TSharedPtr<PCGExDetails::FDistances>& InDistanceDetails,
+		TArray<FWeightedPoint>& OutWeightedPoints);
+
 	class PCGEXTENDEDTOOLKIT_API IUnionData : public TSharedFromThis<IUnionData>
 	{
 	protected:
@@ -79,26 +88,63 @@ namespace PCGExData
 		}
 	};
 
+	// An element tagged with the index of the union entry it belongs to
+	struct FUnionElement
+	{
+		int32 Entry = -1;
+		FElement Element;
+
+		FUnionElement() = default;
+
+		FUnionElement(const int32 InEntry, const int32 InIndex, const int32 InIO)
+			: Entry(InEntry), Element(InIndex == -1 ? 0 : InIndex, InIO)
+		{
+		}
+	};
+
 	class PCGEXTENDEDTOOLKIT_API FUnionMetadata : public TSharedFromThis<FUnionMetadata>
 	{
 	public:
 		TArray<TSharedPtr<IUnionData>> Entries;
 		bool bIsAbstract = false;
 
+		// Flat layout, entry i owns FlatElements[Offsets[i] .. Offsets[i + 1]). Used instead of Entries once built.
+		TArray<int32> Offsets;
+		TArray<FElement> FlatElements;
+
 		FUnionMetadata() = default;
 		~FUnionMetadata() = default;
 
-		int32 Num() const { return Entries.Num(); }
+		FORCEINLINE bool IsFlat() const { return !Offsets.IsEmpty(); }
+		FORCEINLINE int32 Num() const { return IsFlat() ? Offsets.Num() - 1 : Entries.Num(); }
 		void SetNum(const int32 InNum);
 
+		/**
+		 * Build the flat layout from lists of tagged elements, counting entry sizes first then scattering elements in place.
+		 * An entry must not be spread over multiple chunks; element order within an entry is preserved.
+		 */
+		void BuildFlat(const int32 InNumEntries, const TArray<TConstArrayView<FUnionElement>>& InChunks);
+
+		FORCEINLINE TConstArrayView<FElement> GetElements(const int32 Index) const
+		{
+			if (IsFlat()) { return TConstArrayView<FElement>(FlatElements.GetData() + Offsets[Index], Offsets[Index + 1] - Offsets[Index]); }
+			if (Entries.IsValidIndex(Index) && Entries[Index]) { return Entries[Index]->Elements; }
+			return TConstArrayView<FElement>();
+		}
+
+		FORCEINLINE int32 GetNumElements(const int32 Index) const { return GetElements(Index).Num(); }
+
+		void GetIOSet(const int32 Index, TSet<int32>& OutIOSet) const;
+
 		TSharedPtr<IUnionData> NewEntry_Unsafe(const FConstPoint& Point);
 		TSharedPtr<IUnionData> NewEntryAt_Unsafe(const int32 ItemIndex);
 
 		FORCEINLINE void Append_Unsafe(const int32 Index, const FPoint& Point) { Entries[Index]->Add_Unsafe(Point); }
 		FORCEINLINE void Append(const int32 Index, const FPoint& Point) { Entries[Index]->Add(Point); }
 
-		bool IOIndexOverlap(const int32 InIdx, const TSet<int32>& InIndices);
+		bool IOIndexOverlap(const int32 InIdx, const TSet<int32>& InIndices) const;
 
+		// Entry-backed metadata only, use GetElements on flat metadata
 		FORCEINLINE TSharedPtr<IUnionData> Get(const int32 Index) const { return Entries.IsValidIndex(Index) ? Entries[Index] : nullptr; }
 	};
 
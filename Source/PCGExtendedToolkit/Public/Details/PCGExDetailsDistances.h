@@ -77,6 +77,9 @@ namespace PCGExDetails
 
 		virtual double GetDistSquared(const PCGExData::FPoint& SourcePoint, const PCGExData::FPoint& TargetPoint, bool& bOverlap) const = 0;
 		virtual double GetDist(const PCGExData::FPoint& SourcePoint, const PCGExData::FPoint& TargetPoint, bool& bOverlap) const = 0;
+
+		/** Whether distances are plain point-to-point distances, in which case spatial indices over point locations are exact */
+		virtual bool IsCenterToCenter() const = 0;
 	};
 
 	template <EPCGExDistance Source, EPCGExDistance Target>
@@ -101,6 +104,8 @@ namespace PCGExDetails
 		virtual double GetDistSquared(const PCGExData::FPoint& SourcePoint, const PCGExData::FPoint& TargetPoint, bool& bOverlap) const override;
 
 		virtual double GetDist(const PCGExData::FPoint& SourcePoint, const PCGExData::FPoint& TargetPoint, bool& bOverlap) const override;
+
+		virtual bool IsCenterToCenter() const override { return Source == EPCGExDistance::Center && Target == EPCGExDistance::Center; }
 	};
 
 	extern template class TDistances<EPCGExDistance::Center, EPCGExDistance::Center>;
@@ -38,6 +38,7 @@ namespace PCGExDetails
 
 		FORCEINLINE virtual bool IsConstant() { return false; }
 		FORCEINLINE virtual T Read(const int32 Index) = 0;
+		virtual void ReadRange(const int32 Start, TArrayView<T> OutValues) { for (int i = 0; i < OutValues.Num(); i++) { OutValues[i] = Read(Start + i); } }
 		FORCEINLINE virtual T Min() = 0;
 		FORCEINLINE virtual T Max() = 0;
 		FORCEINLINE virtual uint32 ReadValueHash(const int32 Index) = 0;
@@ -59,6 +60,7 @@ namespace PCGExDetails
 		virtual bool Init(const TSharedPtr<PCGExData::FFacade>& InDataFacade, const bool bSupportScoped = true, const bool bCaptureMinMax = false) override;
 
 		virtual T Read(const int32 Index) override;
+		virtual void ReadRange(const int32 Start, TArrayView<T> OutValues) override;
 		virtual T Min() override;
 		virtual T Max() override;
 		virtual uint32 ReadValueHash(const int32 Index) override;
@@ -80,6 +82,7 @@ namespace PCGExDetails
 		virtual bool Init(const TSharedPtr<PCGExData::FFacade>& InDataFacade, const bool bSupportScoped = true, const bool bCaptureMinMax = false) override;
 
 		virtual T Read(const int32 Index) override;
+		virtual void ReadRange(const int32 Start, TArrayView<T> OutValues) override;
 		virtual T Min() override;
 		virtual T Max() override;
 		virtual uint32 ReadValueHash(const int32 Index) override;
@@ -103,6 +106,7 @@ namespace PCGExDetails
 		FORCEINLINE virtual void SetConstant(T InConstant) override { Constant = InConstant; };
 
 		FORCEINLINE virtual T Read(const int32 Index) override { return Constant; }
+		virtual void ReadRange(const int32 Start, TArrayView<T> OutValues) override { for (T& Value : OutValues) { Value = Constant; } }
 		FORCEINLINE virtual T Min() override { return Constant; }
 		FORCEINLINE virtual T Max() override { return Constant; }
 		virtual uint32 ReadValueHash(const int32 Index) override;
@@ -0,0 +1,98 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExGeo
+{
+	/**
+	 * Octree over a point cloud where every cell keeps its item count & center of mass,
+	 * so the sum of an inverse-square field over all items can be approximated in O(log N) per query (Barnes-Hut).
+	 * Items all have unit mass; queries report the index the item had in the array the tree was built from.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FBarnesHutTree : public TSharedFromThis<FBarnesHutTree>
+	{
+	public:
+		static constexpr int32 LeafSize = 8;
+		static constexpr int32 MaxDepth = 32; // Stops subdividing coincident items
+
+		struct FNode
+		{
+			FVector CenterOfMass = FVector::ZeroVector;
+			FVector Center = FVector::ZeroVector;
+			double Extent = 0; // Half the cell size
+			int32 Start = 0;
+			int32 Count = 0;
+			int32 FirstChild = -1;
+			int32 NumChildren = 0;
+
+			FORCEINLINE bool IsLeaf() const { return FirstChild == -1; }
+
+			FORCEINLINE bool Contains(const FVector& Position) const
+			{
+				return FMath::Abs(Position.X - Center.X) <= Extent &&
+					FMath::Abs(Position.Y - Center.Y) <= Extent &&
+					FMath::Abs(Position.Z - Center.Z) <= Extent;
+			}
+		};
+
+		FBarnesHutTree() = default;
+
+		void Build(const TArray<FVector>& InPositions);
+
+		FORCEINLINE int32 Num() const { return Positions.Num(); }
+		FORCEINLINE bool IsEmpty() const { return Positions.IsEmpty(); }
+
+		/**
+		 * Invoke Callback(Position, Mass) for every body acting on Center, skipping the item at index Self.
+		 * Cells whose size over distance falls under Theta are reported as a single body at their center of mass;
+		 * Theta = 0 visits every item individually.
+		 */
+		template <typename Func>
+		void ForEachBody(const FVector& Center, const int32 Self, const double Theta, Func&& Callback) const
+		{
+			if (Nodes.IsEmpty()) { return; }
+
+			const double ThetaSquared = Theta * Theta;
+
+			TArray<int32, TInlineAllocator<64>> Stack;
+			Stack.Add(0);
+
+			while (!Stack.IsEmpty())
+			{
+				const FNode& Node = Nodes[Stack.Pop(EAllowShrinking::No)];
+
+				if (Node.IsLeaf())
+				{
+					for (int i = Node.Start; i < Node.Start + Node.Count; i++)
+					{
+						if (Items[i] == Self) { continue; }
+						Callback(Positions[i], 1.0);
+					}
+
+					continue;
+				}
+
+				// A cell containing the query is always opened, so an item never acts on itself through an aggregate
+				const double Size = Node.Extent * 2;
+				if (Size * Size < ThetaSquared * FVector::DistSquared(Node.CenterOfMass, Center) && !Node.Contains(Center))
+				{
+					Callback(Node.CenterOfMass, static_cast<double>(Node.Count));
+					continue;
+				}
+
+				for (int c = 0; c < Node.NumChildren; c++) { Stack.Add(Node.FirstChild + c); }
+			}
+		}
+
+	protected:
+		TArray<FVector> Positions;
+		TArray<int32> Items;
+		TArray<int32> Scratch;
+		TArray<FNode> Nodes;
+
+		void BuildNode(const TArray<FVector>& InPositions, const int32 NodeIndex, const FVector& Center, const double Extent, const int32 Start, const int32 Count, const int32 Depth);
+	};
+}
@@ -56,6 +56,64 @@ namespace PCGExGeo
 		void GetMergedSites(const int32 SiteIndex, const TSet<uint64>& EdgeConnectors, TSet<int32>& OutMerged, TSet<uint64>& OutUEdges, TBitArray<>& VisitedSites);
 	};
 
+	/**
+	 * 2D Delaunay triangulation of a point set that moves between updates.
+	 * Update repairs the previous triangulation in place with edge flips; vertices of triangles that folded over are
+	 * taken out and inserted back at their new position. Triangulates from scratch when the point count changes
+	 * or the repair gives up.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FWarmDelaunay2
+	{
+	public:
+		TArray<int32> Triangles; // Three vertex indices per triangle
+
+		FWarmDelaunay2() = default;
+
+		bool Update(const TArrayView<FVector>& Positions, const FPCGExGeo2DProjectionDetails& ProjectionDetails);
+		void Reset();
+
+		FORCEINLINE int32 NumTriangles() const { return Triangles.Num() / 3; }
+
+	protected:
+		int32 NumPoints = 0;
+		int32 Ghost = -1; // Virtual vertex shared by one triangle per hull edge, so hull changes are regular flips
+
+		std::vector<double> Coords;
+		std::vector<double> PrevCoords;
+
+		TArray<int32> Mesh;      // Three vertex indices per triangle, ghost triangles included; -1 on free slots
+		TArray<int32> HalfEdges; // Opposite half-edge
+		TArray<int32> VtxEdge;   // One half-edge leaving each vertex
+		TArray<int32> FreeSlots;
+		TArray<int32> NewSlots; // Triangles written since the last reset
+		TArray<int32> PendingEdges;
+		TArray<int32> RemovalHints; // Neighbor of each removed vertex, to start its point location from
+
+		int32 FlipBudget = 0;
+
+		bool Triangulate();
+		bool Repair();
+		bool RemoveVertex(const int32 Vtx);
+		bool InsertVertex(const int32 Vtx, const int32 Hint);
+		bool Legalize();
+		bool IsValidTriangulation() const;
+
+		FORCEINLINE bool IsGhost(const int32 Tri) const { return Mesh[Tri] == Ghost || Mesh[Tri + 1] == Ghost || Mesh[Tri + 2] == Ghost; }
+		FORCEINLINE int32 GetHullEdge(const int32 Tri) const { return Mesh[Tri] == Ghost ? Tri + 1 : Mesh[Tri + 1] == Ghost ? Tri + 2 : Tri; }
+
+		FORCEINLINE void Link(const int32 A, const int32 B)
+		{
+			HalfEdges[A] = B;
+			if (B != -1) { HalfEdges[B] = A; }
+		}
+
+		void SetTriangle(const int32 Tri, const int32 A, const int32 B, const int32 C);
+		int32 AllocTriangle();
+		void FreeTriangle(const int32 Tri);
+		bool ShouldFlip(const int32 Edge) const;
+		void Flip(const int32 Edge);
+	};
+
 	static int32 MTX[4][3] = {
 		{0, 1, 2},
 		{0, 1, 3},
@@ -200,4 +258,11 @@ namespace PCGExGeo
 		void RemoveLongestEdges(const TArrayView<FVector>& Positions);
 		void RemoveLongestEdges(const TArrayView<FVector>& Positions, TSet<uint64>& LongestEdges);
 	};
+
+	/**
+	 * Per point, the average of the centroids of every simplex it belongs to, the point itself counting as one sample.
+	 * Simplices are packed Stride vertex indices at a time.
+	 */
+	PCGEXTENDEDTOOLKIT_API
+	void GetAverageSiteCentroids(const TArrayView<FVector>& Positions, const TConstArrayView<int32> Simplices, const int32 Stride, TArray<FVector>& OutAverages);
 }
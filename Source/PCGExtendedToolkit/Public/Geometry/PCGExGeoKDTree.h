@@ -0,0 +1,263 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExGeo
+{
+	/**
+	 * Static kd-tree over a point cloud, built once and queried with best-first traversal.
+	 * Every node keeps the tight bounds of its items, so the same tree answers nearest, k-nearest and farthest queries.
+	 * Positions are stored leaf-contiguous; queries report the index the item had in the array the tree was built from.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FKDTree : public TSharedFromThis<FKDTree>
+	{
+	public:
+		static constexpr int32 LeafSize = 8;
+
+		struct FNode
+		{
+			FBox Bounds = FBox(ForceInit);
+			int32 Start = 0;
+			int32 Count = 0;
+			int32 Left = -1;
+			int32 Right = -1;
+
+			FORCEINLINE bool IsLeaf() const { return Left == -1; }
+		};
+
+		struct FHit
+		{
+			int32 Item = -1;
+			double DistSquared = 0;
+
+			FHit() = default;
+
+			FHit(const int32 InItem, const double InDistSquared)
+				: Item(InItem), DistSquared(InDistSquared)
+			{
+			}
+		};
+
+		FKDTree() = default;
+
+		void Build(const TArray<FVector>& InPositions);
+
+		FORCEINLINE int32 Num() const { return Positions.Num(); }
+		FORCEINLINE bool IsEmpty() const { return Positions.IsEmpty(); }
+		FORCEINLINE const FBox& GetBounds() const { return Nodes[0].Bounds; }
+
+		/** Closest accepted item whose squared distance lies within [MinDistSquared, MaxDistSquared] */
+		template <typename FilterFunc>
+		bool FindNearest(const FVector& Center, FHit& OutHit, FilterFunc&& Filter, const double MinDistSquared = 0, const double MaxDistSquared = MAX_dbl) const
+		{
+			if (Nodes.IsEmpty()) { return false; }
+
+			bool bFound = false;
+			double Best = MaxDistSquared;
+
+			TArray<FHit, TInlineAllocator<64>> Queue;
+			Queue.HeapPush(FHit(0, Nodes[0].Bounds.ComputeSquaredDistanceToPoint(Center)), FCloserFirst());
+
+			while (!Queue.IsEmpty())
+			{
+				FHit Next;
+				Queue.HeapPop(Next, FCloserFirst(), EAllowShrinking::No);
+				if (Next.DistSquared > Best) { break; } // Every remaining node is further away
+
+				const FNode& Node = Nodes[Next.Item];
+
+				if (Node.IsLeaf())
+				{
+					for (int i = Node.Start; i < Node.Start + Node.Count; i++)
+					{
+						const double Dist = FVector::DistSquared(Positions[i], Center);
+						if (Dist < MinDistSquared || (bFound ? Dist >= Best : Dist > Best)) { continue; }
+						if (!Filter(Items[i])) { continue; }
+
+						OutHit = FHit(Items[i], Dist);
+						Best = Dist;
+						bFound = true;
+					}
+
+					continue;
+				}
+
+				PushIfCloser(Queue, Node.Left, Center, Best);
+				PushIfCloser(Queue, Node.Right, Center, Best);
+			}
+
+			return bFound;
+		}
+
+		/** Farthest accepted item whose squared distance lies within [MinDistSquared, MaxDistSquared] */
+		template <typename FilterFunc>
+		bool FindFarthest(const FVector& Center, FHit& OutHit, FilterFunc&& Filter, const double MinDistSquared = 0, const double MaxDistSquared = MAX_dbl) const
+		{
+			if (Nodes.IsEmpty()) { return false; }
+
+			bool bFound = false;
+			double Best = MinDistSquared;
+
+			TArray<FHit, TInlineAllocator<64>> Queue;
+			Queue.HeapPush(FHit(0, GetMaxDistSquared(Nodes[0].Bounds, Center)), FFartherFirst());
+
+			while (!Queue.IsEmpty())
+			{
+				FHit Next;
+				Queue.HeapPop(Next, FFartherFirst(), EAllowShrinking::No);
+				if (Next.DistSquared < Best) { break; } // Every remaining node is closer
+
+				const FNode& Node = Nodes[Next.Item];
+
+				if (Node.IsLeaf())
+				{
+					for (int i = Node.Start; i < Node.Start + Node.Count; i++)
+					{
+						const double Dist = FVector::DistSquared(Positions[i], Center);
+						if (Dist > MaxDistSquared || (bFound ? Dist <= Best : Dist < Best)) { continue; }
+						if (!Filter(Items[i])) { continue; }
+
+						OutHit = FHit(Items[i], Dist);
+						Best = Dist;
+						bFound = true;
+					}
+
+					continue;
+				}
+
+				PushIfFarther(Queue, Node.Left, Center, Best, MaxDistSquared);
+				PushIfFarther(Queue, Node.Right, Center, Best, MaxDistSquared);
+			}
+
+			return bFound;
+		}
+
+		/** Up to K closest accepted items within MaxDistSquared, sorted closest first */
+		template <typename FilterFunc>
+		int32 FindKNearest(const FVector& Center, const int32 K, TArray<FHit>& OutHits, FilterFunc&& Filter, const double MaxDistSquared = MAX_dbl) const
+		{
+			OutHits.Reset();
+			if (Nodes.IsEmpty() || K <= 0) { return 0; }
+
+			OutHits.Reserve(K);
+
+			// OutHits is kept as a max-heap while searching, so the current K-th distance is always on top
+			auto GetBound = [&]() { return OutHits.Num() < K ? MaxDistSquared : OutHits.HeapTop().DistSquared; };
+
+			TArray<FHit, TInlineAllocator<64>> Queue;
+			Queue.HeapPush(FHit(0, Nodes[0].Bounds.ComputeSquaredDistanceToPoint(Center)), FCloserFirst());
+
+			while (!Queue.IsEmpty())
+			{
+				FHit Next;
+				Queue.HeapPop(Next, FCloserFirst(), EAllowShrinking::No);
+				if (Next.DistSquared > GetBound()) { break; }
+
+				const FNode& Node = Nodes[Next.Item];
+
+				if (Node.IsLeaf())
+				{
+					for (int i = Node.Start; i < Node.Start + Node.Count; i++)
+					{
+						const double Dist = FVector::DistSquared(Positions[i], Center);
+						if (Dist > GetBound() || (OutHits.Num() == K && Dist == GetBound())) { continue; }
+						if (!Filter(Items[i])) { continue; }
+
+						if (OutHits.Num() == K)
+						{
+							FHit Discard;
+							OutHits.HeapPop(Discard, FFartherFirst(), EAllowShrinking::No);
+						}
+
+						OutHits.HeapPush(FHit(Items[i], Dist), FFartherFirst());
+					}
+
+					continue;
+				}
+
+				const double Bound = GetBound();
+				PushIfCloser(Queue, Node.Left, Center, Bound);
+				PushIfCloser(Queue, Node.Right, Center, Bound);
+			}
+
+			OutHits.Sort(FCloserFirst());
+			return OutHits.Num();
+		}
+
+		/** Invoke Func(Item, DistSquared) for every item whose squared distance lies within [MinDistSquared, MaxDistSquared] */
+		template <typename Func>
+		void ForEachInRange(const FVector& Center, const double MinDistSquared, const double MaxDistSquared, Func&& Callback) const
+		{
+			if (Nodes.IsEmpty()) { return; }
+
+			TArray<int32, TInlineAllocator<64>> Stack;
+			Stack.Add(0);
+
+			while (!Stack.IsEmpty())
+			{
+				const FNode& Node = Nodes[Stack.Pop(EAllowShrinking::No)];
+				if (Node.Bounds.ComputeSquaredDistanceToPoint(Center) > MaxDistSquared) { continue; }
+				if (GetMaxDistSquared(Node.Bounds, Center) < MinDistSquared) { continue; }
+
+				if (Node.IsLeaf())
+				{
+					for (int i = Node.Start; i < Node.Start + Node.Count; i++)
+					{
+						const double Dist = FVector::DistSquared(Positions[i], Center);
+						if (Dist < MinDistSquared || Dist > MaxDistSquared) { continue; }
+						Callback(Items[i], Dist);
+					}
+
+					continue;
+				}
+
+				Stack.Add(Node.Right);
+				Stack.Add(Node.Left);
+			}
+		}
+
+	protected:
+		TArray<FVector> Positions;
+		TArray<int32> Items;
+		TArray<FNode> Nodes;
+
+		struct FCloserFirst
+		{
+			FORCEINLINE bool operator()(const FHit& A, const FHit& B) const { return A.DistSquared < B.DistSquared; }
+		};
+
+		struct FFartherFirst
+		{
+			FORCEINLINE bool operator()(const FHit& A, const FHit& B) const { return A.DistSquared > B.DistSquared; }
+		};
+
+		FORCEINLINE static double GetMaxDistSquared(const FBox& Box, const FVector& Center)
+		{
+			const FVector A = (Center - Box.Min).GetAbs();
+			const FVector B = (Center - Box.Max).GetAbs();
+			return FVector(FMath::Max(A.X, B.X), FMath::Max(A.Y, B.Y), FMath::Max(A.Z, B.Z)).SizeSquared();
+		}
+
+		template <typename QueueType>
+		FORCEINLINE void PushIfCloser(QueueType& Queue, const int32 NodeIndex, const FVector& Center, const double Bound) const
+		{
+			const double Dist = Nodes[NodeIndex].Bounds.ComputeSquaredDistanceToPoint(Center);
+			if (Dist <= Bound) { Queue.HeapPush(FHit(NodeIndex, Dist), FCloserFirst()); }
+		}
+
+		template <typename QueueType>
+		FORCEINLINE void PushIfFarther(QueueType& Queue, const int32 NodeIndex, const FVector& Center, const double Bound, const double MaxDistSquared) const
+		{
+			const FNode& Node = Nodes[NodeIndex];
+			if (Node.Bounds.ComputeSquaredDistanceToPoint(Center) > MaxDistSquared) { return; }
+
+			const double Dist = GetMaxDistSquared(Node.Bounds, Center);
+			if (Dist >= Bound) { Queue.HeapPush(FHit(NodeIndex, Dist), FFartherFirst()); }
+		}
+
+		int32 BuildNode(const TArray<FVector>& InPositions, const int32 Start, const int32 Count);
+	};
+}
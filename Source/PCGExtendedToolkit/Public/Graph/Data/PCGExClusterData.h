@@ -20,6 +20,11 @@ namespace PCGExCluster
 	class FCluster;
 }
 
+namespace PCGExHeuristics
+{
+	class FLandmarks;
+}
+
 USTRUCT(/*PCG_DataType*/DisplayName="PCGEx | Cluster Part")
 struct FPCGExDataTypeInfoClusterPart : public FPCGDataTypeInfoPoint
 {
@@ -89,11 +94,18 @@ public:
 	virtual void SetBoundCluster(const TSharedPtr<PCGExCluster::FCluster>& InCluster);
 	const TSharedPtr<PCGExCluster::FCluster>& GetBoundCluster() const;
 
+	// Landmark distances are a lazy cache tied to the bound cluster topology, hence usable from const data
+	void SetBoundLandmarks(const TSharedPtr<PCGExHeuristics::FLandmarks>& InLandmarks) const;
+	TSharedPtr<PCGExHeuristics::FLandmarks> GetBoundLandmarks() const;
+
 	virtual void BeginDestroy() override;
 
 protected:
 	TSharedPtr<PCGExCluster::FCluster> Cluster;
 
+	mutable FRWLock LandmarksLock;
+	mutable TSharedPtr<PCGExHeuristics::FLandmarks> Landmarks;
+
 	virtual UPCGSpatialData* CopyInternal(FPCGContext* Context) const override;
 };
 
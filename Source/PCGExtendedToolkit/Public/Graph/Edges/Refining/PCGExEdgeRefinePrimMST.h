@@ -36,7 +36,7 @@ public:
 			const PCGExCluster::FNode& Current = *Cluster->GetNode(CurrentNodeIndex);
 			Visited[CurrentNodeIndex] = true;
 
-			for (const PCGExGraph::FLink Lk : Current.Links)
+			for (const PCGExGraph::FLink Lk : Cluster->GetLinks(CurrentNodeIndex))
 			{
 				const uint32 NeighborIndex = Lk.Node;
 				const uint32 EdgeIndex = Lk.Edge;
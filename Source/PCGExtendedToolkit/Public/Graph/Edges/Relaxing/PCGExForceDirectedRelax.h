@@ -5,8 +5,16 @@
 
 #include "CoreMinimal.h"
 #include "PCGExRelaxClusterOperation.h"
+#include "Geometry/PCGExGeoBarnesHut.h"
 #include "PCGExForceDirectedRelax.generated.h"
 
+UENUM()
+enum class EPCGExForceDirectedRepulsion : uint8
+{
+	Neighbors = 0 UMETA(DisplayName = "Neighbors", ToolTip="Nodes only repulse the nodes they are directly connected to"),
+	Global    = 1 UMETA(DisplayName = "Global", ToolTip="All nodes repulse each other. Approximated with a Barnes-Hut octree rebuilt every iteration."),
+};
+
 /**
  * 
  */
@@ -23,31 +31,88 @@ public:
 		{
 			SpringConstant = TypedOther->SpringConstant;
 			ElectrostaticConstant = TypedOther->ElectrostaticConstant;
+			Repulsion = TypedOther->Repulsion;
+			OpeningAngle = TypedOther->OpeningAngle;
 		}
 	}
 
+	virtual bool PrepareForCluster(FPCGExContext* InContext, const TSharedPtr<PCGExCluster::FCluster>& InCluster) override
+	{
+		if (!Super::PrepareForCluster(InContext, InCluster)) { return false; }
+		if (Repulsion == EPCGExForceDirectedRepulsion::Global) { RepulsionTree = MakeShared<PCGExGeo::FBarnesHutTree>(); }
+		return true;
+	}
+
+	virtual EPCGExClusterElement PrepareNextStep(const int32 InStep) override
+	{
+		const EPCGExClusterElement Source = Super::PrepareNextStep(InStep);
+
+		if (InStep == 0 && RepulsionTree)
+		{
+			// Read buffer now holds the positions of the previous iteration
+			const int32 NumNodes = ReadBuffer->Num();
+			Positions.SetNumUninitialized(NumNodes);
+			for (int i = 0; i < NumNodes; i++) { Positions[i] = (ReadBuffer->GetData() + i)->GetLocation(); }
+			RepulsionTree->Build(Positions);
+		}
+
+		return Source;
+	}
+
 	virtual void Step1(const PCGExCluster::FNode& Node) override
 	{
 		const FVector Position = (ReadBuffer->GetData() + Node.Index)->GetLocation();
 		FVector Force = FVector::ZeroVector;
 
-		for (const PCGExGraph::FLink& Lk : Node.Links)
+		if (RepulsionTree)
+		{
+			for (const PCGExGraph::FLink& Lk : Cluster->GetLinks(Node.Index))
+			{
+				CalculateAttractiveForce(Force, Position, (ReadBuffer->GetData() + Lk.Node)->GetLocation());
+			}
+
+			RepulsionTree->ForEachBody(
+				Position, Node.Index, OpeningAngle,
+				[&](const FVector& OtherPosition, const double Charge) { CalculateRepulsiveForce(Force, Position, OtherPosition, Charge); });
+		}
+		else
 		{
-			const FVector OtherPosition = (ReadBuffer->GetData() + Lk.Node)->GetLocation();
-			CalculateAttractiveForce(Force, Position, OtherPosition);
-			CalculateRepulsiveForce(Force, Position, OtherPosition);
+			for (const PCGExGraph::FLink& Lk : Cluster->GetLinks(Node.Index))
+			{
+				const FVector OtherPosition = (ReadBuffer->GetData() + Lk.Node)->GetLocation();
+				CalculateAttractiveForce(Force, Position, OtherPosition);
+				CalculateRepulsiveForce(Force, Position, OtherPosition);
+			}
 		}
 
 		(*WriteBuffer)[Node.Index].SetLocation(Position + Force);
 	}
 
+	virtual void Cleanup() override
+	{
+		RepulsionTree.Reset();
+		Positions.Empty();
+		Super::Cleanup();
+	}
+
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
 	double SpringConstant = 0.1;
 
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
 	double ElectrostaticConstant = 1000;
 
+	/** Which nodes repulse each other. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
+	EPCGExForceDirectedRepulsion Repulsion = EPCGExForceDirectedRepulsion::Neighbors;
+
+	/** Barnes-Hut opening angle. Groups of nodes that look smaller than this from a node are treated as a single charge. Higher is faster but less accurate, 0 computes every pair. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, EditCondition="Repulsion == EPCGExForceDirectedRepulsion::Global", EditConditionHides, ClampMin=0, UIMin=0, UIMax=2))
+	double OpeningAngle = 0.8;
+
 protected:
+	TSharedPtr<PCGExGeo::FBarnesHutTree> RepulsionTree;
+	TArray<FVector> Positions;
+
 	void CalculateAttractiveForce(FVector& Force, const FVector& A, const FVector& B) const
 	{
 		// Calculate the displacement vector between the nodes
@@ -61,7 +126,7 @@ protected:
 		Force += Displacement * ForceMagnitude;
 	}
 
-	void CalculateRepulsiveForce(FVector& Force, const FVector& A, const FVector& B) const
+	void CalculateRepulsiveForce(FVector& Force, const FVector& A, const FVector& B, const double Charge = 1) const
 	{
 		// Calculate the displacement vector between the nodes
 		FVector Displacement = B - A;
@@ -70,7 +135,7 @@ protected:
 		Displacement /= Distance;
 
 		// Calculate the force magnitude using Coulomb's law
-		const double ForceMagnitude = ElectrostaticConstant / (Distance * Distance);
+		const double ForceMagnitude = ElectrostaticConstant * Charge / (Distance * Distance);
 		Force -= Displacement * ForceMagnitude;
 	}
 };
@@ -1,4 +1,4 @@
-// Copyright 2025 Timothé Lapetite and contributors
+﻿// Copyright 2025 Timothé Lapetite and contributors
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #pragma once
@@ -30,6 +30,11 @@ namespace PCGExSorting
 	class FPointSorter;
 }
 
+namespace PCGExTelemetry
+{
+	class FExecutionTelemetry;
+}
+
 namespace PCGExCluster
 {
 	struct FBoundedEdge;
@@ -121,6 +126,31 @@ namespace PCGExCluster
 		bool operator==(const FBoundedEdge& ExpandedEdge) const { return (Index == ExpandedEdge.Index && Bounds == ExpandedEdge.Bounds); };
 	};
 
+	/**
+	 * Compressed-sparse-row adjacency : a single offsets array and a single packed link array.
+	 * Links of node N live in Links[Offsets[N]..Offsets[N+1]), contiguously, in the same order as FNode::Links.
+	 */
+	struct PCGEXTENDEDTOOLKIT_API FPackedAdjacency
+	{
+		TArray<int32> Offsets;
+		TArray<FLink> Links;
+
+		FPackedAdjacency() = default;
+		~FPackedAdjacency() = default;
+
+		void Build(const TArray<FNode>& InNodes);
+
+		FORCEINLINE int32 NumNodes() const { return Offsets.Num() - 1; }
+		FORCEINLINE int32 Num(const int32 NodeIndex) const { return Offsets[NodeIndex + 1] - Offsets[NodeIndex]; }
+		FORCEINLINE TArrayView<const FLink> Get(const int32 NodeIndex) const
+		{
+			const int32 Start = Offsets[NodeIndex];
+			return TArrayView<const FLink>(Links.GetData() + Start, Offsets[NodeIndex + 1] - Start);
+		}
+
+		SIZE_T GetAllocatedSize() const { return Offsets.GetAllocatedSize() + Links.GetAllocatedSize(); }
+	};
+
 	class PCGEXTENDEDTOOLKIT_API FCluster : public TSharedFromThis<FCluster>
 	{
 	protected:
@@ -131,7 +161,14 @@ namespace PCGExCluster
 
 		mutable FRWLock ClusterLock;
 
+		// Memory this cluster reported to its execution telemetry, released on destruction
+		TSharedPtr<PCGExTelemetry::FExecutionTelemetry> Telemetry;
+		int64 TrackedBytes = 0;
+
 	public:
+		/** Report owned nodes and/or edges memory to the execution telemetry, if any. */
+		void TrackMemory(const bool bNodes, const bool bEdges);
+
 		int32 NumRawVtx = 0;
 		int32 NumRawEdges = 0;
 
@@ -140,6 +177,7 @@ namespace PCGExCluster
 
 		bool bValid = false;
 		bool bIsOneToOne = false; // Whether the input data has a single set of edges for a single set of vtx
+		bool bWantsPackedAdjacency = false; // Whether BuildFrom should also produce the packed adjacency
 
 		int32 ClusterID = -1;
 		TSharedPtr<PCGEx::FIndexLookup> NodeIndexLookup; // Point Index -> Node index
@@ -148,6 +186,7 @@ namespace PCGExCluster
 		TSharedPtr<TArray<FBoundedEdge>> BoundedEdges;
 		TSharedPtr<TArray<FEdge>> Edges;
 		TSharedPtr<TArray<double>> EdgeLengths;
+		TSharedPtr<FPackedAdjacency> PackedAdjacency;
 		TConstPCGValueRange<FTransform> VtxTransforms;
 
 		FBox Bounds = FBox(NoInit);
@@ -224,6 +263,13 @@ namespace PCGExCluster
 		FORCEINLINE FEdge* GetEdge(const int32 Index) const { return (EdgesDataPtr + Index); }
 		FORCEINLINE FEdge* GetEdge(const FLink Lk) const { return (EdgesDataPtr + Lk.Edge); }
 
+		// Traversal-friendly neighbor access; reads from the packed adjacency when available, from the node otherwise.
+		FORCEINLINE TArrayView<const FLink> GetLinks(const int32 NodeIndex) const
+		{
+			if (const FPackedAdjacency* Packed = PackedAdjacency.Get()) { return Packed->Get(NodeIndex); }
+			return TArrayView<const FLink>((NodesDataPtr + NodeIndex)->Links);
+		}
+
 		FORCEINLINE FNode* GetEdgeStart(const FEdge* InEdge) const { return (NodesDataPtr + NodeIndexLookup->Get(InEdge->Start)); }
 		FORCEINLINE FNode* GetEdgeStart(const FEdge& InEdge) const { return (NodesDataPtr + NodeIndexLookup->Get(InEdge.Start)); }
 		FORCEINLINE FNode* GetEdgeStart(const int32 InEdgeIndex) const { return (NodesDataPtr + NodeIndexLookup->Get((EdgesDataPtr + InEdgeIndex)->Start)); }
@@ -311,6 +357,7 @@ namespace PCGExCluster
 		int32 FindClosestNeighborInDirection(const int32 NodeIndex, const FVector& Direction, int32 MinNeighborCount = 1) const;
 
 		TSharedPtr<TArray<FBoundedEdge>> GetBoundedEdges(const bool bBuild);
+		TSharedPtr<FPackedAdjacency> GetPackedAdjacency();
 		void ExpandEdges(PCGExMT::FTaskManager* AsyncManager);
 
 		template <typename T, class MakeFunc>
@@ -0,0 +1,60 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExData
+{
+	class FPointIO;
+}
+
+namespace PCGExCluster
+{
+	class FCluster;
+}
+
+/**
+ * Opt-in on-disk cache of cluster topology, so unchanged clusters don't have to be rebuilt from raw vtx/edges across executions.
+ * Entries are keyed by a content hash of the vtx/edges data the cluster is built from, and stored in a versioned binary format :
+ * header, nodes point indices, CSR adjacency (same layout as FPackedAdjacency), edge endpoints, and optionally bounded edges.
+ * Files are untrusted input and fully validated on load. The folder is capped in size, least recently used files being evicted first.
+ */
+namespace PCGExClusterCache
+{
+	constexpr uint32 Magic = 0x43584350; // PCXC
+	constexpr uint32 Version = 1;
+
+	PCGEXTENDEDTOOLKIT_API
+	bool IsEnabled();
+
+	/** Content hash of what a cluster built from these inputs depends on. Returns 0 if the data isn't a valid cluster. */
+	PCGEXTENDEDTOOLKIT_API
+	uint64 ComputeKey(const TSharedRef<PCGExData::FPointIO>& InVtxIO, const TSharedRef<PCGExData::FPointIO>& InEdgesIO);
+
+	PCGEXTENDEDTOOLKIT_API
+	FString GetCacheDirectory();
+
+	PCGEXTENDEDTOOLKIT_API
+	FString GetCachePath(const uint64 InKey);
+
+	/** Loads a previously saved cluster, if any, through a memory-mapped read. The returned cluster owns its own index lookup. */
+	PCGEXTENDEDTOOLKIT_API
+	TSharedPtr<PCGExCluster::FCluster> TryLoad(
+		const uint64 InKey,
+		const TSharedRef<PCGExData::FPointIO>& InVtxIO, const TSharedRef<PCGExData::FPointIO>& InEdgesIO,
+		const bool bWantsPackedAdjacency);
+
+	/** Serializes the cluster right away, and writes it to disk asynchronously. Does nothing if that key was already saved. */
+	PCGEXTENDEDTOOLKIT_API
+	void Save(const uint64 InKey, const TSharedRef<PCGExCluster::FCluster>& InCluster);
+
+	/** Evicts least recently used cache files until the folder fits within MaxBytes. */
+	PCGEXTENDEDTOOLKIT_API
+	void Trim(const int64 MaxBytes);
+
+	/** Deletes every cache file. Also available as the pcgex.ClusterCache.Clear console command. */
+	PCGEXTENDEDTOOLKIT_API
+	void Clear();
+}
@@ -19,12 +19,32 @@ namespace PCGExMT
 	class TScopedArray;
 }
 
+namespace PCGExSearch
+{
+	class FScoredQueue;
+}
+
 UENUM()
 enum class EPCGExCentralityDownsampling : uint8
 {
 	None    = 0 UMETA(DisplayName = "None", ToolTip="All connected filters must pass."),
 	Ratio   = 1 UMETA(DisplayName = "Random ratio", ToolTip="Sample using a random subset of the nodes."),
-	Filters = 2 UMETA(DisplayName = "Filters", ToolTip="Use filters to drive which nodes are added to the subset")
+	Filters = 2 UMETA(DisplayName = "Filters", ToolTip="Use filters to drive which nodes are added to the subset"),
+	Pivots  = 3 UMETA(DisplayName = "Sampled pivots", ToolTip="Approximate centrality from a limited number of source nodes, picked with a fixed seed. Scales to very large clusters.")
+};
+
+UENUM()
+enum class EPCGExCentralityPivotPicking : uint8
+{
+	Uniform = 0 UMETA(DisplayName = "Uniform", ToolTip="Every node is equally likely to be picked as a source."),
+	Degree  = 1 UMETA(DisplayName = "Degree-weighted", ToolTip="Nodes are picked proportionally to their number of neighbors, which favors junctions.")
+};
+
+UENUM()
+enum class EPCGExCentralityPivotCount : uint8
+{
+	Fixed      = 0 UMETA(DisplayName = "Fixed", ToolTip="Use a fixed number of sources."),
+	ErrorBound = 1 UMETA(DisplayName = "Error bound", ToolTip="Use as many sources as required to stay within an error bound.")
 };
 
 /**
@@ -72,6 +92,30 @@ public:
 	/** If enabled, only compute centrality on a subset of the nodes to get a rough approximation. This is useful for large clusters, or if you want to tradeoff precision for speed. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, DisplayName=" └─ Ratio", EditCondition="DownsamplingMode == EPCGExCentralityDownsampling::Ratio", EditConditionHides))
 	FPCGExRandomRatioDetails RandomDownsampling = FPCGExRandomRatioDetails(0.1);
+
+	/** How source nodes are picked. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_NotOverridable, DisplayName=" └─ Picking", EditCondition="DownsamplingMode == EPCGExCentralityDownsampling::Pivots", EditConditionHides))
+	EPCGExCentralityPivotPicking PivotPicking = EPCGExCentralityPivotPicking::Uniform;
+
+	/** How the number of source nodes is chosen. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_NotOverridable, DisplayName=" └─ Count", EditCondition="DownsamplingMode == EPCGExCentralityDownsampling::Pivots", EditConditionHides))
+	EPCGExCentralityPivotCount PivotCount = EPCGExCentralityPivotCount::Fixed;
+
+	/** Number of source nodes. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, DisplayName=" └─ Num Pivots", EditCondition="DownsamplingMode == EPCGExCentralityDownsampling::Pivots && PivotCount == EPCGExCentralityPivotCount::Fixed", EditConditionHides, ClampMin=1))
+	int32 NumPivots = 256;
+
+	/** Maximum error on each node's centrality, relative to the number of node pairs in the cluster. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, DisplayName=" └─ Max Error", EditCondition="DownsamplingMode == EPCGExCentralityDownsampling::Pivots && PivotCount == EPCGExCentralityPivotCount::ErrorBound", EditConditionHides, ClampMin=0.001, ClampMax=1))
+	double MaxError = 0.02;
+
+	/** Probability that every node stays within the max error. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, DisplayName=" └─ Confidence", EditCondition="DownsamplingMode == EPCGExCentralityDownsampling::Pivots && PivotCount == EPCGExCentralityPivotCount::ErrorBound", EditConditionHides, ClampMin=0.01, ClampMax=0.999))
+	double Confidence = 0.9;
+
+	/** Seed used to pick source nodes. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, DisplayName=" └─ Seed", EditCondition="DownsamplingMode == EPCGExCentralityDownsampling::Pivots", EditConditionHides))
+	int32 PivotSeed = 42;
 };
 
 struct FPCGExClusterCentralityContext final : FPCGExEdgesProcessorContext
@@ -97,6 +141,19 @@ namespace PCGExClusterCentrality
 {
 	using NodePred = TArray<int32, TInlineAllocator<8>>;
 
+	/** Brandes search state for one worker. Arrays are sized to the cluster once, and each pass only resets the nodes it reached. */
+	struct FBrandesScratch
+	{
+		TArray<double> Score;
+		TArray<double> Sigma;
+		TArray<double> Delta;
+		TArray<NodePred> Pred;
+		TArray<int32> Stack;
+		TSharedPtr<PCGExSearch::FScoredQueue> Queue;
+
+		explicit FBrandesScratch(const int32 NumNodes);
+	};
+
 	class FProcessor final : public PCGExClusterMT::TProcessor<FPCGExClusterCentralityContext, UPCGExClusterCentralitySettings>
 	{
 		friend class FBatch;
@@ -109,10 +166,18 @@ namespace PCGExClusterCentrality
 		bool bEdgeComplete = false;
 
 		TArray<int32> RandomSamples;
+		TArray<double> SampleWeights; // Contribution weight of each source, so the sampled sum estimates the full one
 		TArray<double> DirectedEdgeScores;
 		TArray<double> Betweenness;
+
+		// Per-scope accumulation, reduced in scope order so the sum doesn't depend on scheduling
 		TSharedPtr<PCGExMT::TScopedArray<double>> ScopedBetweenness;
 
+		// One search scratch per concurrently running worker
+		FRWLock ScratchLock;
+		TArray<TSharedPtr<FBrandesScratch>> Scratches;
+		TArray<TSharedPtr<FBrandesScratch>> AvailableScratches;
+
 	public:
 		FProcessor(const TSharedRef<PCGExData::FFacade>& InVtxDataFacade, const TSharedRef<PCGExData::FFacade>& InEdgeDataFacade):
 			TProcessor(InVtxDataFacade, InEdgeDataFacade)
@@ -129,17 +194,18 @@ namespace PCGExClusterCentrality
 		virtual void ProcessNodes(const PCGExMT::FScope& Scope) override;
 		virtual void OnNodesProcessingComplete() override;
 
+		void PickPivots();
 		void TryStartCompute();
 
 		virtual void PrepareLoopScopesForRanges(const TArray<PCGExMT::FScope>& Loops) override;
 		virtual void ProcessRange(const PCGExMT::FScope& Scope) override;
 		virtual void OnRangeProcessingComplete() override;
 
-		void ProcessSingleNode(
-			const int32 Index,
-			TArray<double>& LocalBetweenness, TArray<double>& Score,
-			TArray<double>& Sigma, TArray<double>& Delta, TArray<NodePred>& Pred,
-			TArray<int32>& Stack, const TSharedPtr<PCGExSearch::FScoredQueue>& Queue);
+		void ProcessSingleNode(const int32 Index, const double Weight, TArray<double>& LocalBetweenness, FBrandesScratch& Scratch);
+
+	protected:
+		TSharedPtr<FBrandesScratch> AcquireScratch();
+		void ReleaseScratch(const TSharedPtr<FBrandesScratch>& InScratch);
 	};
 
 	class FBatch final : public PCGExClusterMT::TBatch<FProcessor>
@@ -122,6 +122,7 @@ namespace PCGExClusterMT
 
 		bool bIsTrivial = false;
 		bool bIsOneToOne = false;
+		bool bWantsPackedAdjacency = false;
 
 		int32 BatchIndex = -1;
 
@@ -261,6 +262,7 @@ namespace PCGExClusterMT
 		bool bSkipCompletion = false;
 		bool bRequiresWriteStep = false;
 		bool bWriteVtxDataFacade = false;
+		bool bWantsPackedAdjacency = false; // Processors' clusters will carry a packed (CSR) adjacency for traversal-heavy work
 		EPCGPointNativeProperties AllocateVtxProperties = EPCGPointNativeProperties::None;
 
 		TArray<TSharedPtr<PCGExData::FPointIO>> Edges;
@@ -0,0 +1,92 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExGraph
+{
+	/**
+	 * Insert-only open-addressing uint64 -> int32 map, tailored for edge hash deduplication.
+	 * Slots are probed linearly by groups of 8; each slot has a control byte holding 7 bits of the hash
+	 * so a whole group can be matched at once (SWAR) before any key comparison.
+	 * The map is split into shards picked from the hash high bits, which allows bulk insertion to run one shard per worker.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FEdgeHashMap
+	{
+	public:
+		static constexpr int32 GroupWidth = 8;
+
+		FEdgeHashMap() { Shards.SetNum(1); }
+
+		FORCEINLINE int32 Num() const { return NumItems; }
+		FORCEINLINE bool IsEmpty() const { return NumItems == 0; }
+
+		/** Make room for a total of InNum items. First non-empty reserve also picks the shard count. */
+		void Reserve(const int32 InNum);
+		void Empty();
+
+		FORCEINLINE int32* Find(const uint64 Key)
+		{
+			const uint64 H = Mix(Key);
+			return Shards[GetShardIndex(H)].Find(Key, H);
+		}
+
+		FORCEINLINE const int32* Find(const uint64 Key) const
+		{
+			const uint64 H = Mix(Key);
+			return Shards[GetShardIndex(H)].Find(Key, H);
+		}
+
+		FORCEINLINE bool Contains(const uint64 Key) const { return Find(Key) != nullptr; }
+
+		/** Returns the value associated with Key, inserting InValue if Key is not already in the map */
+		int32& FindOrAdd(const uint64 Key, const int32 InValue, bool& bOutIsNew);
+		void Add(const uint64 Key, const int32 InValue);
+
+		/**
+		 * Insert a batch of keys, running one shard per worker.
+		 * Keys that aren't in the map yet (and first occurrences of duplicates within the batch) are assigned
+		 * consecutive values starting at InFirstValue, in batch order.
+		 * @param OutNewKeys Batch indices of the inserted keys, in batch order
+		 * @return Number of inserted keys
+		 */
+		int32 InsertUnique(TArrayView<const uint64> InKeys, const int32 InFirstValue, TArray<int32>& OutNewKeys);
+
+	protected:
+		struct FShard
+		{
+			TArray<uint8> Ctrl;
+			TArray<uint64> Keys;
+			TArray<int32> Values;
+			int32 Num = 0;
+			int32 GroupMask = -1;
+
+			FORCEINLINE int32 Capacity() const { return Ctrl.Num(); }
+			FORCEINLINE int32 GetGrowthThreshold() const { return Capacity() - (Capacity() >> 3); } // 7/8 max load
+
+			int32* Find(const uint64 Key, const uint64 H);
+
+			FORCEINLINE const int32* Find(const uint64 Key, const uint64 H) const { return const_cast<FShard*>(this)->Find(Key, H); }
+
+			/** Returns the slot holding Key, inserting it if needed. Does not grow. */
+			int32 FindOrAddSlot(const uint64 Key, const uint64 H, const int32 InValue, bool& bOutIsNew);
+
+			void Reserve(const int32 InNum);
+			void Rehash(const int32 InCapacity);
+		};
+
+		TArray<FShard> Shards;
+		int32 ShardBits = 0;
+		int32 NumItems = 0;
+
+		FORCEINLINE static uint64 Mix(const uint64 Key)
+		{
+			uint64 H = Key * 0x9E3779B97F4A7C15ull;
+			return H ^ (H >> 29);
+		}
+
+		FORCEINLINE int32 GetShardIndex(const uint64 H) const { return ShardBits ? static_cast<int32>(H >> (64 - ShardBits)) : 0; }
+	};
+}
@@ -8,6 +8,7 @@
 #include "CoreMinimal.h"
 #include "PCGEx.h"
 #include "PCGExEdge.h"
+#include "PCGExEdgeHashMap.h"
 #include "PCGExMT.h"
 #include "Details/PCGExDetailsAxis.h"
 #include "Utils/PCGValueRange.h"
@@ -423,7 +424,7 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 		TSharedPtr<PCGExData::FUnionMetadata> EdgesUnion;
 		TMap<int32, FGraphEdgeMetadata> EdgeMetadata;
 
-		TMap<uint64, int32> UniqueEdges;
+		FEdgeHashMap UniqueEdges;
 
 		TArray<TSharedRef<FSubGraph>> SubGraphs;
 		TSharedPtr<PCGEx::FIndexLookup> NodeIndexLookup;
@@ -448,6 +449,11 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 		void InsertEdges(const TArray<uint64>& InEdges, int32 InIOIndex);
 		int32 InsertEdges(const TArray<FEdge>& InEdges);
 
+	protected:
+		void InsertEdgeHashes_Unsafe(const TArray<uint64>& InEdges, int32 InIOIndex);
+
+	public:
+
 		FEdge* FindEdge_Unsafe(const uint64 Hash);
 		FEdge* FindEdge_Unsafe(const int32 A, const int32 B);
 		FEdge* FindEdge(const uint64 Hash);
@@ -9,6 +9,7 @@
 #include "PCGExOctree.h"
 #include "Data/PCGExDataForward.h"
 #include "Data/PCGExPointElements.h"
+#include "Data/PCGExUnionData.h"
 #include "Graph/PCGExEdge.h"
 #include "Details/PCGExDetailsFusing.h"
 
@@ -32,7 +33,6 @@ namespace PCGExData
 {
 	class FPointIOCollection;
 	class FUnionMetadata;
-	class IUnionData;
 }
 
 enum class EPCGExCutType : uint8;
@@ -130,47 +130,70 @@ namespace PCGExGraph
 
 #pragma region Compound Graph
 
-	class PCGEXTENDEDTOOLKIT_API FUnionNode : public TSharedFromThis<FUnionNode>
+	class PCGEXTENDEDTOOLKIT_API FUnionNode
 	{
-	protected:
-		mutable FRWLock AdjacencyLock;
-
 	public:
 		const PCGExData::FConstPoint Point;
 		FVector Center;
 		FBoxSphereBounds Bounds;
 		int32 Index;
 
-		TSet<int32, DefaultKeyFuncs<int32>, InlineSparseAllocator> Adjacency;
-
 		FUnionNode(const PCGExData::FConstPoint& InPoint, const FVector& InCenter, const int32 InIndex);
 		~FUnionNode() = default;
 
 		FVector UpdateCenter(const TSharedPtr<PCGExData::FUnionMetadata>& InUnionMetadata, const TSharedPtr<PCGExData::FPointIOCollection>& IOGroup);
+	};
 
-		void Add(const int32 InAdjacency);
+	// Union insertion is spread over independently locked shards, picked from the grid key (nodes) or the edge hash (edges)
+	constexpr int32 UnionShardBits = 6;
+	constexpr int32 NumUnionShards = 1 << UnionShardBits;
+
+	FORCEINLINE static int32 GetUnionShard(const uint64 Key) { return static_cast<int32>((Key * 0x9E3779B97F4A7C15ull) >> (64 - UnionShardBits)); }
+
+	struct PCGEXTENDEDTOOLKIT_API FUnionNodeShard
+	{
+		mutable FRWLock Lock;
+		TMap<uint64, int32> Cells; // Grid key -> local index
+		TArray<int32> Indices;     // Local index -> node index
+		TArray<PCGExData::FConstPoint> Points;
+		TArray<PCGExData::FUnionElement> Elements; // Union members, tagged with their node index
+
+		void Reserve(const int32 InReserve);
+		void Empty();
 	};
 
-	PCGEX_OCTREE_SEMANTICS(FUnionNode, { return Element->Bounds;}, { return A->Index == B->Index; })
+	struct PCGEXTENDEDTOOLKIT_API FUnionEdgeShard
+	{
+		mutable FRWLock Lock;
+		TMap<uint64, int32> Lookup; // Edge hash -> local index
+		TArray<FEdge> Edges;
+		TArray<int32> UnionSizes;                  // Local index -> union size
+		TArray<PCGExData::FUnionElement> Elements; // Union members, tagged with their edge index
+
+		void Reserve(const int32 InReserve);
+		void Empty();
+	};
 
 	class PCGEXTENDEDTOOLKIT_API FUnionGraph : public TSharedFromThis<FUnionGraph>
 	{
 	public:
-		TMap<uint64, TSharedPtr<FUnionNode>> GridTree;
+		TArray<FUnionNodeShard> NodeShards;
+		TArray<FUnionEdgeShard> EdgeShards;
 
 		TSharedPtr<PCGExData::FUnionMetadata> NodesUnion;
 		TSharedPtr<PCGExData::FUnionMetadata> EdgesUnion;
-		TArray<TSharedPtr<FUnionNode>> Nodes;
-		TMap<uint64, FEdge> Edges;
+
+		// Flat node & edge pools, indexed by node/edge index. Only complete once MergeShards has been called.
+		TArray<FUnionNode> Nodes;
+		TArray<FEdge> Edges;
 
 		FPCGExFuseDetails FuseDetails;
 
 		FBox Bounds;
 
-		TUniquePtr<FUnionNodeOctree> Octree;
+		TUniquePtr<PCGExOctree::FItemOctree> Octree;
 
 		mutable FRWLock UnionLock;
-		mutable FRWLock EdgesLock;
 
 		explicit FUnionGraph(const FPCGExFuseDetails& InFuseDetails, const FBox& InBounds);
 
@@ -184,14 +207,28 @@ namespace PCGExGraph
 		int32 NumNodes() const;
 		int32 NumEdges() const;
 
-		TSharedPtr<FUnionNode> InsertPoint(const PCGExData::FConstPoint& Point);
-		TSharedPtr<FUnionNode> InsertPoint_Unsafe(const PCGExData::FConstPoint& Point);
-		TSharedPtr<PCGExData::IUnionData> InsertEdge(const PCGExData::FConstPoint& From, const PCGExData::FConstPoint& To, const PCGExData::FConstPoint& Edge = PCGExData::NONE_ConstPoint);
-		TSharedPtr<PCGExData::IUnionData> InsertEdge_Unsafe(const PCGExData::FConstPoint& From, const PCGExData::FConstPoint& To, const PCGExData::FConstPoint& Edge = PCGExData::NONE_ConstPoint);
+		/** Returns the index of the node the point was fused into */
+		int32 InsertPoint(const PCGExData::FConstPoint& Point);
+		int32 InsertPoint_Unsafe(const PCGExData::FConstPoint& Point);
+		/** Returns the index of the edge, or -1 if both endpoints were fused together */
+		int32 InsertEdge(const PCGExData::FConstPoint& From, const PCGExData::FConstPoint& To, const PCGExData::FConstPoint& Edge = PCGExData::NONE_ConstPoint);
+		int32 InsertEdge_Unsafe(const PCGExData::FConstPoint& From, const PCGExData::FConstPoint& To, const PCGExData::FConstPoint& Edge = PCGExData::NONE_ConstPoint);
+
+		/** Scatter shard content into the flat node & edge pools. Must be called once all insertions are complete. */
+		void MergeShards();
+
 		void GetUniqueEdges(TSet<uint64>& OutEdges);
 		void GetUniqueEdges(TArray<FEdge>& OutEdges);
 		void WriteNodeMetadata(const TSharedPtr<FGraph>& InGraph) const;
 		void WriteEdgeMetadata(const TSharedPtr<FGraph>& InGraph) const;
+
+	protected:
+		int32 NodeCount = 0;
+		int32 EdgeCount = 0;
+		bool bShardsMerged = false;
+
+		int32 InsertPointOctree(const PCGExData::FConstPoint& Point, const FVector& Origin);
+		int32 InsertEdgeInShard_Unsafe(FUnionEdgeShard& Shard, const uint64 H, const int32 StartIndex, const int32 EndIndex, const PCGExData::FConstPoint& Edge, const bool bAtomic);
 	};
 
 #pragma endregion
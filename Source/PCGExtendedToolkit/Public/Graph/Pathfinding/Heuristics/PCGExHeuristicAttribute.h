@@ -78,6 +78,8 @@ public:
 		const PCGExCluster::FNode& Goal,
 		const TSharedPtr<PCGEx::FHashLookup> TravelStack) const override;
 
+	virtual bool HasStaticEdgeScore() const override { return true; }
+
 	EPCGExClusterElement Source = EPCGExClusterElement::Vtx;
 	FPCGAttributePropertyInputSelector Attribute;
 	EPCGExAttributeHeuristicInputMode Mode = EPCGExAttributeHeuristicInputMode::AutoCurve;
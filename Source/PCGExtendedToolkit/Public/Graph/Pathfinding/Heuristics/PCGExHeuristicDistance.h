@@ -45,6 +45,8 @@ public:
 		const PCGExCluster::FNode& Goal,
 		const TSharedPtr<PCGEx::FHashLookup> TravelStack) const override;
 
+	virtual bool HasStaticEdgeScore() const override { return true; }
+
 protected:
 	double BoundsSize = 0;
 };
@@ -0,0 +1,139 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Graph/PCGExCluster.h"
+#include "UObject/Object.h"
+#include "PCGExHeuristicOperation.h"
+#include "PCGExHeuristicsFactoryProvider.h"
+
+
+#include "PCGExHeuristicLandmarks.generated.h"
+
+USTRUCT(BlueprintType)
+struct FPCGExHeuristicConfigLandmarks : public FPCGExHeuristicConfigBase
+{
+	GENERATED_BODY()
+
+	FPCGExHeuristicConfigLandmarks() :
+		FPCGExHeuristicConfigBase()
+	{
+	}
+
+	/** Number of landmarks picked per cluster. More landmarks give tighter estimates at the cost of memory (one distance per landmark per node) and a longer one-time preparation. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, ClampMin=1, ClampMax=64))
+	int32 NumLandmarks = 8;
+};
+
+namespace PCGExHeuristics
+{
+	/**
+	 * Shortest path lengths from a handful of landmark nodes to every node of a cluster.
+	 * Landmarks are picked using farthest-point selection; distances are stored landmark-major.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FLandmarks : public TSharedFromThis<FLandmarks>
+	{
+	public:
+		FLandmarks() = default;
+
+		TArray<int32> Landmarks;
+		TArray<double> Distances;
+
+		int32 NumRequested = 0;
+		int32 NumNodes = 0;
+		int32 NumEdges = 0;
+		uint64 PositionsHash = 0; // Distances are only valid for the vtx positions they were computed from
+		double MaxDistance = 0;
+
+		bool Build(const PCGExCluster::FCluster* InCluster, const int32 InNumLandmarks);
+		bool IsValidFor(const PCGExCluster::FCluster* InCluster, const int32 InNumLandmarks) const;
+
+		/** Triangle-inequality lower bound of the shortest path length between A and B */
+		FORCEINLINE double GetLowerBound(const int32 A, const int32 B) const
+		{
+			double Bound = 0;
+			const double* Row = Distances.GetData();
+			for (int i = 0; i < Landmarks.Num(); i++, Row += NumNodes)
+			{
+				const double DA = Row[A];
+				const double DB = Row[B];
+				if (DA == MAX_dbl || DB == MAX_dbl) { continue; } // Unreachable from this landmark
+				Bound = FMath::Max(Bound, FMath::Abs(DA - DB));
+			}
+			return Bound;
+		}
+	};
+}
+
+/**
+ *
+ */
+class FPCGExHeuristicLandmarks : public FPCGExHeuristicOperation
+{
+public:
+	int32 NumLandmarks = 8;
+
+	virtual void PrepareForCluster(const TSharedPtr<const PCGExCluster::FCluster>& InCluster) override;
+
+	virtual double GetGlobalScore(
+		const PCGExCluster::FNode& From,
+		const PCGExCluster::FNode& Seed,
+		const PCGExCluster::FNode& Goal) const override;
+
+
+	virtual double GetEdgeScore(
+		const PCGExCluster::FNode& From,
+		const PCGExCluster::FNode& To,
+		const PCGExGraph::FEdge& Edge,
+		const PCGExCluster::FNode& Seed,
+		const PCGExCluster::FNode& Goal,
+		const TSharedPtr<PCGEx::FHashLookup> TravelStack) const override;
+
+	virtual bool HasStaticEdgeScore() const override { return true; }
+
+protected:
+	TSharedPtr<PCGExHeuristics::FLandmarks> Landmarks;
+	double BoundsSize = 0;
+};
+
+////
+
+UCLASS(MinimalAPI, BlueprintType, ClassGroup = (Procedural), Category="PCGEx|Data")
+class UPCGExHeuristicsFactoryLandmarks : public UPCGExHeuristicsFactoryData
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	FPCGExHeuristicConfigLandmarks Config;
+
+	virtual TSharedPtr<FPCGExHeuristicOperation> CreateOperation(FPCGExContext* InContext) const override;
+	PCGEX_HEURISTIC_FACTORY_BOILERPLATE
+};
+
+UCLASS(MinimalAPI, BlueprintType, ClassGroup = (Procedural), Category="PCGEx|Graph|Params", meta=(PCGExNodeLibraryDoc="pathfinding/heuristics/hx-landmarks"))
+class UPCGExHeuristicsLandmarksProviderSettings : public UPCGExHeuristicsFactoryProviderSettings
+{
+	GENERATED_BODY()
+
+public:
+	//~Begin UPCGSettings
+#if WITH_EDITOR
+	PCGEX_NODE_INFOS_CUSTOM_SUBTITLE(
+		HeuristicsLandmarks, "Heuristics : Landmarks", "Shortest distance heuristics with a landmark-based (ALT) global estimate. Landmark distances are computed once and cached alongside the cluster.",
+		FName(GetDisplayName()))
+#endif
+	//~End UPCGSettings
+
+	/** Filter Config.*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, ShowOnlyInnerProperties))
+	FPCGExHeuristicConfigLandmarks Config;
+
+	virtual UPCGExFactoryData* CreateFactory(FPCGExContext* InContext, UPCGExFactoryData* InFactory) const override;
+
+#if WITH_EDITOR
+	virtual FString GetDisplayName() const override;
+#endif
+};
@@ -40,6 +40,8 @@ public:
 		const PCGExCluster::FNode& Seed,
 		const PCGExCluster::FNode& Goal,
 		const TSharedPtr<PCGEx::FHashLookup> TravelStack = nullptr) const override;
+
+	virtual bool HasStaticEdgeScore() const override { return true; }
 };
 
 ////
@@ -47,6 +47,12 @@ public:
 		const TSharedPtr<PCGEx::FHashLookup> TravelStack = nullptr) const;
 
 
+	/** Whether GetEdgeScore only depends on the traversed edge and its direction, in which case it is baked once per cluster. */
+	virtual bool HasStaticEdgeScore() const { return false; }
+
+	/** Whether GetEdgeScore reads the goal node. Goal-dependent scores prevent sharing a single search between queries with the same seed. */
+	virtual bool HasGoalDependentEdgeScore() const { return false; }
+
 	double GetCustomWeightMultiplier(const int32 PointIndex, const int32 EdgeIndex) const;
 
 	FORCEINLINE FVector GetSeedUVW() const { return UVWSeed; }
@@ -62,6 +62,8 @@ public:
 		const PCGExCluster::FNode& Goal,
 		const TSharedPtr<PCGEx::FHashLookup> TravelStack) const override;
 
+	virtual bool HasStaticEdgeScore() const override { return !bAccumulate; }
+
 protected:
 	bool bAccumulate = false;
 	int32 MaxSamples = 1;
@@ -57,6 +57,8 @@ public:
 		const PCGExCluster::FNode& Goal,
 		const TSharedPtr<PCGEx::FHashLookup> TravelStack) const override;
 
+	virtual bool HasStaticEdgeScore() const override { return true; }
+
 protected:
 	TSharedPtr<PCGExTensor::FTensorsHandler> TensorsHandler;
 	FPCGExTensorHandlerDetails TensorHandlerDetails;
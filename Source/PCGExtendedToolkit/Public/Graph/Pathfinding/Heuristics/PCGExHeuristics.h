@@ -85,6 +85,13 @@ namespace PCGExHeuristics
 
 		TSharedPtr<PCGExCluster::FCluster> Cluster;
 
+		// Operations whose edge score can't be baked, owned by Operations
+		TArray<FPCGExHeuristicOperation*> DynamicOperations;
+
+		// Baked edge scores & weights, two entries per edge (one per traversal direction)
+		TArray<double> StaticEdgeScores;
+		TArray<double> StaticEdgeWeights;
+
 		double ReferenceWeight = 1;
 		double TotalStaticWeight = 0;
 		bool bUseDynamicWeight = false;
@@ -94,6 +101,9 @@ namespace PCGExHeuristics
 		bool HasLocalFeedback() const { return !LocalFeedbackFactories.IsEmpty(); };
 		bool HasAnyFeedback() const { return HasGlobalFeedback() || HasLocalFeedback(); };
 
+		/** True if edge scores only depend on the traversal itself, so a single search can answer every goal of a given seed. */
+		bool SupportsSharedSeedQueries() const;
+
 		FHeuristicsHandler(FPCGExContext* InContext, const TSharedPtr<PCGExData::FFacade>& InVtxDataCache, const TSharedPtr<PCGExData::FFacade>& InEdgeDataCache, const TArray<TObjectPtr<const UPCGExHeuristicsFactoryData>>& InFactories);
 		~FHeuristicsHandler();
 
@@ -101,6 +111,11 @@ namespace PCGExHeuristics
 		void PrepareForCluster(const TSharedPtr<PCGExCluster::FCluster>& InCluster);
 		void CompleteClusterPreparation();
 
+		FORCEINLINE static int32 GetDirectedEdgeIndex(const PCGExCluster::FNode& From, const PCGExGraph::FEdge& Edge)
+		{
+			return Edge.Index * 2 + (From.PointIndex == static_cast<int32>(Edge.Start) ? 0 : 1);
+		}
+
 
 		double GetGlobalScore(
 			const PCGExCluster::FNode& From,
@@ -141,6 +156,8 @@ namespace PCGExHeuristics
 		TSharedPtr<FLocalFeedbackHandler> MakeLocalFeedbackHandler(const TSharedPtr<const PCGExCluster::FCluster>& InCluster);
 
 	protected:
+		void BakeStaticEdgeScores(const TArray<FPCGExHeuristicOperation*>& StaticOperations);
+
 		PCGExCluster::FNode* RoamingSeedNode = nullptr;
 		PCGExCluster::FNode* RoamingGoalNode = nullptr;
 	};
@@ -145,8 +145,9 @@ namespace PCGExPathfinding
 	public:
 		FSearchAllocations() = default;
 
-		TBitArray<> Visited;
-		TArray<double> GScore;
+		// Epoch-stamped, so resetting allocations between queries doesn't depend on the cluster size
+		PCGEx::TEpochArray<bool> Visited;
+		PCGEx::TEpochArray<double> GScore;
 		TSharedPtr<PCGEx::FHashLookup> TravelStack;
 		TSharedPtr<PCGExSearch::FScoredQueue> ScoredQueue;
 
@@ -154,6 +155,27 @@ namespace PCGExPathfinding
 		void Reset();
 	};
 
+	/**
+	 * Recycles search allocations between tasks, so that at most one set of allocations
+	 * exists per concurrently running worker instead of one per query.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FSearchAllocationsPool : public TSharedFromThis<FSearchAllocationsPool>
+	{
+	protected:
+		mutable FRWLock PoolLock;
+		TSharedPtr<FPCGExSearchOperation> SearchOperation;
+		TArray<TSharedPtr<FSearchAllocations>> Available;
+		int32 NumCreated = 0;
+
+	public:
+		explicit FSearchAllocationsPool(const TSharedPtr<FPCGExSearchOperation>& InSearchOperation);
+
+		TSharedPtr<FSearchAllocations> Acquire();
+		void Release(const TSharedPtr<FSearchAllocations>& InAllocations);
+
+		int32 GetNumCreated() const;
+	};
+
 	class PCGEXTENDEDTOOLKIT_API FPathQuery : public TSharedFromThis<FPathQuery>
 	{
 	public:
@@ -233,6 +255,17 @@ namespace PCGExPathfinding
 		void Cleanup();
 	};
 
+	/**
+	 * Resolve a group of queries with resolved picks that share the same seed node, using a single search.
+	 * Caller is responsible for checking FHeuristicsHandler::SupportsSharedSeedQueries beforehand.
+	 */
+	PCGEXTENDEDTOOLKIT_API
+	void FindPathsFromSharedSeed(
+		const TArrayView<const TSharedPtr<FPathQuery>> InQueries,
+		const TSharedPtr<FPCGExSearchOperation>& SearchOperation,
+		const TSharedPtr<FSearchAllocations>& Allocations,
+		const TSharedPtr<PCGExHeuristics::FHeuristicsHandler>& HeuristicsHandler);
+
 	class PCGEXTENDEDTOOLKIT_API FPlotQuery : public TSharedFromThis<FPlotQuery>
 	{
 		TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler> LocalFeedbackHandler;
@@ -262,7 +295,8 @@ namespace PCGExPathfinding
 			const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager,
 			const TSharedPtr<FPCGExSearchOperation>& SearchOperation,
 			const TSharedPtr<FSearchAllocations>& Allocations,
-			const TSharedPtr<PCGExHeuristics::FHeuristicsHandler>& HeuristicsHandler);
+			const TSharedPtr<PCGExHeuristics::FHeuristicsHandler>& HeuristicsHandler,
+			const TSharedPtr<FSearchAllocationsPool>& AllocationsPool = nullptr);
 
 		void Cleanup();
 	};
@@ -106,6 +106,12 @@ public:
 	/** If disabled, will share memory allocations between queries, forcing them to execute one after another. Much slower, but very conservative for memory.  Using global feedback forces this behavior under the hood.*/
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Performance, meta=(PCG_NotOverridable, AdvancedDisplay))
 	bool bGreedyQueries = true;
+
+	/** If enabled, queries starting from the same seed node are resolved together by a single one-to-many search instead of one search per goal.
+	 * Only used when heuristics don't depend on the goal (i.e no Azimuth) and no feedback is involved, otherwise queries are resolved individually.
+	 * Paths are shortest paths according to edge scores, and may differ from the ones found by A* with a non-admissible global score. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Performance, meta=(PCG_NotOverridable, AdvancedDisplay))
+	bool bBatchQueriesBySeed = false;
 };
 
 struct FPCGExPathfindingEdgesContext final : FPCGExEdgesProcessorContext
@@ -149,6 +155,13 @@ namespace PCGExPathfindingEdges
 	{
 		TArray<TSharedPtr<PCGExPathfinding::FPathQuery>> Queries;
 		TSharedPtr<PCGExPathfinding::FSearchAllocations> SearchAllocations;
+		TSharedPtr<PCGExPathfinding::FSearchAllocationsPool> SearchAllocationsPool;
+
+		bool bBatchBySeed = false;
+		TArray<int32> SeedGroupStarts; // Offsets into SeedGroupQueries, one entry per seed node + sentinel
+		TArray<TSharedPtr<PCGExPathfinding::FPathQuery>> SeedGroupQueries;
+
+		double StartTime = 0;
 
 	public:
 		FProcessor(const TSharedRef<PCGExData::FFacade>& InVtxDataFacade, const TSharedRef<PCGExData::FFacade>& InEdgeDataFacade):
@@ -163,5 +176,10 @@ namespace PCGExPathfindingEdges
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InAsyncManager) override;
 		virtual void ProcessRange(const PCGExMT::FScope& Scope) override;
+		virtual void OnRangeProcessingComplete() override;
+
+	protected:
+		void ProcessSeedGroups();
+		void LogThroughput() const;
 	};
 }
@@ -130,6 +130,7 @@ namespace PCGExPathfindingPlotEdges
 	{
 		TArray<TSharedPtr<PCGExPathfinding::FPlotQuery>> Queries;
 		TSharedPtr<PCGExPathfinding::FSearchAllocations> SearchAllocations;
+		TSharedPtr<PCGExPathfinding::FSearchAllocationsPool> SearchAllocationsPool;
 
 	public:
 		FProcessor(const TSharedRef<PCGExData::FFacade>& InVtxDataFacade, const TSharedRef<PCGExData::FFacade>& InEdgeDataFacade):
@@ -3,87 +3,159 @@
 
 #pragma once
 
-#include <queue>
-#include <vector>
-
 #include "Containers/Array.h"
 #include "HAL/Platform.h"
 #include "Math/NumericLimits.h"
+#include "Math/UnrealMathUtility.h"
 #include "Templates/UnrealTemplate.h"
 
 namespace PCGExSearch
 {
+	/**
+	 * Indexed d-ary min-heap with decrease-key.
+	 * An item is never in the heap more than once, and per-item scores are epoch-stamped
+	 * so Reset() only bumps the epoch instead of walking every score.
+	 */
 	class FScoredQueue
 	{
+		static constexpr int32 Arity = 4;
+
 		struct FScoredNode
 		{
 			int32 Id;
 			double Score = 0;
 
-			/** Creates and initializes a new node. */
-			explicit FScoredNode(const int32 InItem, const double InScore)
+			FScoredNode(const int32 InItem, const double InScore)
 				: Id(InItem), Score(InScore)
 			{
 			}
+		};
+
+	protected:
+		TArray<FScoredNode> Heap;
+		TArray<int32> HeapIndices; // Item -> Position in heap, -1 if not queued. Only meaningful if the item is stamped with the current epoch.
+		TArray<double> Scores;
+		TArray<uint32> Epochs;
+		uint32 Epoch = 1;
+
+		FORCEINLINE bool IsStamped(const int32 Index) const { return Epochs[Index] == Epoch; }
+
+		FORCEINLINE void Place(const int32 Position, const FScoredNode& Node)
+		{
+			Heap[Position] = Node;
+			HeapIndices[Node.Id] = Position;
+		}
 
-			/** Creates and initializes a new node. */
-			explicit FScoredNode(int32&& InItem, const double InScore)
-				: Id(MoveTemp(InItem)), Score(InScore)
+		void SiftUp(int32 Position)
+		{
+			const FScoredNode Node = Heap[Position];
+			while (Position > 0)
 			{
+				const int32 Parent = (Position - 1) / Arity;
+				if (Heap[Parent].Score <= Node.Score) { break; }
+				Place(Position, Heap[Parent]);
+				Position = Parent;
 			}
+			Place(Position, Node);
+		}
 
-			bool operator<(const FScoredNode& Other) const { return Score < Other.Score; }
-			bool operator>(const FScoredNode& Other) const { return Score > Other.Score; }
-		};
+		void SiftDown(int32 Position)
+		{
+			const int32 Num = Heap.Num();
+			const FScoredNode Node = Heap[Position];
 
-	protected:
-		std::priority_queue<FScoredNode, std::vector<FScoredNode>, std::greater<FScoredNode>> InternalQueue;
+			while (true)
+			{
+				const int32 FirstChild = Position * Arity + 1;
+				if (FirstChild >= Num) { break; }
 
-	public:
-		TArray<double> Scores;
+				const int32 LastChild = FMath::Min(FirstChild + Arity, Num);
+				int32 Best = FirstChild;
+				for (int32 c = FirstChild + 1; c < LastChild; c++) { if (Heap[c].Score < Heap[Best].Score) { Best = c; } }
+
+				if (Heap[Best].Score >= Node.Score) { break; }
+				Place(Position, Heap[Best]);
+				Position = Best;
+			}
 
-		FScoredQueue(const int32 Size) { Scores.Init(MAX_dbl, Size); }
+			Place(Position, Node);
+		}
 
-		~FScoredQueue()
+	public:
+		explicit FScoredQueue(const int32 Size)
 		{
-			std::priority_queue<FScoredNode, std::vector<FScoredNode>, std::greater<FScoredNode>> EmptyQueue;
-			std::swap(InternalQueue, EmptyQueue);
+			HeapIndices.Init(-1, Size);
+			Scores.Init(MAX_dbl, Size);
+			Epochs.Init(0, Size);
+			Heap.Reserve(FMath::Min(Size, 1024));
 		}
 
+		~FScoredQueue() = default;
+
+		FORCEINLINE bool IsEmpty() const { return Heap.IsEmpty(); }
+		FORCEINLINE int32 Num() const { return Heap.Num(); }
+
+		/** Last score registered for that index during the current epoch, MAX_dbl if none. */
+		FORCEINLINE double GetScore(const int32 Index) const { return IsStamped(Index) ? Scores[Index] : MAX_dbl; }
+
+		/** Insert the item or decrease its key. Returns false if the item already has an equal or lower score registered. */
 		bool Enqueue(const int32 Index, const double InScore)
 		{
-			double& RegisteredScore = Scores[Index];
-			if (RegisteredScore <= InScore) { return false; }
+			if (!IsStamped(Index))
+			{
+				Epochs[Index] = Epoch;
+				HeapIndices[Index] = -1;
+			}
+			else if (Scores[Index] <= InScore)
+			{
+				return false;
+			}
+
+			Scores[Index] = InScore;
+
+			if (const int32 Position = HeapIndices[Index]; Position != -1)
+			{
+				// Decrease-key
+				Heap[Position].Score = InScore;
+				SiftUp(Position);
+			}
+			else
+			{
+				SiftUp(Heap.Emplace(Index, InScore));
+			}
 
-			RegisteredScore = InScore;
-			InternalQueue.push(FScoredNode(Index, InScore));
 			return true;
 		}
 
 		bool Dequeue(int32& Item, double& OutScore)
 		{
-			//TRACE_CPUPROFILER_EVENT_SCOPE(ScoredQueue::Dequeue);
+			if (Heap.IsEmpty()) { return false; }
 
-			while (!InternalQueue.empty())
+			const FScoredNode Top = Heap[0];
+			HeapIndices[Top.Id] = -1;
+
+			const FScoredNode Last = Heap.Pop(EAllowShrinking::No);
+			if (!Heap.IsEmpty())
 			{
-				const FScoredNode TopNode = InternalQueue.top();
-				InternalQueue.pop();
-
-				if (TopNode.Score == Scores[TopNode.Id])
-				{
-					Item = TopNode.Id;
-					OutScore = TopNode.Score;
-					return true;
-				}
+				Place(0, Last);
+				SiftDown(0);
 			}
 
-			return false;
+			Item = Top.Id;
+			OutScore = Top.Score;
+			return true;
 		}
 
 		void Reset()
 		{
-			InternalQueue = decltype(InternalQueue)();
-			for (double& Score : Scores) { Score = MAX_dbl; }
+			Heap.Reset();
+
+			if (++Epoch == 0)
+			{
+				// Wrapped around, stamps can no longer be trusted
+				for (uint32& E : Epochs) { E = 0; }
+				Epoch = 1;
+			}
 		}
 	};
 }
@@ -43,6 +43,16 @@ public:
 		const TSharedPtr<PCGExHeuristics::FHeuristicsHandler>& Heuristics,
 		const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback = nullptr) const;
 
+	/**
+	 * Resolve all queries sharing the same seed node with a single one-to-many expansion.
+	 * Only valid if the heuristics handler SupportsSharedSeedQueries.
+	 * @return the number of queries for which a path was found
+	 */
+	virtual int32 ResolveSharedSeedQueries(
+		const TArrayView<const TSharedPtr<PCGExPathfinding::FPathQuery>> InQueries,
+		const TSharedPtr<PCGExPathfinding::FSearchAllocations>& Allocations,
+		const TSharedPtr<PCGExHeuristics::FHeuristicsHandler>& Heuristics) const;
+
 	virtual TSharedPtr<PCGExPathfinding::FSearchAllocations> NewAllocations() const;
 };
 
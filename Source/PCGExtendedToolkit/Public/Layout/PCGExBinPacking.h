@@ -86,6 +86,10 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Fitting", meta = (PCG_Overridable))
 	bool bAvoidWastedSpace = true;
 
+	/** If enabled, free spaces that share a full face are merged back into a single larger space. Leaves more room for large items, but placement will differ from the default. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Fitting", meta = (PCG_Overridable))
+	bool bMergeFreeSpaces = false;
+
 	/** If enabled, fitting will try to avoid wasted space by not creating free spaces that are below a certain threshold. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Fitting", meta = (PCG_Overridable))
 	EPCGExPlacementFavor PlacementFavor = EPCGExPlacementFavor::SeedProximity;
@@ -178,7 +182,7 @@ namespace PCGExBinPacking
 		FVector Seed = FVector::ZeroVector;
 		TSharedPtr<FBinSplit> Splitter;
 
-		TArray<FSpace> Spaces;
+		TSharedPtr<PCGExLayout::FSpaceIndex> Spaces;
 		void AddSpace(const FBox& InBox);
 
 	public:
@@ -190,7 +194,7 @@ namespace PCGExBinPacking
 		FVector WastedSpaceThresholds = FVector::ZeroVector;
 		TArray<FItem> Items;
 
-		FBin(const PCGExData::FConstPoint& InBinPoint, const FVector& InSeed, const TSharedPtr<FBinSplit>& InSplitter);
+		FBin(const PCGExData::FConstPoint& InBinPoint, const FVector& InSeed, const TSharedPtr<FBinSplit>& InSplitter, const bool bMergeSpaces = false);
 		~FBin() = default;
 
 		bool IsFull() const { return Items.Num() <= MaxItems; }
@@ -64,6 +64,82 @@ namespace PCGExLayout
 		FVector Inflate(FBox& InBox, const FVector& Thresholds) const;
 	};
 
+	/**
+	 * Free spaces of a bin, bucketed by their smallest dimension so fit queries skip spaces that are too thin to hold the item.
+	 * Ties are resolved by insertion order, which matches a linear scan over a flat, order-preserving array.
+	 */
+	class FSpaceIndex
+	{
+	public:
+		static constexpr int32 NumBuckets = 32;
+
+	protected:
+		struct FSlot
+		{
+			FSpace Space;
+			int32 Order = 0;
+			int32 Bucket = -1;
+			int32 BucketIndex = -1;
+
+			explicit FSlot(const FSpace& InSpace) : Space(InSpace)
+			{
+			}
+		};
+
+		struct FBucket
+		{
+			TArray<int32> Slots;
+			double MaxVolume = 0;                  // Conservative, only shrinks when the bucket empties
+			double MinDistanceScore = MAX_dbl; // Conservative, only grows when the bucket empties
+		};
+
+		struct FFaceKey
+		{
+			int32 Axis = 0;
+			double Plane = 0;
+			FVector2D Min = FVector2D::ZeroVector;
+			FVector2D Max = FVector2D::ZeroVector;
+
+			FFaceKey(const FBox& InBox, const int32 InAxis, const double InPlane);
+
+			bool operator==(const FFaceKey& Other) const { return Axis == Other.Axis && Plane == Other.Plane && Min == Other.Min && Max == Other.Max; }
+			friend uint32 GetTypeHash(const FFaceKey& Key) { return HashCombineFast(HashCombineFast(::GetTypeHash(Key.Axis), ::GetTypeHash(Key.Plane)), HashCombineFast(GetTypeHash(Key.Min), GetTypeHash(Key.Max))); }
+		};
+
+		FVector Seed = FVector::ZeroVector;
+		double MaxDist = 0;
+		double BaseSize = 1;
+		bool bMergeAdjacent = false;
+		int32 NextOrder = 0;
+		int32 NumSpaces = 0;
+
+		TArray<TOptional<FSlot>> Slots;
+		TArray<int32> FreeSlots;
+		FBucket Buckets[NumBuckets];
+
+		// Only maintained when merging; maps each face of a space to that space' slot
+		TMap<FFaceKey, int32> MinFaces;
+		TMap<FFaceKey, int32> MaxFaces;
+
+	public:
+		FSpaceIndex(const FBox& InBounds, const FVector& InSeed, const double InMaxDist, const bool bInMergeAdjacent);
+
+		FORCEINLINE int32 Num() const { return NumSpaces; }
+		FORCEINLINE const FSpace& Get(const int32 Slot) const { return Slots[Slot]->Space; }
+
+		/** Add a free space. When merging is enabled, spaces that share a full face with it are absorbed first. */
+		void Add(const FBox& InBox);
+		void Remove(const int32 Slot);
+
+		/** Slot of the space minimizing 1 - (SpaceVolume - ItemVolume) / InMaxVolume + DistanceScore, or -1 if nothing fits */
+		int32 FindBestFit(const FVector& InItemSize, const double InMaxVolume, double& OutScore) const;
+
+	protected:
+		int32 GetBucket(const FVector& InSize) const;
+		int32 Insert(const FBox& InBox);
+		bool TryMerge(FBox& InOutBox);
+	};
+
 	template <EPCGExAxis MainAxis = EPCGExAxis::Up, EPCGExSpaceSplitMode SplitMode = EPCGExSpaceSplitMode::Minimal>
 	void SplitSpace(const FSpace& Space, FBox& ItemBox, TArray<FBox>& OutPartitions)
 	{
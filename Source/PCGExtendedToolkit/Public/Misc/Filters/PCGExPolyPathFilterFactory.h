@@ -84,6 +84,7 @@ protected:
 	bool bUsedForInclusion = true;
 	bool bIgnoreSelf = true;
 	bool bBuildEdgeOctree = false;
+	bool bUseInclusionGrid = false;
 
 	TArray<FPCGTaggedData> TempTargets;
 	TArray<TSharedPtr<PCGExPaths::FPolyPath>> TempPolyPaths;
@@ -406,6 +406,10 @@ namespace PCGExCompare
 	bool Compare(const EPCGExStringComparison Method, const TSharedPtr<PCGExData::IDataValue>& A, const FString B);
 	bool Compare(const EPCGExBitflagComparison Method, const int64& Flags, const int64& Mask);
 
+	// Masked batch comparisons over matching spans : results that fail the comparison are cleared, others are left untouched
+	void CompareRange(const EPCGExComparison Method, const TConstArrayView<double> A, const TConstArrayView<double> B, TArrayView<int8> InOutResults, const double Tolerance = DBL_COMPARE_TOLERANCE);
+	void CompareRange(const EPCGExBitflagComparison Method, const TConstArrayView<int64> Flags, const TConstArrayView<int64> Masks, TArrayView<int8> InOutResults, const bool bInvert = false);
+
 	bool HasMatchingTags(const TSharedPtr<PCGExData::FTags>& InTags, const FString& Query, const EPCGExStringMatchMode MatchMode, const bool bStrict = true);
 	bool GetMatchingValueTags(const TSharedPtr<PCGExData::FTags>& InTags, const FString& Query, const EPCGExStringMatchMode MatchMode, TArray<TSharedPtr<PCGExData::IDataValue>>& OutValues);
 }
@@ -563,6 +567,9 @@ struct PCGEXTENDEDTOOLKIT_API FPCGExDotComparisonDetails
 	bool Test(const double A, const double B) const;
 	bool Test(const double A, const int32 Index) const;
 
+	/** Masked batch test of dot products for consecutive points starting at Start. Dots are modified in place. */
+	void TestRange(const int32 Start, TArrayView<double> Dots, TArrayView<int8> InOutResults) const;
+
 	void RegisterBuffersDependencies(FPCGExContext* InContext, PCGExData::FFacadePreloader& FacadePreloader) const;
 	void RegisterConsumableAttributesWithData(FPCGExContext* InContext, const UPCGData* InData) const;
 	bool GetOnlyUseDataDomain() const;
@@ -20,6 +20,11 @@ namespace PCGExMT
 	class FTaskManager;
 }
 
+namespace PCGExTelemetry
+{
+	class FExecutionTelemetry;
+}
+
 namespace PCGEx
 {
 	class FUniqueNameGenerator;
@@ -46,6 +51,9 @@ public:
 	TSharedPtr<PCGEx::FManagedObjects> ManagedObjects;
 	EPCGExAsyncPriority WorkPriority = EPCGExAsyncPriority::Default;
 
+	/** Only valid if telemetry was enabled when the context was created */
+	TSharedPtr<PCGExTelemetry::FExecutionTelemetry> Telemetry;
+
 	bool bScopedAttributeGet = false;
 	bool bPropagateAbortedExecution = false;
 
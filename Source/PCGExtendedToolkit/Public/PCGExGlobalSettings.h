@@ -90,6 +90,22 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(EditCondition="bCacheClusters"))
 	bool bDefaultBuildAndCacheClusters = true;
 
+	/** If enabled, clusters built from raw vtx/edges are also saved to disk, keyed by a hash of their content, and loaded back instead of being rebuilt when the same data shows up again. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(EditCondition="bCacheClusters"))
+	bool bCacheClustersOnDisk = false;
+
+	/** Folder cluster cache files are written to. Leave empty to use Saved/PCGEx/ClusterCache. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(EditCondition="bCacheClusters && bCacheClustersOnDisk"))
+	FString ClusterDiskCacheDirectory;
+
+	/** Size cap of the cluster cache folder, in megabytes. Least recently used files are evicted whenever a new one is written and the folder gets larger than this. Use pcgex.ClusterCache.Clear to empty it. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(EditCondition="bCacheClusters && bCacheClustersOnDisk", ClampMin=1))
+	int32 ClusterDiskCacheMaxSizeMB = 1024;
+
+	/** Also store edge bounds in the disk cache. Speeds up edge octrees at the expense of larger files. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(EditCondition="bCacheClusters && bCacheClustersOnDisk"))
+	bool bCacheClusterEdgeBounds = false;
+
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Points", meta=(ClampMin=1))
 	int32 SmallPointsSize = 1024;
 	bool IsSmallPointSize(const int32 InNum) const { return InNum <= SmallPointsSize; }
@@ -98,6 +114,18 @@ public:
 	int32 PointsDefaultBatchChunkSize = 1024;
 	int32 GetPointsBatchChunkSize(const int32 In = -1) const { return In <= -1 ? PointsDefaultBatchChunkSize : In; }
 
+	/** If enabled, attributes read from the same input data by different facades or nodes share a single read-only copy of their values. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Attributes")
+	bool bShareReadableBuffers = true;
+
+	/** If enabled, processor loops without an explicit chunk size learn their per-item cost and size their chunks from it, instead of using the defaults above. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Async")
+	bool bAutoTuneBatchChunkSize = false;
+
+	/** Target duration of a single chunk, in microseconds, when auto-tuning chunk sizes. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Async", meta=(EditCondition="bAutoTuneBatchChunkSize", ClampMin=10))
+	double AutoTuneTargetChunkDuration = 250;
+
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Async")
 	EPCGExAsyncPriority DefaultWorkPriority = EPCGExAsyncPriority::BackgroundNormal;
 	EPCGExAsyncPriority GetDefaultWorkPriority() const { return DefaultWorkPriority == EPCGExAsyncPriority::Default ? EPCGExAsyncPriority::BackgroundNormal : DefaultWorkPriority; }
@@ -110,6 +138,14 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Debug")
 	bool bAssertOnEmptyThread = false;
 
+	/** If enabled, PCGEx elements collect per-phase timings, task & chunk counts and memory usage. Can also be toggled with pcgex.Telemetry, and inspected with pcgex.Telemetry.Print / pcgex.Telemetry.Dump. */
+	UPROPERTY(EditAnywhere, config, Category = "Debug")
+	bool bCollectExecutionTelemetry = false;
+
+	/** Number of executions kept in memory for telemetry dumps; oldest ones are dropped first. */
+	UPROPERTY(EditAnywhere, config, Category = "Debug", meta=(ClampMin=1))
+	int32 MaxTelemetryRecords = 4096;
+
 	/** Disable collision on new entries */
 	UPROPERTY(EditAnywhere, config, Category = "Collections")
 	bool bDisableCollisionByDefault = true;
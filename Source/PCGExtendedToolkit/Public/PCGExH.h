@@ -224,6 +224,68 @@ namespace PCGEx
 		FORCEINLINE bool Contains(const int32 Index) const { return Data.Contains(Index); }
 	};
 
+	/**
+	 * Fixed-size array where every entry reads as a default value until it's written to.
+	 * Writes are epoch-stamped, so Reset() only bumps the epoch instead of walking every entry.
+	 */
+	template <typename T>
+	class TEpochArray
+	{
+	protected:
+		TArray<T> Data;
+		TArray<uint32> Epochs;
+		uint32 Epoch = 1;
+		T DefaultValue = T{};
+
+	public:
+		TEpochArray() = default;
+
+		void Init(const T InDefaultValue, const int32 Size)
+		{
+			DefaultValue = InDefaultValue;
+			Data.SetNumUninitialized(Size);
+			Epochs.Init(0, Size);
+			Epoch = 1;
+		}
+
+		FORCEINLINE int32 Num() const { return Data.Num(); }
+		FORCEINLINE bool IsSet(const int32 At) const { return Epochs[At] == Epoch; }
+		FORCEINLINE T Get(const int32 At) const { return Epochs[At] == Epoch ? Data[At] : DefaultValue; }
+
+		FORCEINLINE void Set(const int32 At, const T Value)
+		{
+			Data[At] = Value;
+			Epochs[At] = Epoch;
+		}
+
+		void Reset()
+		{
+			if (++Epoch == 0)
+			{
+				// Wrapped around, stamps can no longer be trusted
+				for (uint32& E : Epochs) { E = 0; }
+				Epoch = 1;
+			}
+		}
+	};
+
+	class FHashLookupEpochArray : public FHashLookup
+	{
+	protected:
+		TEpochArray<uint64> Data;
+
+	public:
+		explicit FHashLookupEpochArray(const uint64 InitValue, const int32 Size)
+			: FHashLookup(InitValue, Size)
+		{
+			Data.Init(InitValue, Size);
+		}
+
+		FORCEINLINE virtual void Set(const int32 At, const uint64 Value) override { Data.Set(At, Value); }
+		FORCEINLINE virtual uint64 Get(const int32 At) override { return Data.Get(At); }
+		virtual void Reset() override { Data.Reset(); } // O(1)
+	};
+
 	template <typename T>
 	static TSharedPtr<FHashLookup> NewHashLookup(const uint64 InitValue, const int32 Size)
 	{
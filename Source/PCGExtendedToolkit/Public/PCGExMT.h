@@ -102,6 +102,40 @@ namespace PCGExMT
 
 	int32 SubLoopScopes(TArray<FScope>& OutSubRanges, const int32 MaxItems, const int32 RangeSize);
 
+	/**
+	 * Per-item cost of a processor loop, learned from the scopes it already ran, used to size its chunks.
+	 * Estimates are shared by node & loop name and outlive the execution, so the first processors of a node run with
+	 * the default chunk size while the ones starting after them, and later executions, use a measured one.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FChunkSizeTuner : public TSharedFromThis<FChunkSizeTuner>
+	{
+	public:
+		struct FEstimate
+		{
+			std::atomic<uint64> Cycles{0};
+			std::atomic<uint64> Items{0};
+			std::atomic<int32> LastChunkSize{-1};
+		};
+
+		FChunkSizeTuner(const TSharedPtr<FEstimate>& InEstimate, const UObject* InOwner, const FName InLoopName);
+
+		/** Returns nullptr if auto-tuning is disabled. */
+		static TSharedPtr<FChunkSizeTuner> TryCreate(const UObject* InOwner, const FName InLoopName);
+
+		int32 GetChunkSize(const int32 NumIterations, const int32 DefaultChunkSize) const;
+
+		FORCEINLINE void Record(const int32 NumItems, const uint64 Cycles) const
+		{
+			Estimate->Cycles.fetch_add(Cycles, std::memory_order_relaxed);
+			Estimate->Items.fetch_add(NumItems, std::memory_order_relaxed);
+		}
+
+	protected:
+		TSharedPtr<FEstimate> Estimate;
+		TWeakObjectPtr<const UObject> Owner;
+		FName LoopName = NAME_None;
+	};
+
 	PCGEXTENDEDTOOLKIT_API
 	void AssertEmptyThread(const int32 MaxItems);
 
@@ -117,6 +151,42 @@ namespace PCGExMT
 	class FTask;
 	class FTaskGroup;
 
+	/**
+	 * Shared state of a scope loop run by a handful of worker tasks instead of one task per scope.
+	 * Each worker owns a contiguous range of scope indices it consumes from the front;
+	 * once its range is exhausted, it steals the back half of another worker's range.
+	 * Ranges are packed into a single atomic so owner and thieves only ever race on one CAS.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FScopeRangeScheduler : public TSharedFromThis<FScopeRangeScheduler>
+	{
+	public:
+		FScopeRangeScheduler(TArray<FScope>&& InScopes, const int32 InNumWorkers, const bool InPrepareOnly);
+
+		TArray<FScope> Scopes;
+		const bool bPrepareOnly = false;
+
+		FORCEINLINE int32 NumWorkers() const { return NumRanges; }
+
+		/** Fetch the next scope index for the given worker, stealing from others if needed. Returns false once there is no work left anywhere. */
+		bool Next(const int32 WorkerIndex, int32& OutScopeIndex);
+
+	protected:
+		struct alignas(PLATFORM_CACHE_LINE_SIZE) FWorkerRange
+		{
+			std::atomic<uint64> Range{0}; // Begin in low bits, End in high bits
+		};
+
+		int32 NumRanges = 0;
+		TUniquePtr<FWorkerRange[]> Ranges;
+
+		static FORCEINLINE uint64 Pack(const uint32 Begin, const uint32 End) { return static_cast<uint64>(End) << 32 | Begin; }
+		static FORCEINLINE uint32 Begin(const uint64 Range) { return static_cast<uint32>(Range); }
+		static FORCEINLINE uint32 End(const uint64 Range) { return static_cast<uint32>(Range >> 32); }
+
+		bool Pop(const int32 WorkerIndex, int32& OutScopeIndex);
+		bool Steal(const int32 WorkerIndex, int32& OutScopeIndex);
+	};
+
 	class PCGEXTENDEDTOOLKIT_API FAsyncHandle : public TSharedFromThis<FAsyncHandle>
 	{
 	protected:
@@ -228,6 +298,7 @@ namespace PCGExMT
 
 	public:
 		UE::Tasks::ETaskPriority WorkPriority = UE::Tasks::ETaskPriority::Default;
+		TSharedPtr<PCGExTelemetry::FExecutionTelemetry> Telemetry;
 
 		explicit FTaskManager(FPCGExContext* InContext, bool InForceSync = false);
 		virtual ~FTaskManager() override;
@@ -280,6 +351,7 @@ namespace PCGExMT
 		friend class FTask;
 		friend class FSimpleCallbackTask;
 		friend class FScopeIterationTask;
+		friend class FScopeRangeWorkerTask;
 		friend class FForceSingleThreadedScopeIterationTask;
 
 	public:
@@ -370,6 +442,10 @@ namespace PCGExMT
 		TArray<FScope> Loops;
 
 		void ExecScopeIterations(const FScope& Scope, bool bPrepareOnly) const;
+		void RecordLoop(const int32 MaxItems) const;
+
+		/** Same contract as StartRanges<FScopeIterationTask>, but runs the scopes through a FScopeRangeScheduler. */
+		void StartScopeRanges(const int32 MaxItems, const int32 ChunkSize, const bool bPrepareOnly);
 
 		template <typename T>
 		void LaunchWithPreparation(TSharedPtr<T> InTask, const bool bPrepareOnly)
@@ -448,6 +524,20 @@ namespace PCGExMT
 		virtual void ExecuteTask(const TSharedPtr<FTaskManager>& AsyncManager) override;
 	};
 
+	class FScopeRangeWorkerTask final : public FPCGExIndexedTask
+	{
+	public:
+		PCGEX_ASYNC_TASK_NAME(FScopeRangeWorkerTask)
+
+		FScopeRangeWorkerTask(const int32 InTaskIndex, const TSharedPtr<FScopeRangeScheduler>& InScheduler):
+			FPCGExIndexedTask(InTaskIndex), Scheduler(InScheduler)
+		{
+		}
+
+		TSharedPtr<FScopeRangeScheduler> Scheduler;
+		virtual void ExecuteTask(const TSharedPtr<FTaskManager>& AsyncManager) override;
+	};
+
 	class FForceSingleThreadedScopeIterationTask final : public FPCGExIndexedTask
 	{
 	public:
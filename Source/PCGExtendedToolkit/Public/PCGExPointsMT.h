@@ -1,4 +1,4 @@
-// Copyright 2025 Timothé Lapetite and contributors
+﻿// Copyright 2025 Timothé Lapetite and contributors
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #pragma once
@@ -60,11 +60,14 @@ namespace PCGExPointsMT
 #define PCGEX_ASYNC_PROCESSOR_LOOP(_NAME, _NUM, _PREPARE, _PROCESS, _COMPLETE, _INLINE, _PLI) \
 	PCGEX_CHECK_WORK_PERMIT_VOID\
 	if (IsTrivial()){ _PREPARE({PCGExMT::FScope(0, _NUM, 0)}); _PROCESS(PCGExMT::FScope(0, _NUM, 0)); _COMPLETE(); return; } \
-	const int32 PLI = GetDefault<UPCGExGlobalSettings>()->_PLI(PerLoopIterations); \
+	int32 PLI = GetDefault<UPCGExGlobalSettings>()->_PLI(PerLoopIterations); \
+	const TSharedPtr<PCGExMT::FChunkSizeTuner> ChunkTuner = PerLoopIterations <= -1 && !_INLINE ? PCGExMT::FChunkSizeTuner::TryCreate(ExecutionSettings, FName(#_NAME)) : nullptr; \
+	if (ChunkTuner) { PLI = ChunkTuner->GetChunkSize(_NUM, PLI); } \
 	PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, ParallelLoopFor##_NAME) \
 	ParallelLoopFor##_NAME->OnCompleteCallback = [PCGEX_ASYNC_THIS_CAPTURE]() { PCGEX_ASYNC_THIS This->_COMPLETE(); }; \
 	ParallelLoopFor##_NAME->OnPrepareSubLoopsCallback = [PCGEX_ASYNC_THIS_CAPTURE](const TArray<PCGExMT::FScope>& Loops) { PCGEX_ASYNC_THIS This->_PREPARE(Loops); }; \
-	ParallelLoopFor##_NAME->OnSubLoopStartCallback =[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope) { PCGEX_ASYNC_THIS This->_PROCESS(Scope); }; \
+	if (ChunkTuner) { ParallelLoopFor##_NAME->OnSubLoopStartCallback =[PCGEX_ASYNC_THIS_CAPTURE, ChunkTuner](const PCGExMT::FScope& Scope) { PCGEX_ASYNC_THIS const uint64 StartCycles = FPlatformTime::Cycles64(); This->_PROCESS(Scope); ChunkTuner->Record(Scope.Count, FPlatformTime::Cycles64() - StartCycles); }; } \
+	else { ParallelLoopFor##_NAME->OnSubLoopStartCallback =[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope) { PCGEX_ASYNC_THIS This->_PROCESS(Scope); }; } \
     ParallelLoopFor##_NAME->StartSubLoops(_NUM, PLI, _INLINE);
 
 #define PCGEX_ASYNC_POINT_PROCESSOR_LOOP(_NAME, _NUM, _PREPARE, _PROCESS, _COMPLETE, _INLINE) PCGEX_ASYNC_PROCESSOR_LOOP(_NAME, _NUM, _PREPARE, _PROCESS, _COMPLETE, _INLINE, GetPointsBatchChunkSize)
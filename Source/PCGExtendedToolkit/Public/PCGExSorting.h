@@ -193,6 +193,17 @@ namespace PCGExSorting
 		bool Sort(const int32 A, const int32 B);
 		bool Sort(const PCGExData::FElement A, const PCGExData::FElement B);
 		bool SortData(const int32 A, const int32 B);
+
+		/**
+		 * Sort point indices in one go. Rule values are read once, quantized by each rule' tolerance
+		 * and packed into integer keys, which are then radix-sorted (or merge-sorted when they don't fit in 64 bits).
+		 * Rules whose values are not all finite, or span too many tolerance steps, are keyed on exact values instead.
+		 * Equal keys keep their relative order. Requires Init(InContext).
+		 */
+		void Sort(TArray<int32>& InOutIndices);
+
+	protected:
+		void BuildKeys(TArray<uint64>& OutKeys, TArray<int32>& OutBits) const;
 	};
 
 	PCGEXTENDEDTOOLKIT_API
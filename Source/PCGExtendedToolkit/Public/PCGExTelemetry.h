@@ -0,0 +1,119 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGExCommon.h"
+
+struct FPCGExContext;
+
+namespace PCGExTelemetry
+{
+	enum class EPhase : uint8
+	{
+		Boot = 0,
+		AssetLoading,
+		Preload,
+		Process,
+		Complete,
+		Write,
+		Output,
+		Num
+	};
+
+	PCGEXTENDEDTOOLKIT_API
+	const TCHAR* GetPhaseName(const EPhase InPhase);
+
+	/** Phase a context state belongs to. Unknown states are considered processing. */
+	PCGEXTENDEDTOOLKIT_API
+	EPhase GetPhase(const PCGExCommon::ContextState InState);
+
+	/** Whether new executions should collect telemetry, either from the global settings or the pcgex.Telemetry console variable. */
+	PCGEXTENDEDTOOLKIT_API
+	bool IsEnabled();
+
+	/** Plain snapshot of a single execution, as stored by the registry. */
+	struct PCGEXTENDEDTOOLKIT_API FRecord
+	{
+		FString Node;
+		FString NodeClass;
+		FString Owner;
+		FDateTime Timestamp;
+
+		double PhaseSeconds[static_cast<uint8>(EPhase::Num)] = {};
+		double TotalSeconds = 0;
+
+		int64 NumTasks = 0;
+		int64 NumLoops = 0;
+		int64 NumChunks = 0;
+		int64 NumLoopIterations = 0;
+		int32 MaxChunkSize = 0;
+
+		int64 NumBuffers = 0;
+		int64 BufferBytes = 0;
+
+		int64 NumClusters = 0;
+		int64 PeakClusterBytes = 0;
+
+		bool bCancelled = false;
+	};
+
+	/**
+	 * Telemetry of a single execution, owned by its context.
+	 * Counters are safe to update from any thread; clusters keep a reference so their memory can be released after the context is gone.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FExecutionTelemetry : public TSharedFromThis<FExecutionTelemetry>
+	{
+	public:
+		FExecutionTelemetry();
+
+		void EnterPhase(const EPhase InPhase);
+
+		FORCEINLINE void AddTasks(const int32 Count) { NumTasks.fetch_add(Count, std::memory_order_relaxed); }
+		void AddLoop(const int32 NumIterations, const int32 NumChunks);
+
+		FORCEINLINE void AddBuffer(const int64 Bytes)
+		{
+			NumBuffers.fetch_add(1, std::memory_order_relaxed);
+			BufferBytes.fetch_add(Bytes, std::memory_order_relaxed);
+		}
+
+		/** Register (positive) or release (negative) cluster memory; the peak of what's alive at once is kept. */
+		void AddClusterBytes(const int64 Bytes);
+
+		/** Closes the current phase and sends the record to the registry. Only the first call has any effect. */
+		void Submit(const FPCGExContext* InContext);
+
+	protected:
+		FCriticalSection PhaseLock;
+		EPhase CurrentPhase = EPhase::Boot;
+		uint64 PhaseStartCycles = 0;
+		uint64 StartCycles = 0;
+		uint64 PhaseCycles[static_cast<uint8>(EPhase::Num)] = {};
+		bool bSubmitted = false;
+
+		std::atomic<int64> NumTasks{0};
+		std::atomic<int64> NumLoops{0};
+		std::atomic<int64> NumChunks{0};
+		std::atomic<int64> NumLoopIterations{0};
+		std::atomic<int32> MaxChunkSize{0};
+
+		std::atomic<int64> NumBuffers{0};
+		std::atomic<int64> BufferBytes{0};
+
+		std::atomic<int64> NumClusters{0};
+		std::atomic<int64> LiveClusterBytes{0};
+		std::atomic<int64> PeakClusterBytes{0};
+	};
+
+	PCGEXTENDEDTOOLKIT_API
+	void GetRecords(TArray<FRecord>& OutRecords);
+
+	PCGEXTENDEDTOOLKIT_API
+	void ResetRecords();
+
+	/** Writes all records, along with per-node totals, to a JSON file. Returns false if the file could not be written. */
+	PCGEXTENDEDTOOLKIT_API
+	bool DumpToJson(const FString& InFilePath);
+}
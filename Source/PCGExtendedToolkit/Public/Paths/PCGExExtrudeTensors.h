@@ -276,6 +276,7 @@ struct FPCGExExtrudeTensorsContext final : FPCGExPathProcessorContext
 	friend class FPCGExExtrudeTensorsElement;
 
 	TArray<TObjectPtr<const UPCGExTensorFactoryData>> TensorFactories;
+	TSharedPtr<PCGExTensor::FTensorField> TensorField; // Shared by all processors when baking is enabled
 	TArray<TObjectPtr<const UPCGExPointFilterFactoryData>> StopFilterFactories;
 
 	FPCGExPathIntersectionDetails ExternalPathIntersections;
@@ -682,6 +682,47 @@ namespace PCGExPaths
 		const PCGExMath::FSegment& InSegment, int32& OutPathIndex,
 		PCGExMath::FClosestPosition& OutClosestPosition);
 
+	class FSegmentTree;
+
+	/**
+	 * Uniform grid over a 2D polygon that classifies each cell as inside, outside or crossed by the boundary.
+	 * Cells away from the boundary answer inclusion in O(1); boundary cells only walk the few edges registered to them,
+	 * starting from the precomputed winding at the cell center. Uses non-zero winding, like FGeomTools2D::IsPointInPolygon.
+	 * The polygon is not copied and must outlive the grid.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FPolygonInclusionGrid : public TSharedFromThis<FPolygonInclusionGrid>
+	{
+	public:
+		explicit FPolygonInclusionGrid(const TArray<FVector2D>& InPolygon, const int32 InMaxResolution = 256);
+
+		FORCEINLINE bool IsValid() const { return !Status.IsEmpty(); }
+		bool IsInside(const FVector2D& InPoint) const;
+
+	protected:
+		enum ECellStatus : uint8
+		{
+			Outside  = 0,
+			Inside   = 1,
+			Boundary = 2,
+		};
+
+		TConstArrayView<FVector2D> Polygon;
+
+		FVector2D Origin = FVector2D::ZeroVector;
+		FVector2D CellSize = FVector2D::OneVector;
+		FVector2D InvCellSize = FVector2D::OneVector;
+		int32 ResX = 0;
+		int32 ResY = 0;
+
+		TArray<uint8> Status;
+		TArray<int32> Winding;     // Winding number at each cell center
+		TArray<int32> EdgeOffsets; // Per-cell range in CellEdges, ResX * ResY + 1 entries
+		TArray<int32> CellEdges;
+
+		FORCEINLINE FVector2D GetCellCenter(const int32 X, const int32 Y) const { return Origin + FVector2D(X + 0.5, Y + 0.5) * CellSize; }
+		void ForEachEdgeCell(const int32 EdgeIndex, const TFunctionRef<void(const int32)>& Func) const;
+	};
+
 	class FPolyPath : public FPath
 	{
 		TSharedPtr<FPCGSplineStruct> LocalSpline;
@@ -693,6 +734,16 @@ namespace PCGExPaths
 		FPCGExGeo2DProjectionDetails Projection;
 		FBox PolyBox = FBox(ForceInit);
 
+		bool bUseInclusionGrid = false;
+		mutable FRWLock InclusionGridLock;
+		mutable TSharedPtr<FPolygonInclusionGrid> InclusionGrid;
+		mutable std::atomic<bool> bInclusionGridReady{false};
+
+		bool bUseSegmentTree = false;
+		mutable FRWLock SegmentTreeLock;
+		mutable TSharedPtr<FSegmentTree> SegmentTree;
+		mutable std::atomic<bool> bSegmentTreeReady{false};
+
 	public:
 		FPolyPath(
 			const TSharedPtr<PCGExData::FPointIO>& InPointIO,
@@ -714,7 +765,17 @@ namespace PCGExPaths
 
 		FORCEINLINE const FPCGSplineStruct* GetSpline() const { return Spline; }
 
+		/** Inclusion tests will go through a FPolygonInclusionGrid, built on first use. */
+		void EnableInclusionGrid() { bUseInclusionGrid = true; }
+
+		/** Closest key/edge searches will go through a FSegmentTree, built on first use. */
+		void EnableSegmentTree() { bUseSegmentTree = true; }
+
 	protected:
+		const FPolygonInclusionGrid* GetInclusionGrid() const;
+		const FSegmentTree* GetSegmentTree() const;
+		float FindClosestInputKey(const FVector& WorldPosition) const;
+
 		void InitFromTransforms(
 			const TConstPCGValueRange<FTransform>& InTransforms,
 			const double ExpansionZ = -1, const EPCGExWindingMutation WindingMutation = EPCGExWindingMutation::Unchanged);
@@ -0,0 +1,78 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Utils/PCGValueRange.h"
+
+struct FPCGSplineStruct;
+
+namespace PCGExPaths
+{
+	/**
+	 * Bounding volume hierarchy over the tessellated segments of a spline or polyline, in world space.
+	 * Each segment knows the input key range it covers, so the closest segment gives a first guess of the
+	 * closest input key; with a spline, that guess is then refined with a few Newton steps on the actual curve.
+	 * Immutable once built, and safe to query from any number of workers.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FSegmentTree : public TSharedFromThis<FSegmentTree>
+	{
+	public:
+		static constexpr int32 LeafSize = 4;
+		static constexpr int32 MaxSubdivisions = 64;
+
+		/**
+		 * Tessellates the spline so that no segment is much longer than Fidelity.
+		 * Spline segments are capped at MaxSubdivisions, so long ones may end up with coarser chords; see GetMaxDeviation.
+		 */
+		explicit FSegmentTree(const FPCGSplineStruct& InSpline, const double Fidelity = 50);
+
+		/** Polyline version; segment keys are point indices, same as a linear spline built from these points. */
+		FSegmentTree(const TConstPCGValueRange<FTransform>& InTransforms, const bool bClosedLoop);
+
+		FORCEINLINE bool IsValid() const { return !Nodes.IsEmpty(); }
+		FORCEINLINE int32 NumSegments() const { return Keys.Num() - 1; }
+		FORCEINLINE const FBox& GetBounds() const { return Nodes[0].Bounds; }
+
+		/**
+		 * Largest distance between the curve and the chord standing for it, sampled at build time; always 0 for polylines.
+		 * Distance-limited queries must add it to their range, since the curve may be that much closer than its tessellation.
+		 */
+		FORCEINLINE double GetMaxDeviation() const { return MaxDeviation; }
+
+		/**
+		 * Finds the input key closest to the given world position.
+		 * Returns false without touching the outputs if nothing lies within MaxDistSquared, which lets range-limited queries bail early.
+		 */
+		bool FindClosestKey(const FVector& WorldPosition, double& OutKey, double& OutDistSquared, const double MaxDistSquared = MAX_dbl) const;
+
+		bool FindClosestKey(const FVector& WorldPosition, double& OutKey) const
+		{
+			double DistSquared = 0;
+			return FindClosestKey(WorldPosition, OutKey, DistSquared);
+		}
+
+	protected:
+		struct FNode
+		{
+			FBox Bounds = FBox(ForceInit);
+			int32 Start = 0; // First child if Count == 0, otherwise first entry in SegmentOrder
+			int32 Count = 0;
+		};
+
+		const FPCGSplineStruct* Spline = nullptr;
+
+		TArray<FVector> Points; // Segment i goes from Points[i] to Points[i + 1]
+		TArray<double> Keys;    // Input key at each point
+		double MaxDeviation = 0;
+
+		TArray<FNode> Nodes;
+		TArray<int32> SegmentOrder;
+
+		void Build();
+		int32 BuildNode(const int32 Start, const int32 Count, TArray<FVector>& Centers);
+
+		double Refine(const FVector& WorldPosition, const int32 Segment, const double Key, double& InOutDistSquared) const;
+	};
+}
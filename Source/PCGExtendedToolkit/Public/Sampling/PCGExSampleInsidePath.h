@@ -122,6 +122,10 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Sampling", meta=(PCG_NotOverridable, ClampMin=0))
 	double HeightInclusion = 0;
 
+	/** If enabled, the projected path builds a grid so most inclusion tests don't need to go through every edge. Faster on large paths and dense targets, at the cost of some memory. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Sampling", meta=(PCG_NotOverridable), AdvancedDisplay)
+	bool bUseInclusionGrid = true;
+
 #pragma endregion
 
 	/** Weight method used for blending */
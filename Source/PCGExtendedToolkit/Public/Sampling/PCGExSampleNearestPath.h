@@ -401,6 +401,10 @@ public:
 	/**  */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_NotOverridable), AdvancedDisplay)
 	bool bIgnoreSelf = true;
+
+	/** If enabled, each path builds a segment tree on first use to find the closest edge, instead of going through every segment. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_NotOverridable), AdvancedDisplay)
+	bool bUseSegmentTree = true;
 };
 
 struct FPCGExSampleNearestPathContext final : FPCGExPointsProcessorContext
@@ -334,6 +334,7 @@ struct FPCGExSampleNearestPointContext final : FPCGExPointsProcessorContext
 
 	TSharedPtr<PCGExSampling::FTargetsHandler> TargetsHandler;
 	int32 NumMaxTargets = 0;
+	bool bUseTargetsKDTree = false;
 
 	TArray<TSharedPtr<PCGExData::TBuffer<double>>> TargetWeights;
 	TArray<TSharedPtr<PCGExDetails::TSettingValue<FVector>>> TargetLookAtUpGetters;
@@ -17,6 +17,11 @@
 
 #include "PCGExSampleNearestSpline.generated.h"
 
+namespace PCGExPaths
+{
+	class FSegmentTree;
+}
+
 #define PCGEX_FOREACH_FIELD_NEARESTPOLYLINE(MACRO)\
 MACRO(Success, bool, false)\
 MACRO(Transform, FTransform, FTransform::Identity)\
@@ -451,6 +456,14 @@ public:
 	/** Optimize spatial partitioning, but limit the "reach" of splines to their bounding box. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable), AdvancedDisplay)
 	bool bUseOctree = true;
+
+	/** If enabled, splines are tessellated into a segment tree used to find the closest point, then refined on the actual curve. Much faster than the exhaustive search on long or complex splines. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_NotOverridable), AdvancedDisplay)
+	bool bUseSegmentTree = true;
+
+	/** Segment tree tessellation length. Smaller values make a closer initial guess before refinement, at the cost of a larger tree; very coarse values may let refinement settle on a local minimum on tight bends. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_NotOverridable, EditCondition="bUseSegmentTree", ClampMin=1), AdvancedDisplay)
+	double SegmentTreeFidelity = 50;
 };
 
 struct FPCGExSampleNearestSplineContext final : FPCGExPointsProcessorContext
@@ -468,6 +481,7 @@ struct FPCGExSampleNearestSplineContext final : FPCGExPointsProcessorContext
 
 	FBox OctreeBounds = FBox(ForceInit);
 	TSharedPtr<PCGExOctree::FItemOctree> SplineOctree;
+	TArray<TSharedPtr<PCGExPaths::FSegmentTree>> SegmentTrees;
 
 	int64 NumTargets = 0;
 
@@ -520,6 +534,7 @@ namespace PCGExSampleNearestSpline
 		bool bClosestSample = false;
 		bool bOnlySignIfClosed = false;
 		bool bOnlyIncrementInsideNumIfClosed = false;
+		bool bPruneByRange = false;
 
 		PCGEX_FOREACH_FIELD_NEARESTPOLYLINE(PCGEX_OUTPUT_DECL)
 
@@ -5,6 +5,7 @@
 
 #include "PCGEx.h"
 #include "PCGExOctree.h"
+#include "Geometry/PCGExGeoKDTree.h"
 #include "Data/PCGExDataPreloader.h"
 #include "Data/PCGExUnionData.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
@@ -223,6 +224,10 @@ namespace PCGExSampling
 		TArray<const PCGPointOctree::FPointOctree*> TargetOctrees;
 		int32 MaxNumTargets = 0;
 
+		// Optional flat index over every target point, see BuildKDTree
+		TSharedPtr<PCGExGeo::FKDTree> TargetsKDTree;
+		TArray<PCGExData::FElement> KDTreeElements;
+
 		TSharedPtr<PCGExDetails::FDistances> Distances;
 
 	public:
@@ -268,6 +273,14 @@ namespace PCGExSampling
 		void FindElementsWithBoundsTest(const FBoxCenterAndExtent& QueryBounds, FTargetElementsQuery&& Func, const TSet<const UPCGData*>* Exclude = nullptr) const;
 		void FindElementsWithBoundsTest(const FBoxCenterAndExtent& QueryBounds, FOctreeQueryWithData&& Func, const TSet<const UPCGData*>* Exclude = nullptr) const;
 
+		/** Build a kd-tree over the location of every target point. Point queries below are only available once built. */
+		void BuildKDTree();
+		bool HasKDTree() const { return TargetsKDTree.IsValid(); }
+
+		bool FindNearestTarget(const FVector& Center, PCGExData::FElement& OutTarget, double& OutDistSquared, const double MinDistSquared = 0, const double MaxDistSquared = MAX_dbl, const TSet<const UPCGData*>* Exclude = nullptr) const;
+		bool FindFarthestTarget(const FVector& Center, PCGExData::FElement& OutTarget, double& OutDistSquared, const double MinDistSquared = 0, const double MaxDistSquared = MAX_dbl, const TSet<const UPCGData*>* Exclude = nullptr) const;
+		int32 FindKNearestTargets(const FVector& Center, const int32 K, TArray<PCGExData::FElement>& OutTargets, const double MaxDistSquared = MAX_dbl, const TSet<const UPCGData*>* Exclude = nullptr) const;
+
 		bool FindClosestTarget(const PCGExData::FConstPoint& Probe, const FBoxCenterAndExtent& QueryBounds, PCGExData::FConstPoint& OutResult, double& OutDistSquared, const TSet<const UPCGData*>* Exclude = nullptr) const;
 		void FindClosestTarget(const PCGExData::FConstPoint& Probe, PCGExData::FConstPoint& OutResult, double& OutDistSquared, const TSet<const UPCGData*>* Exclude = nullptr) const;
 		void FindClosestTarget(const FVector& Probe, PCGExData::FConstPoint& OutResult, double& OutDistSquared, const TSet<const UPCGData*>* Exclude = nullptr) const;
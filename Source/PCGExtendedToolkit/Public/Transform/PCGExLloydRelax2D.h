@@ -8,6 +8,7 @@
 #include "PCGExPointsProcessor.h"
 #include "Details/PCGExDetailsRelax.h"
 #include "Geometry/PCGExGeo.h"
+#include "Geometry/PCGExGeoDelaunay.h"
 #include "PCGExLloydRelax2D.generated.h"
 
 /**
@@ -72,6 +73,7 @@ namespace PCGExLloydRelax2D
 		TArray<FVector> ActivePositions;
 
 		FPCGExGeo2DProjectionDetails ProjectionDetails;
+		PCGExGeo::FWarmDelaunay2 Delaunay; // Kept across iterations
 
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade):
@@ -135,6 +135,7 @@ struct FPCGExTensorsTransformContext final : FPCGExPointsProcessorContext
 	friend class FPCGExTensorsTransformElement;
 
 	TArray<TObjectPtr<const UPCGExTensorFactoryData>> TensorFactories;
+	TSharedPtr<PCGExTensor::FTensorField> TensorField; // Shared by all processors when baking is enabled
 	TArray<TObjectPtr<const UPCGExPointFilterFactoryData>> StopFilterFactories;
 
 	PCGEX_FOREACH_FIELD_TRTENSOR(PCGEX_OUTPUT_DECL_TOGGLE)
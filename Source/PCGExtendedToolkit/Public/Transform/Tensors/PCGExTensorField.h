@@ -0,0 +1,65 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGExTensor.h"
+
+class UPCGExTensorFactoryData;
+class PCGExTensorOperation;
+
+namespace PCGExTensor
+{
+	/**
+	 * Combined tensor field rasterized into a sparse grid of bricks, sampled with trilinear interpolation.
+	 * Bricks are built on first access by whichever worker needs them; other workers needing the same brick
+	 * wait for it, so every sample of a given field is interpolated the same way regardless of scheduling.
+	 * Only valid for tensors that depend on the probe location alone.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FTensorField : public TSharedFromThis<FTensorField>
+	{
+	public:
+		static constexpr int32 BrickCells = 8;                // Cells per brick axis
+		static constexpr int32 BrickVerts = BrickCells + 1; // Bricks store their own far border, so a cell never spans two bricks
+		static constexpr int32 NumBrickVerts = BrickVerts * BrickVerts * BrickVerts;
+
+		explicit FTensorField(const double InCellSize);
+
+		bool Init(FPCGExContext* InContext, const TArray<TObjectPtr<const UPCGExTensorFactoryData>>& InFactories);
+		bool Init(const TArray<TSharedPtr<PCGExTensorOperation>>& InTensors);
+
+		/** Trilinear sample of the baked field, building the brick covering that position if need be. */
+		bool Sample(const FVector& InPosition, FTensorSample& OutSample) const;
+
+		FORCEINLINE double GetCellSize() const { return CellSize; }
+		int32 NumBricks() const;
+
+		static bool CanBake(const TArray<TSharedPtr<PCGExTensorOperation>>& InTensors);
+
+	protected:
+		struct FBrick
+		{
+			TArray<FVector3f> DirectionAndSize;
+			TArray<FQuat4f> Rotation;
+			TArray<float> Effectors;
+			TArray<float> Weight;
+
+			FCriticalSection BuildLock;
+			std::atomic<bool> bReady{false};
+		};
+
+		double CellSize = 50;
+		double InvCellSize = 1.0 / 50;
+
+		TArray<TSharedPtr<PCGExTensorOperation>> Tensors;
+
+		mutable FRWLock BricksLock;
+		mutable TMap<FIntVector, TSharedPtr<FBrick>> Bricks;
+
+		const FBrick* FindOrBuildBrick(const FIntVector& InBrick) const;
+		void BuildBrick(const FIntVector& InBrick, FBrick& OutBrick) const;
+
+		static FORCEINLINE int32 VertIndex(const int32 X, const int32 Y, const int32 Z) { return X + (Y + Z * BrickVerts) * BrickVerts; }
+	};
+}
@@ -11,6 +11,7 @@
 namespace PCGExTensor
 {
 	struct FTensorSample;
+	class FTensorField;
 }
 
 USTRUCT(BlueprintType)
@@ -79,6 +80,17 @@ struct PCGEXTENDEDTOOLKIT_API FPCGExTensorHandlerDetails
 	/** Uniform scale factor applied to sampling after all other mutations are accounted for. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
 	FPCGExTensorSamplerDetails SamplerSettings;
+
+	/** If enabled, the combined tensor field is baked into a sparse grid as it gets sampled, and interpolated from there. Much faster when the same region is sampled many times, at the cost of precision. Ignored if any tensor depends on the probe orientation, such as inertia or bidirectional tensors. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_NotOverridable))
+	bool bBake = false;
+
+	/** Size of a single cell of the baked grid. Smaller cells are more precise but slower to bake & use more memory. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, DisplayName = " └─ Cell Size", EditCondition="bBake", EditConditionHides, ClampMin=1))
+	double BakeCellSize = 50;
+
+	/** Creates a baked field from the given tensors, if baking is enabled and supported by all of them. */
+	TSharedPtr<PCGExTensor::FTensorField> TryCreateBakedField(FPCGExContext* InContext, const TArray<TObjectPtr<const UPCGExTensorFactoryData>>& InFactories) const;
 };
 
 namespace PCGExTensor
@@ -94,7 +106,8 @@ namespace PCGExTensor
 	public:
 		explicit FTensorsHandler(const FPCGExTensorHandlerDetails& InConfig);
 
-		bool Init(FPCGExContext* InContext, const TArray<TObjectPtr<const UPCGExTensorFactoryData>>& InFactories, const TSharedPtr<PCGExData::FFacade>& InDataFacade);
+		/** InBakedField lets several handlers share the same field; if none is provided & baking is enabled, the handler bakes its own. */
+		bool Init(FPCGExContext* InContext, const TArray<TObjectPtr<const UPCGExTensorFactoryData>>& InFactories, const TSharedPtr<PCGExData::FFacade>& InDataFacade, const TSharedPtr<FTensorField>& InBakedField = nullptr);
 		bool Init(FPCGExContext* InContext, const FName InPin, const TSharedPtr<PCGExData::FFacade>& InDataFacade);
 
 		FTensorSample Sample(int32 InSeedIndex, const FTransform& InProbe, bool& OutSuccess) const;
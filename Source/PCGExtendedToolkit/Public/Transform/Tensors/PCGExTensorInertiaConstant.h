@@ -46,6 +46,7 @@ public:
 	virtual bool Init(FPCGExContext* InContext, const UPCGExTensorFactoryData* InFactory) override;
 
 	virtual PCGExTensor::FTensorSample Sample(int32 InSeedIndex, const FTransform& InProbe) const override;
+	virtual bool CanBake() const override { return false; }
 };
 
 
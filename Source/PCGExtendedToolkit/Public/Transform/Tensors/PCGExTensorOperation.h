@@ -30,6 +30,9 @@ public:
 
 	virtual PCGExTensor::FTensorSample Sample(int32 InSeedIndex, const FTransform& InProbe) const;
 
+	/** Whether samples only depend on the probe location, and can be baked into a field */
+	virtual bool CanBake() const { return !BaseConfig.Mutations.bBidirectional; }
+
 	virtual bool PrepareForData(const TSharedPtr<PCGExData::FFacade>& InDataFacade);
 
 	template <bool bFast = false>
@@ -12,6 +12,11 @@
 
 #include "PCGExTensorSampler.generated.h"
 
+namespace PCGExTensor
+{
+	class FTensorField;
+}
+
 /**
  * 
  */
@@ -24,6 +29,12 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
 	double Radius = 1;
 
+	/** If set, raw samples are read from this baked field instead of evaluating every tensor */
+	TSharedPtr<PCGExTensor::FTensorField> BakedField;
+
+	/** Weighted combination of all tensors at a given probe */
+	static PCGExTensor::FTensorSample SampleTensors(const TArray<TSharedPtr<PCGExTensorOperation>>& InTensors, int32 InSeedIndex, const FTransform& InProbe);
+
 	virtual void CopySettingsFrom(const UPCGExInstancedFactory* Other) override;
 	virtual bool PrepareForData(FPCGExContext* InContext);
 	virtual PCGExTensor::FTensorSample RawSample(const TArray<TSharedPtr<PCGExTensorOperation>>& InTensors, int32 InSeedIndex, const FTransform& InProbe) const;
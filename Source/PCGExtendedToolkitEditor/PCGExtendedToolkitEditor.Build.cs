@@ -61,6 +61,7 @@ public class PCGExtendedToolkitEditor : ModuleRules
 				"GameProjectGeneration",
 				"GraphEditor",
 				"InputCore",
+				"Json",
 				"Kismet",
 				"KismetWidgets",
 				"PCG",
@@ -0,0 +1,723 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Benchmark/PCGExBenchmarkCommandlet.h"
+
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+#include "PCGExCompare.h"
+#include "PCGExContext.h"
+#include "PCGExSorting.h"
+#include "Data/PCGExData.h"
+#include "Data/PCGExPointFilter.h"
+#include "Data/PCGExPointIO.h"
+#include "Data/PCGExProxyData.h"
+#include "Data/Blending/PCGExProxyDataBlending.h"
+#include "Geometry/PCGExGeoDelaunay.h"
+#include "Geometry/PCGExGeoKDTree.h"
+#include "Graph/PCGExCluster.h"
+#include "Graph/PCGExEdgeHashMap.h"
+#include "Graph/PCGExGraph.h"
+#include "Graph/PCGExIntersections.h"
+#include "Graph/Filters/PCGExClusterFilter.h"
+#include "Graph/Pathfinding/PCGExPathfinding.h"
+#include "Graph/Pathfinding/Heuristics/PCGExHeuristicDistance.h"
+#include "Graph/Pathfinding/Heuristics/PCGExHeuristics.h"
+#include "Graph/Pathfinding/Search/PCGExSearchAStar.h"
+#include "Misc/Filters/PCGExNumericCompareFilter.h"
+#include "Paths/PCGExPaths.h"
+#include "Paths/PCGExSegmentTree.h"
+
+#include "GeomTools.h"
+#include "Components/SplineComponent.h"
+#include "Data/PCGSplineStruct.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogPCGExBenchmark, Log, All);
+
+namespace PCGExBenchmark
+{
+	struct FResult
+	{
+		FString Name;
+		int32 NumItems = 0;
+		TArray<double> Timings; // Seconds
+	};
+
+	class FRunner
+	{
+	public:
+		int32 Iterations = 5;
+		FString Filter;
+		TArray<FResult> Results;
+
+		/** Prepare runs untimed before each iteration, so kernels can be timed from the same initial state every time */
+		template <typename PrepareFunc, typename RunFunc>
+		void Run(const FString& Name, const int32 NumItems, PrepareFunc&& Prepare, RunFunc&& Body)
+		{
+			if (!Filter.IsEmpty() && !Name.Contains(Filter)) { return; }
+
+			FResult& Result = Results.Emplace_GetRef();
+			Result.Name = Name;
+			Result.NumItems = NumItems;
+			Result.Timings.Reserve(Iterations);
+
+			for (int i = 0; i < Iterations; i++)
+			{
+				Prepare();
+
+				const double Start = FPlatformTime::Seconds();
+				Body();
+				Result.Timings.Add(FPlatformTime::Seconds() - Start);
+			}
+
+			UE_LOG(LogPCGExBenchmark, Display, TEXT("%-32s %10d items | median %10.3f ms"), *Name, NumItems, GetMedian(Result.Timings) * 1000);
+		}
+
+		static double GetMedian(TArray<double> Timings)
+		{
+			if (Timings.IsEmpty()) { return 0; }
+			Timings.Sort();
+			const int32 Half = Timings.Num() / 2;
+			return Timings.Num() % 2 ? Timings[Half] : (Timings[Half - 1] + Timings[Half]) * 0.5;
+		}
+	};
+
+	static void MakePositions(const int32 Seed, const int32 NumPoints, const bool bFlat, TArray<FVector>& OutPositions)
+	{
+		const FRandomStream Random(Seed);
+		const double Extent = 100 * FMath::Sqrt(static_cast<double>(NumPoints));
+
+		OutPositions.SetNumUninitialized(NumPoints);
+		for (FVector& Position : OutPositions)
+		{
+			Position = FVector(
+				Random.FRandRange(-Extent, Extent),
+				Random.FRandRange(-Extent, Extent),
+				bFlat ? 0 : Random.FRandRange(-Extent, Extent));
+		}
+	}
+
+	// Sparse, locally connected edges with roughly one duplicate for every three unique edges
+	static void MakeEdgeHashes(const int32 Seed, const int32 NumNodes, const int32 Degree, TArray<uint64>& OutHashes)
+	{
+		const FRandomStream Random(Seed);
+
+		OutHashes.Reset(NumNodes * Degree);
+		for (int i = 0; i < NumNodes; i++)
+		{
+			for (int d = 0; d < Degree; d++)
+			{
+				const int32 Other = FMath::Clamp(i + Random.RandRange(-16, 16), 0, NumNodes - 1);
+				if (Other == i) { continue; }
+				OutHashes.Add(PCGEx::H64U(i, Other));
+			}
+		}
+	}
+
+	// Closed, flat, star-shaped loop with a randomly jittered radius, so it's non-convex but never self-intersecting
+	static void MakeLoop(const int32 Seed, const int32 NumPoints, TArray<FVector>& OutPositions)
+	{
+		const FRandomStream Random(Seed);
+		const double Radius = 100 * NumPoints;
+
+		OutPositions.SetNumUninitialized(NumPoints);
+		for (int i = 0; i < NumPoints; i++)
+		{
+			const double Angle = UE_TWO_PI * i / NumPoints;
+			OutPositions[i] = FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0) * Radius * Random.FRandRange(0.6, 1);
+		}
+	}
+
+	const FName Attr_Score = FName("Score");
+
+	/**
+	 * Jittered Width x Width grid where each node is linked to its right and upper neighbors,
+	 * written as vtx/edges data the same way the graph builder does, with a random "Score" attribute on vtx.
+	 * Returned IOs are read-only views over the written data.
+	 */
+	static void MakeGridCluster(
+		FPCGExContext* InContext, const int32 Seed, const int32 Width,
+		TSharedPtr<PCGExData::FPointIO>& OutVtxIO, TSharedPtr<PCGExData::FPointIO>& OutEdgesIO)
+	{
+		const FRandomStream Random(Seed);
+		const int32 NumNodes = Width * Width;
+
+		TArray<int32> Adjacency;
+		Adjacency.Init(0, NumNodes);
+
+		TArray<uint64> Edges;
+		Edges.Reserve(NumNodes * 2);
+
+		for (int i = 0; i < NumNodes; i++)
+		{
+			const int32 X = i % Width;
+			const int32 Y = i / Width;
+
+			if (X + 1 < Width) { Edges.Add(PCGEx::H64(i, i + 1)); }
+			if (Y + 1 < Width) { Edges.Add(PCGEx::H64(i, i + Width)); }
+		}
+
+		for (const uint64 Edge : Edges)
+		{
+			Adjacency[PCGEx::H64A(Edge)]++;
+			Adjacency[PCGEx::H64B(Edge)]++;
+		}
+
+		const TSharedPtr<PCGExData::FPointIO> VtxIO = MakeShared<PCGExData::FPointIO>(InContext->GetOrCreateHandle());
+		VtxIO->InitializeOutput(PCGExData::EIOInit::New);
+
+		UPCGBasePointData* VtxData = VtxIO->GetOut();
+		VtxData->SetNumPoints(NumNodes);
+		VtxData->AllocateProperties(EPCGPointNativeProperties::Transform);
+
+		TPCGValueRange<FTransform> VtxTransforms = VtxData->GetTransformValueRange(false);
+		for (int i = 0; i < NumNodes; i++)
+		{
+			VtxTransforms[i].SetLocation(
+				FVector(
+					(i % Width) * 100 + Random.FRandRange(-25, 25),
+					(i / Width) * 100 + Random.FRandRange(-25, 25),
+					0));
+		}
+
+		{
+			const TSharedPtr<PCGExData::FFacade> VtxFacade = MakeShared<PCGExData::FFacade>(VtxIO.ToSharedRef());
+			const TSharedPtr<PCGExData::TBuffer<int64>> VtxEndpoints = VtxFacade->GetWritable<int64>(PCGExGraph::Attr_PCGExVtxIdx, 0, false, PCGExData::EBufferInit::New);
+			const TSharedPtr<PCGExData::TBuffer<double>> Scores = VtxFacade->GetWritable<double>(Attr_Score, 0, true, PCGExData::EBufferInit::New);
+
+			for (int i = 0; i < NumNodes; i++)
+			{
+				VtxEndpoints->SetValue(i, PCGEx::H64(i, Adjacency[i]));
+				Scores->SetValue(i, Random.FRand());
+			}
+
+			VtxFacade->WriteSynchronous();
+		}
+
+		const TSharedPtr<PCGExData::FPointIO> EdgesIO = MakeShared<PCGExData::FPointIO>(InContext->GetOrCreateHandle());
+		EdgesIO->InitializeOutput(PCGExData::EIOInit::New);
+
+		UPCGBasePointData* EdgeData = EdgesIO->GetOut();
+		EdgeData->SetNumPoints(Edges.Num());
+		EdgeData->AllocateProperties(EPCGPointNativeProperties::Transform);
+
+		TPCGValueRange<FTransform> EdgeTransforms = EdgeData->GetTransformValueRange(false);
+		for (int i = 0; i < Edges.Num(); i++)
+		{
+			EdgeTransforms[i].SetLocation(
+				FMath::Lerp(
+					VtxTransforms[PCGEx::H64A(Edges[i])].GetLocation(),
+					VtxTransforms[PCGEx::H64B(Edges[i])].GetLocation(), 0.5));
+		}
+
+		{
+			const TSharedPtr<PCGExData::FFacade> EdgesFacade = MakeShared<PCGExData::FFacade>(EdgesIO.ToSharedRef());
+			const TSharedPtr<PCGExData::TBuffer<int64>> EdgeEndpoints = EdgesFacade->GetWritable<int64>(PCGExGraph::Attr_PCGExEdgeIdx, -1, false, PCGExData::EBufferInit::New);
+
+			for (int i = 0; i < Edges.Num(); i++) { EdgeEndpoints->SetValue(i, Edges[i]); }
+
+			EdgesFacade->WriteSynchronous();
+		}
+
+		OutVtxIO = MakeShared<PCGExData::FPointIO>(InContext->GetOrCreateHandle(), VtxData);
+		OutEdgesIO = MakeShared<PCGExData::FPointIO>(InContext->GetOrCreateHandle(), EdgeData);
+	}
+}
+
+UPCGExBenchmarkCommandlet::UPCGExBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UPCGExBenchmarkCommandlet::Main(const FString& Params)
+{
+	int32 Seed = 1337;
+	int32 Scale = 1;
+	FString OutputPath = FPaths::ProjectSavedDir() / TEXT("PCGEx") / TEXT("Benchmark.json");
+
+	PCGExBenchmark::FRunner Runner;
+
+	FParse::Value(*Params, TEXT("Seed="), Seed);
+	FParse::Value(*Params, TEXT("Scale="), Scale);
+	FParse::Value(*Params, TEXT("Iterations="), Runner.Iterations);
+	FParse::Value(*Params, TEXT("Filter="), Runner.Filter);
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	Scale = FMath::Max(1, Scale);
+	Runner.Iterations = FMath::Max(1, Runner.Iterations);
+
+	const int32 NumPoints = 100000 * Scale;
+	const int32 NumTriangulated = 20000 * Scale;
+	const int32 NumQueries = 200 * Scale;
+
+	// Standalone context, so point data, facades and factories can be created outside of a graph execution.
+	// Declared first so it outlives everything that references it.
+	const TUniquePtr<FPCGExContext> Context = MakeUnique<FPCGExContext>();
+
+	TArray<FVector> Positions;
+	TArray<FVector> FlatPositions;
+	TArray<FVector> TriangulatedPositions;
+	PCGExBenchmark::MakePositions(Seed, NumPoints, false, Positions);
+	PCGExBenchmark::MakePositions(Seed + 1, NumTriangulated, true, FlatPositions);
+	PCGExBenchmark::MakePositions(Seed + 2, NumTriangulated, false, TriangulatedPositions);
+
+	TArray<uint64> EdgeHashes;
+	PCGExBenchmark::MakeEdgeHashes(Seed + 3, NumPoints, 4, EdgeHashes);
+
+	// Graph
+
+	{
+		PCGExGraph::FEdgeHashMap Map;
+		TArray<int32> NewKeys;
+
+		Runner.Run(
+			TEXT("EdgeHashMap.InsertUnique"), EdgeHashes.Num(),
+			[&]() { Map.Empty(); },
+			[&]() { Map.InsertUnique(EdgeHashes, 0, NewKeys); });
+	}
+
+	{
+		TSharedPtr<PCGExGraph::FGraph> Graph;
+
+		Runner.Run(
+			TEXT("Graph.InsertEdges"), EdgeHashes.Num(),
+			[&]() { Graph = MakeShared<PCGExGraph::FGraph>(NumPoints); },
+			[&]() { Graph->InsertEdges(EdgeHashes, -1); });
+
+		FPCGExGraphBuilderDetails Limits;
+
+		Runner.Run(
+			TEXT("Graph.BuildSubGraphs"), EdgeHashes.Num(),
+			[&]()
+			{
+				Graph = MakeShared<PCGExGraph::FGraph>(NumPoints);
+				Graph->InsertEdges(EdgeHashes, -1);
+			},
+			[&]() { Graph->BuildSubGraphs(Limits); });
+	}
+
+	// Clusters
+
+	TSharedPtr<PCGExData::FPointIO> VtxIO;
+	TSharedPtr<PCGExData::FPointIO> EdgesIO;
+	PCGExBenchmark::MakeGridCluster(Context.Get(), Seed + 6, FMath::RoundToInt32(FMath::Sqrt(static_cast<double>(NumPoints))), VtxIO, EdgesIO);
+
+	const TSharedPtr<PCGExData::FFacade> VtxFacade = MakeShared<PCGExData::FFacade>(VtxIO.ToSharedRef());
+	const TSharedPtr<PCGExData::FFacade> EdgesFacade = MakeShared<PCGExData::FFacade>(EdgesIO.ToSharedRef());
+
+	const int32 NumNodes = VtxIO->GetNum();
+	const int32 NumEdges = EdgesIO->GetNum();
+
+	TMap<uint32, int32> EndpointsLookup;
+	TArray<int32> ExpectedAdjacency;
+	PCGExGraph::BuildEndpointsLookup(VtxIO, EndpointsLookup, ExpectedAdjacency);
+
+	const TSharedPtr<PCGExCluster::FCluster> Cluster = MakeShared<PCGExCluster::FCluster>(VtxIO, EdgesIO, MakeShared<PCGEx::FIndexLookup>(NumNodes));
+	if (!Cluster->BuildFrom(EndpointsLookup, &ExpectedAdjacency))
+	{
+		UE_LOG(LogPCGExBenchmark, Error, TEXT("Could not build the synthetic cluster"));
+		return 1;
+	}
+
+	{
+		TSharedPtr<PCGExCluster::FCluster> RebuiltCluster;
+
+		Runner.Run(
+			TEXT("Cluster.BuildFrom"), NumEdges,
+			[&]() { RebuiltCluster = MakeShared<PCGExCluster::FCluster>(VtxIO, EdgesIO, MakeShared<PCGEx::FIndexLookup>(NumNodes)); },
+			[&]() { RebuiltCluster->BuildFrom(EndpointsLookup, &ExpectedAdjacency); });
+	}
+
+	{
+		UPCGExHeuristicsFactoryShortestDistance* HeuristicsFactory = Context->ManagedObjects->New<UPCGExHeuristicsFactoryShortestDistance>();
+		HeuristicsFactory->Config.bUseLocalCurve = true;
+		HeuristicsFactory->Config.Init();
+		HeuristicsFactory->ConfigBase = HeuristicsFactory->Config;
+		HeuristicsFactory->WeightFactor = HeuristicsFactory->Config.WeightFactor;
+
+		const TArray<TObjectPtr<const UPCGExHeuristicsFactoryData>> HeuristicsFactories = {HeuristicsFactory};
+		const TSharedPtr<PCGExHeuristics::FHeuristicsHandler> Heuristics = MakeShared<PCGExHeuristics::FHeuristicsHandler>(Context.Get(), VtxFacade, EdgesFacade, HeuristicsFactories);
+		Heuristics->PrepareForCluster(Cluster);
+		Heuristics->CompleteClusterPreparation();
+
+		const TSharedPtr<FPCGExSearchOperation> SearchOperation = Context->ManagedObjects->New<UPCGExSearchAStar>()->CreateOperation();
+		SearchOperation->PrepareForCluster(Cluster.Get());
+		const TSharedPtr<PCGExPathfinding::FSearchAllocations> Allocations = SearchOperation->NewAllocations();
+
+		FPCGExNodeSelectionDetails Picking;
+		Picking.PickingMethod = EPCGExClusterClosestSearchMode::Vtx;
+
+		const FRandomStream Random(Seed + 7);
+		TArray<TSharedPtr<PCGExPathfinding::FPathQuery>> Queries;
+		Queries.Reserve(NumQueries);
+
+		for (int i = 0; i < NumQueries; i++)
+		{
+			const TSharedPtr<PCGExPathfinding::FPathQuery> Query = MakeShared<PCGExPathfinding::FPathQuery>(
+				Cluster.ToSharedRef(),
+				VtxFacade->GetInPoint(Random.RandRange(0, NumNodes - 1)),
+				VtxFacade->GetInPoint(Random.RandRange(0, NumNodes - 1)), i);
+
+			if (Query->ResolvePicks(Picking, Picking) == PCGExPathfinding::EQueryPickResolution::Success) { Queries.Add(Query); }
+		}
+
+		Runner.Run(
+			TEXT("Pathfinding.AStar"), Queries.Num(),
+			[&]() { for (const TSharedPtr<PCGExPathfinding::FPathQuery>& Query : Queries) { Query->Cleanup(); } },
+			[&]() { for (const TSharedPtr<PCGExPathfinding::FPathQuery>& Query : Queries) { Query->FindPath(SearchOperation, Allocations, Heuristics, nullptr); } });
+	}
+
+	{
+		// Every edge is inserted with its own endpoints, so each vtx gets fused with the copies brought by its neighbors
+		TSharedPtr<PCGExGraph::FUnionGraph> UnionGraph;
+
+		Runner.Run(
+			TEXT("Fuse.UnionGraph"), NumEdges,
+			[&]()
+			{
+				UnionGraph = MakeShared<PCGExGraph::FUnionGraph>(FPCGExFuseDetails(false, 10), VtxIO->GetIn()->GetBounds().ExpandBy(10));
+				UnionGraph->Init(Context.Get());
+				UnionGraph->Reserve(NumNodes, NumEdges);
+			},
+			[&]()
+			{
+				for (const PCGExGraph::FEdge& Edge : *Cluster->Edges)
+				{
+					UnionGraph->InsertEdge(VtxFacade->GetInPoint(Edge.Start), VtxFacade->GetInPoint(Edge.End), EdgesFacade->GetInPoint(Edge.PointIndex));
+				}
+
+				UnionGraph->MergeShards();
+			});
+	}
+
+	// Geometry
+
+	{
+		FPCGExGeo2DProjectionDetails Projection(false);
+		Projection.Init(static_cast<const UPCGData*>(nullptr));
+
+		TUniquePtr<PCGExGeo::TDelaunay2> Delaunay2;
+		Runner.Run(
+			TEXT("Delaunay2.Process"), NumTriangulated,
+			[&]() { Delaunay2 = MakeUnique<PCGExGeo::TDelaunay2>(); },
+			[&]() { Delaunay2->Process(FlatPositions, Projection); });
+
+		TUniquePtr<PCGExGeo::TDelaunay3> Delaunay3;
+		Runner.Run(
+			TEXT("Delaunay3.Process"), NumTriangulated,
+			[&]() { Delaunay3 = MakeUnique<PCGExGeo::TDelaunay3>(); },
+			[&]() { Delaunay3->Process<false, false>(TriangulatedPositions); });
+	}
+
+	{
+		PCGExGeo::FKDTree Tree;
+
+		Runner.Run(
+			TEXT("KDTree.Build"), NumPoints,
+			[&]() {},
+			[&]() { Tree.Build(Positions); });
+
+		TArray<FVector> Queries;
+		PCGExBenchmark::MakePositions(Seed + 4, NumPoints, false, Queries);
+
+		double Checksum = 0;
+		Runner.Run(
+			TEXT("KDTree.FindNearest"), NumPoints,
+			[&]() { Checksum = 0; },
+			[&]()
+			{
+				PCGExGeo::FKDTree::FHit Hit;
+				for (const FVector& Query : Queries) { if (Tree.FindNearest(Query, Hit, [](const int32) { return true; })) { Checksum += Hit.DistSquared; } }
+			});
+
+		UE_LOG(LogPCGExBenchmark, Verbose, TEXT("KDTree checksum : %f"), Checksum);
+	}
+
+	// Paths
+
+	{
+		const int32 NumPathPoints = 10000 * Scale;
+		const int32 NumSplinePoints = 1000 * Scale;
+		const int32 NumPathQueries = 5000 * Scale;
+
+		TArray<FVector> PathPositions;
+		PCGExBenchmark::MakeLoop(Seed + 8, NumPathPoints, PathPositions);
+
+		const FBox PathBounds(PathPositions);
+		const FRandomStream Random(Seed + 9);
+
+		TArray<FVector> PathQueries;
+		PathQueries.SetNumUninitialized(NumPathQueries);
+		for (FVector& Query : PathQueries)
+		{
+			Query = FVector(
+				Random.FRandRange(PathBounds.Min.X, PathBounds.Max.X),
+				Random.FRandRange(PathBounds.Min.Y, PathBounds.Max.Y),
+				Random.FRandRange(-100, 100));
+		}
+
+		// Inclusion
+
+		TArray<FVector2D> Polygon;
+		Polygon.SetNumUninitialized(NumPathPoints);
+		for (int i = 0; i < NumPathPoints; i++) { Polygon[i] = FVector2D(PathPositions[i]); }
+
+		int32 NumInside = 0;
+		Runner.Run(
+			TEXT("Path.IsPointInPolygon"), NumPathQueries,
+			[&]() { NumInside = 0; },
+			[&]() { for (const FVector& Query : PathQueries) { NumInside += FGeomTools2D::IsPointInPolygon(FVector2D(Query), Polygon); } });
+
+		TSharedPtr<PCGExPaths::FPolygonInclusionGrid> InclusionGrid;
+		Runner.Run(
+			TEXT("Path.InclusionGrid.Build"), NumPathPoints,
+			[&]() { InclusionGrid.Reset(); },
+			[&]() { InclusionGrid = MakeShared<PCGExPaths::FPolygonInclusionGrid>(Polygon); });
+
+		if (!InclusionGrid) { InclusionGrid = MakeShared<PCGExPaths::FPolygonInclusionGrid>(Polygon); }
+
+		Runner.Run(
+			TEXT("Path.InclusionGrid.IsInside"), NumPathQueries,
+			[&]() { NumInside = 0; },
+			[&]() { for (const FVector& Query : PathQueries) { NumInside += InclusionGrid->IsInside(FVector2D(Query)); } });
+
+		UE_LOG(LogPCGExBenchmark, Verbose, TEXT("Path inclusion checksum : %d"), NumInside);
+
+		// Closest point
+
+		TArray<FTransform> PolylineTransforms;
+		PolylineTransforms.Reserve(NumPathPoints);
+		for (const FVector& Position : PathPositions) { PolylineTransforms.Emplace(Position); }
+		const TConstPCGValueRange<FTransform> PolylineRange(MakeConstStridedView(PolylineTransforms));
+
+		TSharedPtr<PCGExPaths::FSegmentTree> PolylineTree;
+		Runner.Run(
+			TEXT("Path.SegmentTree.BuildPolyline"), NumPathPoints,
+			[&]() { PolylineTree.Reset(); },
+			[&]() { PolylineTree = MakeShared<PCGExPaths::FSegmentTree>(PolylineRange, true); });
+
+		if (!PolylineTree) { PolylineTree = MakeShared<PCGExPaths::FSegmentTree>(PolylineRange, true); }
+
+		TArray<FVector> SplinePositions;
+		PCGExBenchmark::MakeLoop(Seed + 10, NumSplinePoints, SplinePositions);
+
+		TArray<FSplinePoint> SplinePoints;
+		SplinePoints.Reserve(NumSplinePoints);
+		for (int i = 0; i < NumSplinePoints; i++)
+		{
+			// Curve points get their tangents computed on initialization
+			SplinePoints.Emplace(
+				static_cast<float>(i), SplinePositions[i], FVector::ZeroVector, FVector::ZeroVector,
+				FRotator::ZeroRotator, FVector::OneVector, ESplinePointType::Curve);
+		}
+
+		FPCGSplineStruct Spline;
+		Spline.Initialize(SplinePoints, true, FTransform::Identity);
+
+		TSharedPtr<PCGExPaths::FSegmentTree> SplineTree;
+		Runner.Run(
+			TEXT("Path.SegmentTree.BuildSpline"), NumSplinePoints,
+			[&]() { SplineTree.Reset(); },
+			[&]() { SplineTree = MakeShared<PCGExPaths::FSegmentTree>(Spline); });
+
+		if (!SplineTree) { SplineTree = MakeShared<PCGExPaths::FSegmentTree>(Spline); }
+
+		double Checksum = 0;
+		Runner.Run(
+			TEXT("Path.SegmentTree.ClosestKeyPolyline"), NumPathQueries,
+			[&]() { Checksum = 0; },
+			[&]()
+			{
+				double Key = 0;
+				for (const FVector& Query : PathQueries) { if (PolylineTree->FindClosestKey(Query, Key)) { Checksum += Key; } }
+			});
+
+		Runner.Run(
+			TEXT("Path.Spline.ClosestKey"), NumPathQueries,
+			[&]() { Checksum = 0; },
+			[&]() { for (const FVector& Query : PathQueries) { Checksum += Spline.FindInputKeyClosestToWorldLocation(Query); } });
+
+		Runner.Run(
+			TEXT("Path.SegmentTree.ClosestKeySpline"), NumPathQueries,
+			[&]() { Checksum = 0; },
+			[&]()
+			{
+				double Key = 0;
+				for (const FVector& Query : PathQueries) { if (SplineTree->FindClosestKey(Query, Key)) { Checksum += Key; } }
+			});
+
+		UE_LOG(LogPCGExBenchmark, Verbose, TEXT("Path closest key checksum : %f"), Checksum);
+	}
+
+	// Filters
+
+	{
+		const FRandomStream Random(Seed + 5);
+
+		TArray<double> A;
+		TArray<double> B;
+		A.SetNumUninitialized(NumPoints);
+		B.SetNumUninitialized(NumPoints);
+		for (int i = 0; i < NumPoints; i++)
+		{
+			A[i] = Random.FRand();
+			B[i] = Random.FRand();
+		}
+
+		TArray<int8> Results;
+		Runner.Run(
+			TEXT("Compare.CompareRange"), NumPoints,
+			[&]() { Results.Init(1, NumPoints); },
+			[&]() { PCGExCompare::CompareRange(EPCGExComparison::NearlyEqual, A, B, Results, 0.25); });
+	}
+
+	{
+		UPCGExNumericCompareFilterFactory* FilterFactory = Context->ManagedObjects->New<UPCGExNumericCompareFilterFactory>();
+		FilterFactory->Config.OperandA.Update(PCGExBenchmark::Attr_Score.ToString());
+		FilterFactory->Config.Comparison = EPCGExComparison::StrictlyGreater;
+		FilterFactory->Config.CompareAgainst = EPCGExInputValueType::Constant;
+		FilterFactory->Config.OperandBConstant = 0.5;
+
+		const TArray<TObjectPtr<const UPCGExPointFilterFactoryData>> FilterFactories = {FilterFactory};
+
+		const TSharedPtr<PCGExPointFilter::FManager> PointFilters = MakeShared<PCGExPointFilter::FManager>(VtxFacade.ToSharedRef());
+		if (PointFilters->Init(Context.Get(), FilterFactories))
+		{
+			int32 NumPass = 0;
+			Runner.Run(
+				TEXT("Filters.TestPoints"), NumNodes,
+				[&]() { NumPass = 0; },
+				[&]() { for (int i = 0; i < NumNodes; i++) { NumPass += PointFilters->Test(i); } });
+
+			TArray<int8> Results;
+			Runner.Run(
+				TEXT("Filters.TestScope"), NumNodes,
+				[&]() { Results.Init(0, NumNodes); },
+				[&]() { NumPass = PointFilters->Test(PCGExMT::FScope(0, NumNodes), Results); });
+
+			UE_LOG(LogPCGExBenchmark, Verbose, TEXT("Point filters pass : %d"), NumPass);
+		}
+
+		const TSharedPtr<PCGExClusterFilter::FManager> NodeFilters = MakeShared<PCGExClusterFilter::FManager>(Cluster.ToSharedRef(), VtxFacade.ToSharedRef(), EdgesFacade.ToSharedRef());
+		if (NodeFilters->Init(Context.Get(), FilterFactories))
+		{
+			TArray<int8> Results;
+			Runner.Run(
+				TEXT("Filters.ClusterNodes"), NumNodes,
+				[&]() { Results.Init(0, NumNodes); },
+				[&]() { NodeFilters->Test(*Cluster->Nodes, Results); });
+		}
+	}
+
+	// Sorting
+
+	{
+		FPCGExSortRuleConfig Rule;
+		Rule.Selector.Update(PCGExBenchmark::Attr_Score.ToString());
+
+		const TSharedPtr<PCGExSorting::FPointSorter> Sorter = MakeShared<PCGExSorting::FPointSorter>(Context.Get(), VtxFacade.ToSharedRef(), TArray<FPCGExSortRuleConfig>{Rule});
+		if (Sorter->Init(Context.Get()))
+		{
+			TArray<int32> Order;
+			Runner.Run(
+				TEXT("Sort.PointSorter"), NumNodes,
+				[&]()
+				{
+					Order.SetNumUninitialized(NumNodes);
+					for (int i = 0; i < NumNodes; i++) { Order[i] = i; }
+				},
+				[&]() { Sorter->Sort(Order); });
+		}
+	}
+
+	// Blending
+
+	{
+		// Blend in place over a duplicate of the vtx data, source and target being the same point
+		const TSharedPtr<PCGExData::FPointIO> BlendIO = MakeShared<PCGExData::FPointIO>(Context->GetOrCreateHandle(), VtxIO->GetIn());
+		BlendIO->InitializeOutput(PCGExData::EIOInit::Duplicate);
+
+		const TSharedPtr<PCGExData::FFacade> BlendFacade = MakeShared<PCGExData::FFacade>(BlendIO.ToSharedRef());
+
+		PCGExData::FProxyDescriptor A(BlendFacade);
+		if (A.Capture(Context.Get(), PCGExBenchmark::Attr_Score.ToString(), PCGExData::EIOSide::In))
+		{
+			PCGExData::FProxyDescriptor C = A;
+			C.Side = PCGExData::EIOSide::Out;
+			C.Role = PCGExData::EProxyRole::Write;
+
+			if (const TSharedPtr<PCGExDataBlending::FProxyDataBlender> Blender = PCGExDataBlending::CreateProxyBlender(Context.Get(), EPCGExABBlendingType::Lerp, A, C))
+			{
+				Runner.Run(
+					TEXT("Blend.Lerp"), NumNodes,
+					[&]() {},
+					[&]() { for (int i = 0; i < NumNodes; i++) { Blender->Blend(i, i, 0.5); } });
+
+				TArray<double> Weights;
+				TArray<int8> Mask;
+				Weights.Init(0.5, NumNodes);
+				Mask.Init(1, NumNodes);
+
+				Runner.Run(
+					TEXT("Blend.LerpRange"), NumNodes,
+					[&]() {},
+					[&]() { Blender->BlendRange(PCGExMT::FScope(0, NumNodes), Weights, Mask); });
+			}
+		}
+	}
+
+	// Output
+
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetNumberField(TEXT("seed"), Seed);
+	Root->SetNumberField(TEXT("scale"), Scale);
+	Root->SetNumberField(TEXT("iterations"), Runner.Iterations);
+	Root->SetStringField(TEXT("platform"), FPlatformProperties::IniPlatformName());
+	Root->SetStringField(TEXT("cpu"), FPlatformMisc::GetCPUBrand());
+	Root->SetNumberField(TEXT("cores"), FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+
+	TArray<TSharedPtr<FJsonValue>> JsonResults;
+	for (const PCGExBenchmark::FResult& Result : Runner.Results)
+	{
+		double Min = MAX_dbl;
+		double Sum = 0;
+		for (const double Timing : Result.Timings)
+		{
+			Min = FMath::Min(Min, Timing);
+			Sum += Timing;
+		}
+
+		const double Median = PCGExBenchmark::FRunner::GetMedian(Result.Timings);
+
+		TSharedRef<FJsonObject> JsonResult = MakeShared<FJsonObject>();
+		JsonResult->SetStringField(TEXT("name"), Result.Name);
+		JsonResult->SetNumberField(TEXT("items"), Result.NumItems);
+		JsonResult->SetNumberField(TEXT("min_ms"), Min * 1000);
+		JsonResult->SetNumberField(TEXT("median_ms"), Median * 1000);
+		JsonResult->SetNumberField(TEXT("mean_ms"), Sum / Result.Timings.Num() * 1000);
+		JsonResult->SetNumberField(TEXT("items_per_second"), Median > 0 ? Result.NumItems / Median : 0);
+
+		JsonResults.Add(MakeShared<FJsonValueObject>(JsonResult));
+	}
+
+	Root->SetArrayField(TEXT("results"), JsonResults);
+
+	FString Output;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+	if (!FJsonSerializer::Serialize(Root, Writer) || !FFileHelper::SaveStringToFile(Output, *OutputPath))
+	{
+		UE_LOG(LogPCGExBenchmark, Error, TEXT("Could not write benchmark results to %s"), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogPCGExBenchmark, Display, TEXT("Benchmark results written to %s"), *OutputPath);
+	return 0;
+}
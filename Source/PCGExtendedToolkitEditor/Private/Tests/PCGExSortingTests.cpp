@@ -0,0 +1,97 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Misc/AutomationTest.h"
+
+#include <limits>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "PCGExContext.h"
+#include "PCGExSorting.h"
+#include "Data/PCGExData.h"
+#include "Data/PCGExPointIO.h"
+
+namespace PCGExSortingTests
+{
+	const FName Attr_Value = FName("Value");
+	constexpr double Inf = std::numeric_limits<double>::infinity();
+
+	/** Sorts Values with a single rule and returns the resulting order of indices. */
+	static TArray<int32> SortValues(const TArray<double>& Values, const double Tolerance, const EPCGExSortDirection Direction = EPCGExSortDirection::Ascending)
+	{
+		const TUniquePtr<FPCGExContext> Context = MakeUnique<FPCGExContext>();
+		const int32 NumValues = Values.Num();
+
+		const TSharedPtr<PCGExData::FPointIO> WriteIO = MakeShared<PCGExData::FPointIO>(Context->GetOrCreateHandle());
+		WriteIO->InitializeOutput(PCGExData::EIOInit::New);
+		WriteIO->GetOut()->SetNumPoints(NumValues);
+
+		{
+			const TSharedPtr<PCGExData::FFacade> WriteFacade = MakeShared<PCGExData::FFacade>(WriteIO.ToSharedRef());
+			const TSharedPtr<PCGExData::TBuffer<double>> Writer = WriteFacade->GetWritable<double>(Attr_Value, 0, true, PCGExData::EBufferInit::New);
+			for (int i = 0; i < NumValues; i++) { Writer->SetValue(i, Values[i]); }
+			WriteFacade->WriteSynchronous();
+		}
+
+		const TSharedPtr<PCGExData::FPointIO> ReadIO = MakeShared<PCGExData::FPointIO>(Context->GetOrCreateHandle(), WriteIO->GetOut());
+		const TSharedPtr<PCGExData::FFacade> Facade = MakeShared<PCGExData::FFacade>(ReadIO.ToSharedRef());
+
+		FPCGExSortRuleConfig Rule;
+		Rule.Selector.Update(Attr_Value.ToString());
+		Rule.Tolerance = Tolerance;
+
+		TArray<int32> Order;
+		Order.SetNumUninitialized(NumValues);
+		for (int i = 0; i < NumValues; i++) { Order[i] = i; }
+
+		const TSharedPtr<PCGExSorting::FPointSorter> Sorter = MakeShared<PCGExSorting::FPointSorter>(Context.Get(), Facade.ToSharedRef(), TArray<FPCGExSortRuleConfig>{Rule});
+		Sorter->SortDirection = Direction;
+		if (Sorter->Init(Context.Get())) { Sorter->Sort(Order); }
+
+		return Order;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPCGExSortingToleranceTest, "PCGEx.Sorting.Tolerance", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FPCGExSortingToleranceTest::RunTest(const FString& Parameters)
+{
+	// Values within tolerance keep their input order, others are sorted
+	TestTrue(TEXT("Within tolerance"), PCGExSortingTests::SortValues({2, 1.005, 1, 0}, 0.01) == TArray<int32>{3, 1, 2, 0});
+	TestTrue(TEXT("Descending"), PCGExSortingTests::SortValues({2, 1.005, 1, 0}, 0.01, EPCGExSortDirection::Descending) == TArray<int32>{0, 1, 2, 3});
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPCGExSortingMixedMagnitudeTest, "PCGEx.Sorting.MixedMagnitude", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FPCGExSortingMixedMagnitudeTest::RunTest(const FString& Parameters)
+{
+	// Range is far too wide for 0.01 buckets; small values must not be merged together
+	TestTrue(TEXT("Mixed magnitudes"), PCGExSortingTests::SortValues({1e20, 2, 0, 1, -1e20}, 0.01) == TArray<int32>{4, 2, 3, 1, 0});
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPCGExSortingNonFiniteTest, "PCGEx.Sorting.NonFinite", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FPCGExSortingNonFiniteTest::RunTest(const FString& Parameters)
+{
+	TestTrue(
+		TEXT("Max double sentinels"),
+		PCGExSortingTests::SortValues({MAX_dbl, 1, -MAX_dbl, 0, -1}, 0.01) ==
+		TArray<int32>{2, 4, 3, 1, 0});
+
+	TestTrue(
+		TEXT("Infinities"),
+		PCGExSortingTests::SortValues({1, PCGExSortingTests::Inf, -0.0, -PCGExSortingTests::Inf, MAX_dbl, -2}, 0.01) ==
+		TArray<int32>{3, 5, 2, 0, 4, 1});
+
+	TestTrue(
+		TEXT("Infinities, descending"),
+		PCGExSortingTests::SortValues({1, PCGExSortingTests::Inf, -PCGExSortingTests::Inf, 0}, 0.01, EPCGExSortDirection::Descending) ==
+		TArray<int32>{1, 0, 3, 2});
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,29 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+
+#include "PCGExBenchmarkCommandlet.generated.h"
+
+/**
+ * Headless timing of core kernels over synthetic data generated from a fixed seed.
+ * Cluster, pathfinding, fuse, sorting, blending and filter benchmarks run on a jittered grid cluster
+ * written to regular point data, and go through the same facades & managers nodes use.
+ * Path benchmarks run on a seeded star-shaped loop, both as a polyline and as a curve spline.
+ * Results are written as JSON so throughput can be compared between releases.
+ *
+ * UnrealEditor-Cmd <Project> -run=PCGExBenchmark -nullrhi [-Scale=1] [-Iterations=5] [-Seed=1337] [-Filter=Name] [-Output=Path.json]
+ */
+UCLASS()
+class UPCGExBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UPCGExBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};